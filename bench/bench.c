@@ -0,0 +1,682 @@
+/*
+ * =============================================================================
+ * File        : bench.c
+ * Deskripsi   : Program benchmark mesin penyimpanan dan agregasi (tanpa TUI)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Program ini mengukur operasi file dan perhitungan inti pada beberapa
+ * skala data (10^3 sampai 10^6 baris transaksi), termasuk:
+ * - muat_transaksi dan muat_transaksi_bulan
+ * - tambah_transaksi_ke_file dan ubah_transaksi_di_file
+ * - update_semua_pos_bulan dan hitung_analisis_bulan
+ * - buat_id_transaksi
+ * - Amplifikasi per aksi pengguna (tambah/ubah/hapus transaksi dan pos,
+ *   buka layar): byte logis yang berubah dibanding byte fisik baca/tulis
+ * - Gerbang regresi: median operasi yang dilacak dibandingkan dengan file
+ *   baseline (keluaran run sebelumnya) dengan toleransi persen, setelah
+ *   dinormalisasi dengan loop kalibrasi
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, stdlib.h, string.h : Untuk I/O, alokasi, dan string
+ * - time.h      : Untuk clock_gettime (CLOCK_MONOTONIC)
+ * - keuangan.h  : API mesin (file, transaksi, pos, analisis, instrumen) dari libkeuangan.a
+ * - generator.h : Untuk data sintetis dan direktori kerja sementara
+ * - referensi.h : Untuk parser beku pada beban kalibrasi
+ *
+ * CATATAN:
+ * Data dibuat deterministik di direktori sementara sehingga hasil dapat
+ * dibandingkan antar commit. Jumlah syscall dan byte dibaca dari
+ * /proc/self/io (Linux); di sistem lain kolom tersebut bernilai 0.
+ * Keluaran berformat teks kolom tetap, satu baris per (operasi, skala):
+ * kolom syscall dan byte stabil, kolom waktu bergantung mesin.
+ * Setiap iterasi didahului beban kalibrasi tetap (baca dan urai 100 baris
+ * dengan parser referensi). Kolom kal_us dipilih sehingga median_us / kal_us
+ * sama dengan median rasio waktu operasi / kalibrasi; gerbang regresi
+ * membandingkan rasio itu sehingga mesin yang sedang lambat atau sibuk tidak
+ * terbaca sebagai regresi.
+ * Tabel amplifikasi dicetak setelahnya, satu baris per (aksi, skala); aksi
+ * dijalankan sekali tanpa thread pekerja sehingga perhitungan ulang pos dan
+ * analisis ikut terhitung pada aksi yang memicunya.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "keuangan.h"
+#include "generator.h"
+#include "referensi.h"
+
+/* ===== KONSTANTA ===== */
+
+#define BENCH_VERSI         3           /* Versi format keluaran */
+#define BENCH_MAKS_DEFAULT  1000000     /* Skala terbesar default */
+#define BENCH_ULANG_MIN     5           /* Minimal pengulangan per operasi */
+#define BENCH_ULANG_MAKS    200         /* Maksimal pengulangan per operasi */
+#define BENCH_BULAN         10          /* Bulan yang diukur */
+#define BENCH_JUMLAH_POS    8           /* Jumlah pos per bulan */
+#define BENCH_MAKS_SKALA    8           /* Jumlah skala maksimal (10^3 .. 10^10) */
+#define BENCH_TOLERANSI     25.0        /* Toleransi regresi default (persen) */
+#define BENCH_AMBANG_US     5.0         /* Selisih di bawah ini dianggap derau, bukan regresi */
+#define BENCH_MAKS_HASIL    128         /* Kapasitas hasil median yang disimpan */
+#define BENCH_KALIBRASI_BARIS 100       /* Jumlah baris file kalibrasi */
+#define BENCH_KALIBRASI_FILE  "kalibrasi.txt"   /* Di direktori kerja sementara */
+
+/* ===== STRUKTUR DATA ===== */
+
+/**
+ * Struct penghitung I/O proses dari /proc/self/io
+ */
+typedef struct {
+    unsigned long long byte_baca;       /* rchar */
+    unsigned long long byte_tulis;      /* wchar */
+    unsigned long long syscall_baca;    /* syscr */
+    unsigned long long syscall_tulis;   /* syscw */
+} StatistikIO;
+
+/**
+ * Struct konteks satu skala benchmark
+ */
+typedef struct {
+    int baris;                  /* Jumlah baris transaksi di file */
+    int ulang;                  /* Jumlah pengulangan per operasi */
+    int putaran;                /* Pengali jumlah sampel untuk operasi selain satu baris */
+    Transaksi *buffer;          /* Array tujuan untuk muat_transaksi */
+    Transaksi target;           /* Transaksi yang diubah oleh ubah_transaksi_di_file */
+} KonteksBench;
+
+/**
+ * Struct median satu (operasi, skala) untuk dibandingkan dengan baseline
+ */
+typedef struct {
+    char nama[32];              /* Nama operasi */
+    int baris;                  /* Skala */
+    double median_us;           /* Median latensi */
+    double kalibrasi_us;        /* Kalibrasi ekuivalen: median_us / kalibrasi_us = median rasio (0 jika tidak ada) */
+} HasilOperasi;
+
+/**
+ * Struct hasil akuntansi aksi pengguna pada satu skala
+ */
+typedef struct {
+    int baris;                              /* Jumlah baris transaksi di file */
+    int jumlah;                             /* Jumlah aksi terisi */
+    StatistikAksi aksi[INS_JUMLAH_AKSI];    /* Statistik per aksi */
+} HasilAmplifikasi;
+
+/**
+ * Callback satu kali eksekusi operasi yang diukur
+ */
+typedef void (*OperasiBench)(KonteksBench *k, int iterasi);
+
+/* ===== VARIABEL GLOBAL LOKAL ===== */
+
+static StatistikIO biaya_baca_io;   /* I/O milik pembacaan /proc/self/io itu sendiri */
+static HasilOperasi hasil_operasi[BENCH_MAKS_HASIL];
+static int jumlah_hasil = 0;
+
+/* ===== FUNGSI HELPER ===== */
+
+/**
+ * Helper: Waktu monotonic dalam nanodetik
+ */
+static double waktu_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * Helper: Membaca penghitung I/O proses, semua 0 jika tidak tersedia
+ */
+static void baca_statistik_io(StatistikIO *io) {
+    memset(io, 0, sizeof(StatistikIO));
+
+    FILE *fp = fopen("/proc/self/io", "r");
+    if (!fp) return;
+
+    char kunci[32];
+    unsigned long long nilai;
+    while (fscanf(fp, "%31[^:]: %llu\n", kunci, &nilai) == 2) {
+        if (strcmp(kunci, "rchar") == 0) io->byte_baca = nilai;
+        else if (strcmp(kunci, "wchar") == 0) io->byte_tulis = nilai;
+        else if (strcmp(kunci, "syscr") == 0) io->syscall_baca = nilai;
+        else if (strcmp(kunci, "syscw") == 0) io->syscall_tulis = nilai;
+    }
+    fclose(fp);
+}
+
+/**
+ * Helper: Selisih penghitung dikurangi biaya pembacaan, dibagi jumlah pemanggilan
+ */
+static unsigned long long selisih_per_panggilan(unsigned long long akhir, unsigned long long awal,
+                                               unsigned long long biaya, int ulang) {
+    unsigned long long delta = akhir - awal;
+    delta = (delta > biaya) ? delta - biaya : 0;
+    return delta / ulang;
+}
+
+/**
+ * Helper: Pembanding double untuk qsort
+ */
+static int banding_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Helper: Satu sampel kalibrasi (nanodetik): membaca file kalibrasi dengan
+ * fgets dan mengurai tiap barisnya dengan parser referensi yang dibekukan.
+ * Bebannya serupa operasi yang diukur tetapi tidak memakai kode src/, jadi
+ * hanya berubah jika kecepatan mesin berubah.
+ */
+static double sampel_kalibrasi(void) {
+    double mulai = waktu_ns();
+    FILE *f = fopen(BENCH_KALIBRASI_FILE, "r");
+    if (f) {
+        char line[MAX_LINE_LENGTH];
+        Transaksi trx;
+        while (fgets(line, sizeof(line), f)) ref_urai_baris_transaksi(line, &trx);
+        fclose(f);
+    }
+    return waktu_ns() - mulai;
+}
+
+/**
+ * Helper: Menulis file kalibrasi berisi baris transaksi tetap
+ */
+static int siapkan_kalibrasi(void) {
+    FILE *f = fopen(BENCH_KALIBRASI_FILE, "w");
+    if (!f) return 0;
+
+    for (int i = 1; i <= BENCH_KALIBRASI_BARIS; i++) {
+        Transaksi trx;
+        char line[MAX_LINE_LENGTH];
+        memset(&trx, 0, sizeof(trx));
+        format_id_transaksi(i, trx.id, sizeof(trx.id));
+        snprintf(trx.tanggal, sizeof(trx.tanggal), "%02d-%02d-2025", i % 28 + 1, i % 12 + 1);
+        trx.jenis = (i % 5 == 0) ? JENIS_PEMASUKAN : JENIS_PENGELUARAN;
+        snprintf(trx.pos, sizeof(trx.pos), "Pos%d", i % 8);
+        trx.nominal = 5000ULL + (unsigned long long)i * 137;
+        snprintf(trx.deskripsi, sizeof(trx.deskripsi), "Kalibrasi %d", i);
+        ref_format_transaksi_ke_string(&trx, line, sizeof(line));
+        fprintf(f, "%s\n", line);
+    }
+    return fclose(f) == 0;
+}
+
+/**
+ * Helper: Membangkitkan N baris transaksi beserta pos dan analisis
+ */
+static int siapkan_data(int baris) {
+    KonfigurasiGenerator cfg;
+    konfigurasi_generator_default(&cfg);
+    cfg.baris = baris;
+    cfg.jumlah_pos = BENCH_JUMLAH_POS;
+    return bangkitkan_ledger(&cfg, NULL);
+}
+
+/* ===== OPERASI YANG DIUKUR ===== */
+
+/**
+ * Operasi: memuat semua transaksi ke array
+ */
+static void op_muat_transaksi(KonteksBench *k, int iterasi) {
+    (void)iterasi;
+    muat_transaksi(k->buffer, k->baris);
+}
+
+/**
+ * Operasi: memuat transaksi satu bulan ke array
+ */
+static void op_muat_transaksi_bulan(KonteksBench *k, int iterasi) {
+    (void)iterasi;
+    muat_transaksi_bulan(k->buffer, k->baris, BENCH_BULAN);
+}
+
+/**
+ * Operasi: membuat ID transaksi baru
+ */
+static void op_buat_id_transaksi(KonteksBench *k, int iterasi) {
+    (void)k;
+    (void)iterasi;
+    char id[MAX_ID_LENGTH + 1];
+    buat_id_transaksi(id, sizeof(id));
+}
+
+/**
+ * Operasi: menghitung analisis satu bulan
+ */
+static void op_hitung_analisis_bulan(KonteksBench *k, int iterasi) {
+    (void)k;
+    (void)iterasi;
+    AnalisisKeuangan a;
+    hitung_analisis_bulan(BENCH_BULAN, &a);
+}
+
+/**
+ * Operasi: menghitung ulang dan menyimpan semua pos bulan
+ */
+static void op_update_semua_pos_bulan(KonteksBench *k, int iterasi) {
+    (void)k;
+    (void)iterasi;
+    update_semua_pos_bulan(BENCH_BULAN);
+}
+
+/**
+ * Operasi: mengubah satu transaksi di tengah file
+ */
+static void op_ubah_transaksi_di_file(KonteksBench *k, int iterasi) {
+    /* Nominal berganti tiap iterasi; jumlah baris tetap */
+    k->target.nominal = 1000 + iterasi;
+    ubah_transaksi_di_file(k->target.id, &k->target);
+}
+
+/**
+ * Operasi: menambah satu transaksi ke akhir file
+ */
+static void op_tambah_transaksi_ke_file(KonteksBench *k, int iterasi) {
+    Transaksi trx = k->target;
+    format_id_transaksi(k->baris + iterasi + 1, trx.id, sizeof(trx.id));
+    tambah_transaksi_ke_file(&trx);
+}
+
+/**
+ * Daftar operasi; operasi yang menambah baris sengaja diletakkan terakhir.
+ * satu_baris = 1 jika operasi hanya memproses satu baris (baris_per_dtk
+ * dihitung dari 1 baris, bukan seluruh file).
+ * dilacak = 1 jika operasi ikut gerbang regresi --baseline.
+ */
+static const struct {
+    const char *nama;
+    OperasiBench jalankan;
+    int satu_baris;
+    int dilacak;
+} DAFTAR_OPERASI[] = {
+    { "muat_transaksi",           op_muat_transaksi,           0, 1 },
+    { "muat_transaksi_bulan",     op_muat_transaksi_bulan,     0, 1 },
+    { "buat_id_transaksi",        op_buat_id_transaksi,        0, 0 },
+    { "hitung_analisis_bulan",    op_hitung_analisis_bulan,    0, 1 },
+    { "update_semua_pos_bulan",   op_update_semua_pos_bulan,   0, 1 },
+    { "ubah_transaksi_di_file",   op_ubah_transaksi_di_file,   0, 0 },
+    { "tambah_transaksi_ke_file", op_tambah_transaksi_ke_file, 1, 1 },
+};
+
+#define JUMLAH_OPERASI ((int)(sizeof(DAFTAR_OPERASI) / sizeof(DAFTAR_OPERASI[0])))
+
+/**
+ * Helper: Mengukur satu operasi dan mencetak satu baris hasil.
+ * Putaran mengalikan jumlah sampel (ulang x putaran); median dan p99
+ * dihitung dari semua sampel, kolom syscall dan byte dirata-rata atas semua
+ * pemanggilan.
+ */
+static void ukur_operasi(KonteksBench *k, const char *nama, OperasiBench jalankan, int satu_baris) {
+    double *sampel = malloc(sizeof(double) * k->ulang * k->putaran);
+    double *sampel_rasio = malloc(sizeof(double) * k->ulang * k->putaran);
+    if (!sampel || !sampel_rasio) {
+        free(sampel);
+        free(sampel_rasio);
+        return;
+    }
+
+    /* Operasi satu baris menambah baris file; sampel tambahan akan mengubah skala */
+    int putaran = satu_baris ? 1 : k->putaran;
+    int n = putaran * k->ulang;
+
+    StatistikIO awal, akhir;
+    baca_statistik_io(&awal);
+
+    /* Tiap iterasi didahului satu sampel kalibrasi; rasio pasangan yang berdekatan
+       waktunya tidak terpengaruh mesin yang melambat di tengah pengukuran */
+    for (int i = 0; i < n; i++) {
+        double kal = sampel_kalibrasi();
+        double mulai = waktu_ns();
+        jalankan(k, i);
+        sampel[i] = waktu_ns() - mulai;
+        sampel_rasio[i] = (kal > 0) ? sampel[i] / kal : 0;
+    }
+
+    baca_statistik_io(&akhir);
+
+    qsort(sampel, n, sizeof(double), banding_double);
+    qsort(sampel_rasio, n, sizeof(double), banding_double);
+    double median = sampel[n / 2];
+    double p99 = sampel[(int)((n - 1) * 0.99 + 0.5)];
+    double rasio = sampel_rasio[n / 2];
+
+    /* kal_us ekuivalen: median_us / kal_us sama dengan median rasio */
+    double kalibrasi = (rasio > 0) ? median / rasio / 1000.0 : 0;
+
+    int diproses = satu_baris ? 1 : k->baris;
+    double baris_per_detik = (median > 0) ? (double)diproses * 1e9 / median : 0;
+
+    printf("%-26s %8d %6d %12.1f %12.1f %14.0f %10llu %10llu %12llu %12llu %10.1f\n",
+           nama, k->baris, n, median / 1000.0, p99 / 1000.0, baris_per_detik,
+           selisih_per_panggilan(akhir.syscall_baca, awal.syscall_baca, biaya_baca_io.syscall_baca, n),
+           selisih_per_panggilan(akhir.syscall_tulis, awal.syscall_tulis, biaya_baca_io.syscall_tulis, n),
+           selisih_per_panggilan(akhir.byte_baca, awal.byte_baca, biaya_baca_io.byte_baca, n),
+           selisih_per_panggilan(akhir.byte_tulis, awal.byte_tulis, biaya_baca_io.byte_tulis, n),
+           kalibrasi);
+    fflush(stdout);
+
+    if (jumlah_hasil < BENCH_MAKS_HASIL) {
+        HasilOperasi *h = &hasil_operasi[jumlah_hasil++];
+        snprintf(h->nama, sizeof(h->nama), "%s", nama);
+        h->baris = k->baris;
+        h->median_us = median / 1000.0;
+        h->kalibrasi_us = kalibrasi;
+    }
+
+    free(sampel);
+    free(sampel_rasio);
+}
+
+/**
+ * Helper: Mengembalikan 1 jika operasi termasuk yang dilacak gerbang regresi
+ */
+static int operasi_dilacak(const char *nama) {
+    for (int i = 0; i < JUMLAH_OPERASI; i++) {
+        if (strcmp(DAFTAR_OPERASI[i].nama, nama) == 0) return DAFTAR_OPERASI[i].dilacak;
+    }
+    return 0;
+}
+
+/**
+ * Helper: Membaca median operasi dilacak dari file baseline (keluaran run sebelumnya).
+ * Dipanggil sebelum pindah ke direktori kerja agar path relatif tetap berlaku.
+ * Mengembalikan jumlah baris yang terbaca, -1 jika file tidak dapat dibuka.
+ */
+static int muat_baseline(const char *path, HasilOperasi *dasar, int maks) {
+    FILE *f = fopen(path, "r");
+    if (!f) return -1;
+
+    int jumlah = 0;
+    char line[256];
+
+    /* Baris data tabel pertama: nama, baris, ulang, median_us, ..., kal_us (kolom ke-11) */
+    while (fgets(line, sizeof(line), f) && jumlah < maks) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+
+        HasilOperasi h;
+        int ulang;
+        double abaikan;
+        unsigned long long abaikan_n;
+        h.kalibrasi_us = 0;
+        int n = sscanf(line, "%31s %d %d %lf %lf %lf %llu %llu %llu %llu %lf",
+                       h.nama, &h.baris, &ulang, &h.median_us, &abaikan, &abaikan,
+                       &abaikan_n, &abaikan_n, &abaikan_n, &abaikan_n, &h.kalibrasi_us);
+        if (n < 11) h.kalibrasi_us = 0;     /* Baseline v2 tanpa kolom kalibrasi */
+        if (n >= 4 && operasi_dilacak(h.nama)) {
+            dasar[jumlah++] = h;
+        }
+    }
+    fclose(f);
+
+    return jumlah;
+}
+
+/**
+ * Helper: Membandingkan median run ini dengan baseline.
+ * Median baseline lebih dulu diskalakan dengan rasio kalibrasi (run ini /
+ * baseline) jika keduanya punya kolom kal_us.
+ * Regresi = lebih lambat dari toleransi persen DAN lebih dari BENCH_AMBANG_US,
+ * agar operasi beberapa mikrodetik tidak gagal karena derau penjadwal.
+ * Mengembalikan jumlah operasi yang melambat melebihi toleransi.
+ */
+static int banding_baseline(const char *path, const HasilOperasi *dasar, int jumlah_dasar,
+                            double toleransi) {
+    printf("\n# regresi terhadap %s; toleransi %.1f%% (minimal %.0f us)\n",
+           path, toleransi, BENCH_AMBANG_US);
+    printf("%-26s %8s %12s %8s %12s %9s %s\n",
+           "# operasi", "baris", "baseline_us", "faktor", "median_us", "ubah_%", "status");
+
+    int regresi = 0;
+    for (int i = 0; i < jumlah_hasil; i++) {
+        const HasilOperasi *h = &hasil_operasi[i];
+        if (!operasi_dilacak(h->nama)) continue;
+
+        const HasilOperasi *d = NULL;
+        for (int j = 0; j < jumlah_dasar && !d; j++) {
+            if (dasar[j].baris == h->baris && strcmp(dasar[j].nama, h->nama) == 0) d = &dasar[j];
+        }
+
+        if (!d || d->median_us <= 0) {
+            printf("%-26s %8d %12s %8s %12.1f %9s %s\n", h->nama, h->baris, "-", "-", h->median_us, "-", "BARU");
+            continue;
+        }
+
+        /* Baseline dinyatakan dalam kecepatan mesin saat operasi ini diukur */
+        double faktor = (d->kalibrasi_us > 0 && h->kalibrasi_us > 0) ? h->kalibrasi_us / d->kalibrasi_us : 1.0;
+        double dasar_us = d->median_us * faktor;
+        double ubah = (h->median_us - dasar_us) * 100.0 / dasar_us;
+        int lambat = ubah > toleransi && h->median_us - dasar_us > BENCH_AMBANG_US;
+        if (lambat) regresi++;
+        printf("%-26s %8d %12.1f %8.2f %12.1f %+9.1f %s\n", h->nama, h->baris,
+               d->median_us, faktor, h->median_us, ubah, lambat ? "REGRESI" : "OK");
+    }
+
+    return regresi;
+}
+
+/**
+ * Helper: Menjalankan tiap aksi pengguna sekali dan menyalin statistiknya
+ */
+static void ukur_amplifikasi(KonteksBench *k, HasilAmplifikasi *hasil) {
+    char id_baru[MAX_ID_LENGTH + 1] = "";
+    char error_msg[100];
+    const char *nama_pos = "BenchPos";
+
+    instrumen_reset();
+
+    /* Transaksi: tambah, ubah nominal, lalu hapus baris yang sama */
+    if (tambah_transaksi_dengan_id(k->target.tanggal, k->target.jenis, k->target.pos,
+                                   k->target.nominal, k->target.deskripsi, id_baru, error_msg)) {
+        ubah_transaksi(id_baru, NULL, -1, NULL, k->target.nominal + 1, NULL, error_msg);
+        hapus_transaksi(id_baru, error_msg);
+    }
+
+    /* Pos: tambah pos baru tanpa transaksi agar bisa dihapus lagi */
+    if (tambah_pos(nama_pos, 500000, BENCH_BULAN, error_msg)) {
+        PosAnggaran list[MAX_POS];
+        int count = muat_pos_bulan(list, MAX_POS, BENCH_BULAN);
+        for (int i = 0; i < count; i++) {
+            if (strcmp(list[i].nama, nama_pos) == 0) {
+                ubah_pos(list[i].no, NULL, 750000, BENCH_BULAN, error_msg);
+                hapus_pos(list[i].no, BENCH_BULAN, error_msg);
+                break;
+            }
+        }
+    }
+
+    /* Buka layar: muatan yang sama dengan layar transaksi, pos, dan analisis */
+    {
+        INSTRUMEN_AKSI(AKSI_BUKA_LAYAR);
+        SnapshotTransaksi snap_trx;
+        SnapshotPos snap_pos;
+        AnalisisKeuangan analisis;
+        if (ambil_snapshot_transaksi(&snap_trx, BENCH_BULAN)) {
+            bebaskan_snapshot_transaksi(&snap_trx);
+            INSTRUMEN_AKSI_SELESAI(AKSI_BUKA_LAYAR, 0);
+        }
+        if (ambil_snapshot_pos(&snap_pos, BENCH_BULAN)) INSTRUMEN_AKSI_SELESAI(AKSI_BUKA_LAYAR, 0);
+        if (hitung_analisis_bulan(BENCH_BULAN, &analisis)) INSTRUMEN_AKSI_SELESAI(AKSI_BUKA_LAYAR, 0);
+    }
+
+    hasil->baris = k->baris;
+    hasil->jumlah = instrumen_ambil_statistik_aksi(hasil->aksi);
+}
+
+/**
+ * Helper: Mencetak tabel amplifikasi semua skala
+ */
+static void cetak_amplifikasi(const HasilAmplifikasi *hasil, int jumlah_skala) {
+    printf("\n# amplifikasi per aksi; byte rata-rata per aksi, amp = byte fisik / byte logis\n");
+    printf("%-26s %8s %6s %10s %12s %12s %8s %10s %10s %10s\n",
+           "# aksi", "baris", "jumlah", "logis", "byte_baca", "byte_tulis", "fopen",
+           "baris_urai", "amp_tulis", "amp_total");
+
+    for (int s = 0; s < jumlah_skala; s++) {
+        for (int i = 0; i < hasil[s].jumlah; i++) {
+            const StatistikAksi *a = &hasil[s].aksi[i];
+            unsigned long long n = a->jumlah > 0 ? a->jumlah : 1;
+            printf("%-26s %8d %6llu %10llu %12llu %12llu %8llu %10llu %10.1f %10.1f\n",
+                   a->nama, hasil[s].baris, a->jumlah, a->byte_logis / n,
+                   a->penghitung[INS_BYTE_BACA] / n, a->penghitung[INS_BYTE_TULIS] / n,
+                   a->penghitung[INS_FOPEN] / n, a->penghitung[INS_BARIS_URAI] / n,
+                   instrumen_amplifikasi_aksi(a, 1), instrumen_amplifikasi_aksi(a, 0));
+        }
+    }
+}
+
+/**
+ * Helper: Menampilkan cara pakai
+ */
+static void tampilkan_bantuan(const char *program) {
+    fprintf(stderr,
+        "Penggunaan: %s [--maks N] [--ulang K] [--putaran R] [--thread T] [--simpan]\n"
+        "       [--baseline FILE [--toleransi P]]\n"
+        "  --maks N         Skala terbesar (10^3 .. N, kelipatan 10; default %d)\n"
+        "  --ulang K        Jumlah pengulangan per operasi (default otomatis)\n"
+        "  --putaran R      Kalikan jumlah sampel tiap operasi dengan R (default 1)\n"
+        "  --thread T       Thread kerja paralel (default 0 = jumlah core)\n"
+        "  --simpan         Jangan hapus direktori kerja sementara\n"
+        "  --baseline FILE  Bandingkan median dengan keluaran run sebelumnya;\n"
+        "                   kode keluar 1 jika ada operasi dilacak yang melambat\n"
+        "  --toleransi P    Batas perlambatan dalam persen (default %.0f)\n",
+        program, BENCH_MAKS_DEFAULT, BENCH_TOLERANSI);
+}
+
+/* ===== PROGRAM UTAMA ===== */
+
+int main(int argc, char *argv[]) {
+    int maks = BENCH_MAKS_DEFAULT;
+    int ulang_paksa = 0;
+    int putaran = 1;
+    int simpan = 0;
+    const char *path_baseline = NULL;
+    double toleransi = BENCH_TOLERANSI;
+    static HasilOperasi baseline[BENCH_MAKS_HASIL];
+    int jumlah_baseline = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--maks") == 0 && i + 1 < argc) {
+            maks = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ulang") == 0 && i + 1 < argc) {
+            ulang_paksa = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--putaran") == 0 && i + 1 < argc) {
+            putaran = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--simpan") == 0) {
+            simpan = 1;
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            path_baseline = argv[++i];
+        } else if (strcmp(argv[i], "--toleransi") == 0 && i + 1 < argc) {
+            toleransi = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--thread") == 0 && i + 1 < argc) {
+            kolam_atur_thread(atoi(argv[++i]));
+        } else {
+            tampilkan_bantuan(argv[0]);
+            return 2;
+        }
+    }
+    if (maks < 1000) maks = 1000;
+    if (putaran < 1) putaran = 1;
+
+    if (path_baseline) {
+        jumlah_baseline = muat_baseline(path_baseline, baseline, BENCH_MAKS_HASIL);
+        if (jumlah_baseline < 0) {
+            fprintf(stderr, "error: baseline %s tidak dapat dibaca\n", path_baseline);
+            return 1;
+        }
+    }
+
+    /* Semua file data ditulis di direktori sementara, bukan data/ milik pengguna */
+    char dir[] = "/tmp/keuangan_bench.XXXXXX";
+    if (!masuk_direktori_kerja(dir)) {
+        fprintf(stderr, "error: tidak dapat membuat direktori kerja\n");
+        return 1;
+    }
+
+    /* Ukur biaya membaca /proc/self/io agar tidak ikut dihitung sebagai I/O operasi */
+    StatistikIO io_a, io_b;
+    baca_statistik_io(&io_a);
+    baca_statistik_io(&io_b);
+    biaya_baca_io.syscall_baca = io_b.syscall_baca - io_a.syscall_baca;
+    biaya_baca_io.syscall_tulis = io_b.syscall_tulis - io_a.syscall_tulis;
+    biaya_baca_io.byte_baca = io_b.byte_baca - io_a.byte_baca;
+    biaya_baca_io.byte_tulis = io_b.byte_tulis - io_a.byte_tulis;
+
+    if (!siapkan_kalibrasi()) {
+        fprintf(stderr, "error: tidak dapat menulis file kalibrasi\n");
+        hapus_direktori_kerja(dir);
+        return 1;
+    }
+
+    printf("# keuangan-bench v%d\n", BENCH_VERSI);
+    printf("# waktu dalam mikrodetik; syscall dan byte rata-rata per pemanggilan\n");
+    printf("# thread: %d\n", kolam_ambil_thread());
+    printf("%-26s %8s %6s %12s %12s %14s %10s %10s %12s %12s %10s\n",
+           "# operasi", "baris", "ulang", "median_us", "p99_us", "baris_per_dtk",
+           "syscall_r", "syscall_w", "byte_r", "byte_w", "kal_us");
+
+    static HasilAmplifikasi amplifikasi[BENCH_MAKS_SKALA];
+    int jumlah_skala = 0;
+
+    int hasil = 0;
+    for (int baris = 1000; baris <= maks && jumlah_skala < BENCH_MAKS_SKALA; baris *= 10) {
+        KonteksBench k;
+        memset(&k, 0, sizeof(KonteksBench));
+        k.baris = baris;
+        k.putaran = putaran;
+        k.ulang = ulang_paksa > 0 ? ulang_paksa : BENCH_ULANG_MAKS * 1000 / baris;
+        if (k.ulang < BENCH_ULANG_MIN) k.ulang = BENCH_ULANG_MIN;
+        if (k.ulang > BENCH_ULANG_MAKS) k.ulang = BENCH_ULANG_MAKS;
+
+        k.buffer = malloc(sizeof(Transaksi) * baris);
+        if (!k.buffer || !siapkan_data(baris)) {
+            fprintf(stderr, "error: gagal menyiapkan %d baris\n", baris);
+            free(k.buffer);
+            hasil = 1;
+            break;
+        }
+
+        /* Target ubah: baris di tengah file */
+        char id_tengah[MAX_ID_LENGTH + 1];
+        format_id_transaksi(baris / 2, id_tengah, sizeof(id_tengah));
+        cari_transaksi_berdasarkan_id(id_tengah, &k.target);
+
+        int ulang_skala = k.ulang;
+        for (int i = 0; i < JUMLAH_OPERASI; i++) {
+            /* Operasi satu baris murah; ulang maksimal agar median stabil di semua skala */
+            k.ulang = (DAFTAR_OPERASI[i].satu_baris && ulang_paksa <= 0) ? BENCH_ULANG_MAKS : ulang_skala;
+            ukur_operasi(&k, DAFTAR_OPERASI[i].nama, DAFTAR_OPERASI[i].jalankan,
+                         DAFTAR_OPERASI[i].satu_baris);
+        }
+        k.ulang = ulang_skala;
+
+        ukur_amplifikasi(&k, &amplifikasi[jumlah_skala++]);
+
+        free(k.buffer);
+    }
+
+    cetak_amplifikasi(amplifikasi, jumlah_skala);
+
+    if (hasil == 0 && path_baseline) {
+        int regresi = banding_baseline(path_baseline, baseline, jumlah_baseline, toleransi);
+        if (regresi > 0) hasil = 1;
+        if (regresi > 0) fprintf(stderr, "perfcheck: %d operasi melambat lebih dari %.1f%%\n",
+                                 regresi, toleransi);
+    }
+
+    if (simpan) {
+        fprintf(stderr, "Direktori kerja disimpan: %s\n", dir);
+    } else {
+        hapus_direktori_kerja(dir);
+    }
+
+    return hasil;
+}
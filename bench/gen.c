@@ -0,0 +1,119 @@
+/*
+ * =============================================================================
+ * File        : gen.c
+ * Deskripsi   : Program pembangkit direktori data sintetis untuk uji beban
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Program baris perintah di atas modul generator: membaca opsi skala dan
+ * distribusi, lalu menulis data/transaksi.txt, data/pos_MM.txt, dan
+ * data/analisis_MM.txt di direktori tujuan.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, stdlib.h, string.h : Untuk I/O, konversi angka, dan string
+ * - unistd.h    : Untuk chdir ke direktori tujuan
+ * - generator.h : Untuk konfigurasi dan pembangkitan data
+ *
+ * CATATAN:
+ * File data yang sudah ada di direktori tujuan akan ditimpa.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "generator.h"
+
+/* ===== FUNGSI HELPER ===== */
+
+/**
+ * Helper: Menampilkan cara pakai
+ */
+static void tampilkan_bantuan(const char *program) {
+    KonfigurasiGenerator d;
+    konfigurasi_generator_default(&d);
+
+    fprintf(stderr,
+        "Penggunaan: %s [opsi]\n"
+        "  --dir DIR           Direktori tujuan, data ditulis ke DIR/data (default .)\n"
+        "  --baris N           Jumlah transaksi (default %ld)\n"
+        "  --tahun N           Jumlah tahun yang dicakup (default %d)\n"
+        "  --tahun-akhir Y     Tahun terakhir (default %d)\n"
+        "  --pos N             Jumlah pos anggaran per bulan, 1..50 (default %d)\n"
+        "  --pemasukan P       Persen transaksi pemasukan, 0..100 (default %d)\n"
+        "  --kemiringan K      0 = merata, makin besar makin condong, 0..8 (default %d)\n"
+        "  --nominal-min N     Nominal pengeluaran terkecil (default %llu)\n"
+        "  --nominal-maks N    Nominal pengeluaran terbesar (default %llu)\n"
+        "  --benih S           Benih generator acak (default %llu)\n",
+        program, d.baris, d.tahun, d.tahun_akhir, d.jumlah_pos, d.persen_pemasukan,
+        d.kemiringan, d.nominal_min, d.nominal_maks, d.benih);
+}
+
+/* ===== MAIN ===== */
+
+int main(int argc, char *argv[]) {
+    KonfigurasiGenerator cfg;
+    konfigurasi_generator_default(&cfg);
+    const char *dir = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *opsi = argv[i];
+        const char *nilai = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(opsi, "--help") == 0 || strcmp(opsi, "-h") == 0) {
+            tampilkan_bantuan(argv[0]);
+            return 0;
+        }
+        if (!nilai) {
+            fprintf(stderr, "error: opsi tidak dikenal atau tanpa nilai: %s\n", opsi);
+            tampilkan_bantuan(argv[0]);
+            return 2;
+        }
+
+        if (strcmp(opsi, "--dir") == 0) dir = nilai;
+        else if (strcmp(opsi, "--baris") == 0) cfg.baris = atol(nilai);
+        else if (strcmp(opsi, "--tahun") == 0) cfg.tahun = atoi(nilai);
+        else if (strcmp(opsi, "--tahun-akhir") == 0) cfg.tahun_akhir = atoi(nilai);
+        else if (strcmp(opsi, "--pos") == 0) cfg.jumlah_pos = atoi(nilai);
+        else if (strcmp(opsi, "--pemasukan") == 0) cfg.persen_pemasukan = atoi(nilai);
+        else if (strcmp(opsi, "--kemiringan") == 0) cfg.kemiringan = atoi(nilai);
+        else if (strcmp(opsi, "--nominal-min") == 0) cfg.nominal_min = strtoull(nilai, NULL, 10);
+        else if (strcmp(opsi, "--nominal-maks") == 0) cfg.nominal_maks = strtoull(nilai, NULL, 10);
+        else if (strcmp(opsi, "--benih") == 0) cfg.benih = strtoull(nilai, NULL, 0);
+        else {
+            fprintf(stderr, "error: opsi tidak dikenal: %s\n", opsi);
+            tampilkan_bantuan(argv[0]);
+            return 2;
+        }
+        i++;
+    }
+
+    const char *pesan = validasi_konfigurasi_generator(&cfg);
+    if (pesan) {
+        fprintf(stderr, "error: %s\n", pesan);
+        return 2;
+    }
+
+    if (dir && chdir(dir) != 0) {
+        fprintf(stderr, "error: tidak dapat masuk ke direktori %s\n", dir);
+        return 1;
+    }
+
+    HasilGenerator hasil;
+    if (!bangkitkan_ledger(&cfg, &hasil)) {
+        fprintf(stderr, "error: gagal menulis data\n");
+        return 1;
+    }
+
+    printf("baris\t%ld\n", hasil.baris);
+    printf("byte\t%lld\n", hasil.byte_ditulis);
+    for (int b = 1; b <= 12; b++) {
+        if (hasil.bulan_transaksi[b] > 0) printf("bulan_%02d\t%ld\n", b, hasil.bulan_transaksi[b]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,347 @@
+/*
+ * =============================================================================
+ * File        : generator.c
+ * Deskripsi   : Implementasi generator data ledger sintetis (deterministik)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan pembangkitan transaksi berurutan tanggal
+ * dalam satu lintasan. Selama transaksi ditulis, total per bulan dan
+ * realisasi per pos ikut diakumulasi sehingga pos_MM.txt dan analisis_MM.txt
+ * langsung ditulis di akhir tanpa membaca ulang file transaksi.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, string.h : Untuk penulisan file dan string
+ * - stdlib.h, unistd.h : Untuk mkdtemp, chdir, unlink, rmdir
+ * - sys/stat.h  : Untuk ukuran file yang ditulis dan mkdir
+ * - generator.h : Header file modul ini
+ * - file.h      : Untuk format_*_ke_string, simpan_pos_bulan, simpan_analisis_bulan
+ * - pos.h       : Untuk hitung_sisa_pos dan tentukan_status_pos
+ * - analisis.h  : Untuk isi_analisis_dari_ringkasan
+ * - utils.h     : Untuk tanggal dan salin_string_aman
+ *
+ * CATATAN:
+ * Distribusi condong memakai u^(kemiringan+1) dengan u seragam di [0,1):
+ * kemiringan 0 merata, makin besar makin banyak nominal kecil dan makin
+ * sering pos urutan awal dipakai (mirip belanja harian yang didominasi
+ * beberapa pos). Tidak memakai libm agar tidak menambah dependensi link.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "generator.h"
+#include "file.h"
+#include "pos.h"
+#include "analisis.h"
+#include "utils.h"
+
+/* ===== KONSTANTA LOKAL ===== */
+
+#define GEN_UKURAN_BUFFER       (1 << 16)   /* Buffer stdio file transaksi */
+#define GEN_BULAT_PENGELUARAN   500ULL      /* Pembulatan nominal pengeluaran */
+#define GEN_BULAT_PEMASUKAN     1000ULL     /* Pembulatan nominal pemasukan */
+#define GEN_BULAT_ANGGARAN      10000ULL    /* Pembulatan anggaran pos */
+
+static const char *const NAMA_POS_DASAR[] = {
+    "Makan", "Transport", "Kos", "Pulsa", "Buku", "Hiburan", "Kesehatan", "Lainnya",
+    "Listrik", "Air", "Internet", "Pakaian", "Olahraga", "Donasi", "Tabungan", "Kuliah"
+};
+#define JUMLAH_POS_DASAR ((int)(sizeof(NAMA_POS_DASAR) / sizeof(NAMA_POS_DASAR[0])))
+
+static const char *const SUMBER_PEMASUKAN[] = {
+    "Gaji", "Kiriman", "Beasiswa", "Freelance"
+};
+#define JUMLAH_SUMBER_PEMASUKAN ((int)(sizeof(SUMBER_PEMASUKAN) / sizeof(SUMBER_PEMASUKAN[0])))
+
+/* ===== STRUKTUR DATA LOKAL ===== */
+
+/**
+ * Struct akumulasi selama pembangkitan
+ */
+typedef struct {
+    RingkasanTransaksi ringkasan[13];               /* Total per bulan */
+    unsigned long long realisasi[13][MAX_POS];      /* Pengeluaran per bulan per pos */
+    int jumlah_trx[13][MAX_POS];                    /* Transaksi per bulan per pos */
+} AkumulasiGenerator;
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Generator acak deterministik (xorshift64)
+ */
+static unsigned long long acak(unsigned long long *benih) {
+    unsigned long long x = *benih;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *benih = x;
+    return x;
+}
+
+/**
+ * Helper: Bilangan seragam di [0,1)
+ */
+static double acak_seragam(unsigned long long *benih) {
+    return (double)(acak(benih) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * Helper: Bilangan di [0,1) yang condong ke 0 sesuai kemiringan
+ */
+static double acak_condong(unsigned long long *benih, int kemiringan) {
+    double u = acak_seragam(benih);
+    double hasil = u;
+    for (int i = 0; i < kemiringan; i++) hasil *= u;
+    return hasil;
+}
+
+/**
+ * Helper: Nama pos ke-i (nama dasar, lalu "Pos NN" jika melebihi daftar)
+ */
+static void nama_pos_generator(int i, char *buffer, int size) {
+    if (i < JUMLAH_POS_DASAR) {
+        salin_string_aman(buffer, NAMA_POS_DASAR[i], size);
+    } else {
+        snprintf(buffer, size, "Pos %02d", i + 1);
+    }
+}
+
+/**
+ * Helper: Maju satu hari pada tanggal (d, m, y)
+ */
+static void maju_satu_hari(int *d, int *m, int *y) {
+    if (++(*d) <= dapatkan_jumlah_hari_bulan(*m, *y)) return;
+    *d = 1;
+    if (++(*m) <= 12) return;
+    *m = 1;
+    (*y)++;
+}
+
+/**
+ * Helper: Jumlah hari dalam rentang tahun
+ */
+static long hitung_hari_rentang(int tahun_awal, int tahun_akhir) {
+    long total = 0;
+    for (int y = tahun_awal; y <= tahun_akhir; y++) {
+        total += cek_tahun_kabisat(y) ? 366 : 365;
+    }
+    return total;
+}
+
+/**
+ * Helper: Ukuran file, 0 jika tidak ada
+ */
+static long long ukuran_file(const char *filename) {
+    struct stat st;
+    return (stat(filename, &st) == 0) ? (long long)st.st_size : 0;
+}
+
+/**
+ * Helper: Menulis pos dan analisis semua bulan yang memiliki transaksi
+ */
+static int tulis_pos_dan_analisis(const KonfigurasiGenerator *cfg, const AkumulasiGenerator *akum,
+                                  unsigned long long *benih, HasilGenerator *hasil) {
+    PosAnggaran pos[MAX_POS];
+    char filename[MAX_PATH];
+
+    for (int b = BULAN_MIN; b <= BULAN_MAX; b++) {
+        if (hasil->bulan_transaksi[b] == 0) continue;
+
+        /* Anggaran 85%..125% dari realisasi: campuran pos aman dan tidak aman */
+        memset(pos, 0, sizeof(pos));
+        for (int i = 0; i < cfg->jumlah_pos; i++) {
+            pos[i].no = i + 1;
+            nama_pos_generator(i, pos[i].nama, sizeof(pos[i].nama));
+
+            unsigned long long anggaran = akum->realisasi[b][i] * (85 + acak(benih) % 41) / 100;
+            anggaran = (anggaran / GEN_BULAT_ANGGARAN + 1) * GEN_BULAT_ANGGARAN;
+
+            pos[i].nominal = anggaran;
+            pos[i].realisasi = akum->realisasi[b][i];
+            pos[i].jumlah_transaksi = akum->jumlah_trx[b][i];
+            pos[i].sisa = hitung_sisa_pos(pos[i].nominal, pos[i].realisasi);
+            pos[i].status = tentukan_status_pos(pos[i].sisa);
+        }
+        if (!simpan_pos_bulan(pos, cfg->jumlah_pos, b)) return 0;
+
+        AnalisisKeuangan analisis;
+        isi_analisis_dari_ringkasan(&akum->ringkasan[b], &analisis);
+        if (!simpan_analisis_bulan(b, &analisis)) return 0;
+
+        dapatkan_nama_file_bulan(FILE_POS_PREFIX, b, filename, sizeof(filename));
+        hasil->byte_ditulis += ukuran_file(filename);
+        dapatkan_nama_file_bulan(FILE_ANALISIS_PREFIX, b, filename, sizeof(filename));
+        hasil->byte_ditulis += ukuran_file(filename);
+    }
+
+    return 1;
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+/**
+ * Mengisi konfigurasi generator dengan nilai default
+ */
+void konfigurasi_generator_default(KonfigurasiGenerator *cfg) {
+    if (!cfg) return;
+
+    memset(cfg, 0, sizeof(KonfigurasiGenerator));
+    cfg->benih = GEN_BENIH_DEFAULT;
+    cfg->baris = 10000;
+    cfg->tahun = 1;
+    cfg->tahun_akhir = GEN_TAHUN_AKHIR_DEFAULT;
+    cfg->jumlah_pos = 8;
+    cfg->persen_pemasukan = 20;
+    cfg->kemiringan = 2;
+    cfg->nominal_min = 5000;
+    cfg->nominal_maks = 2000000;
+}
+
+/**
+ * Memeriksa konfigurasi generator
+ */
+const char* validasi_konfigurasi_generator(const KonfigurasiGenerator *cfg) {
+    if (!cfg) return "Konfigurasi kosong";
+    if (cfg->benih == 0) return "Benih tidak boleh 0";
+    if (cfg->baris < 0) return "Jumlah baris tidak boleh negatif";
+    if (cfg->baris > MAX_NOMOR_ID) return "Jumlah baris melebihi nomor ID maksimal";
+    if (cfg->tahun < 1) return "Jumlah tahun minimal 1";
+    if (!validasi_tahun(cfg->tahun_akhir) || !validasi_tahun(cfg->tahun_akhir - cfg->tahun + 1)) {
+        return "Rentang tahun tidak valid";
+    }
+    if (cfg->jumlah_pos < 1 || cfg->jumlah_pos > MAX_POS) return "Jumlah pos harus 1..50";
+    if (cfg->persen_pemasukan < 0 || cfg->persen_pemasukan > 100) return "Persen pemasukan harus 0..100";
+    if (cfg->kemiringan < 0 || cfg->kemiringan > GEN_KEMIRINGAN_MAKS) return "Kemiringan harus 0..8";
+    if (cfg->nominal_min == 0 || cfg->nominal_min > cfg->nominal_maks) return "Rentang nominal tidak valid";
+    return NULL;
+}
+
+/**
+ * Membangkitkan transaksi, pos, dan analisis ke direktori data
+ */
+int bangkitkan_ledger(const KonfigurasiGenerator *cfg, HasilGenerator *hasil) {
+    HasilGenerator lokal;
+    if (!hasil) hasil = &lokal;
+    memset(hasil, 0, sizeof(HasilGenerator));
+
+    if (validasi_konfigurasi_generator(cfg) != NULL) return 0;
+
+    static AkumulasiGenerator akum;
+    memset(&akum, 0, sizeof(akum));
+    unsigned long long benih = cfg->benih;
+
+    pastikan_direktori_data();
+    char filename[MAX_PATH];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+
+    FILE *fp = fopen(filename, "w");
+    if (!fp) return 0;
+    static char buffer_file[GEN_UKURAN_BUFFER];
+    setvbuf(fp, buffer_file, _IOFBF, sizeof(buffer_file));
+
+    /* Transaksi tersebar rata di rentang tanggal, berurutan seperti ledger asli */
+    int d = 1, m = 1, y = cfg->tahun_akhir - cfg->tahun + 1;
+    long hari_total = hitung_hari_rentang(y, cfg->tahun_akhir);
+    long hari_ke = 0;
+
+    char line[MAX_LINE_LENGTH];
+    Transaksi trx;
+    unsigned long long rentang = cfg->nominal_maks - cfg->nominal_min;
+    int ok = 1;
+
+    for (long i = 0; i < cfg->baris; i++) {
+        long target = (long)((double)i * hari_total / cfg->baris);
+        while (hari_ke < target) {
+            maju_satu_hari(&d, &m, &y);
+            hari_ke++;
+        }
+
+        memset(&trx, 0, sizeof(Transaksi));
+        if (!format_id_transaksi((int)(i + 1), trx.id, sizeof(trx.id))) {
+            ok = 0;
+            break;
+        }
+        format_tanggal(d, m, y, trx.tanggal);
+
+        int idx_pos = -1;
+        if ((int)(acak(&benih) % 100) < cfg->persen_pemasukan) {
+            trx.jenis = JENIS_PEMASUKAN;
+            const char *sumber = SUMBER_PEMASUKAN[acak(&benih) % JUMLAH_SUMBER_PEMASUKAN];
+            salin_string_aman(trx.pos, sumber, sizeof(trx.pos));
+            /* Pemasukan seragam di [maks/2, maks*2] */
+            unsigned long long n = cfg->nominal_maks / 2
+                                 + (unsigned long long)(acak_seragam(&benih) * cfg->nominal_maks * 1.5);
+            trx.nominal = (n / GEN_BULAT_PEMASUKAN + 1) * GEN_BULAT_PEMASUKAN;
+            snprintf(trx.deskripsi, sizeof(trx.deskripsi), "%s %02d-%04d", sumber, m, y);
+        } else {
+            trx.jenis = JENIS_PENGELUARAN;
+            idx_pos = (int)(acak_condong(&benih, cfg->kemiringan) * cfg->jumlah_pos);
+            nama_pos_generator(idx_pos, trx.pos, sizeof(trx.pos));
+            unsigned long long n = cfg->nominal_min
+                                 + (unsigned long long)(acak_condong(&benih, cfg->kemiringan) * rentang);
+            n -= n % GEN_BULAT_PENGELUARAN;
+            trx.nominal = (n < cfg->nominal_min) ? cfg->nominal_min : n;
+            snprintf(trx.deskripsi, sizeof(trx.deskripsi), "Belanja %s #%ld", trx.pos, i + 1);
+        }
+
+        format_transaksi_ke_string(&trx, line, sizeof(line));
+        if (fputs(line, fp) == EOF || fputc('\n', fp) == EOF) {
+            ok = 0;
+            break;
+        }
+
+        RingkasanTransaksi *r = &akum.ringkasan[m];
+        if (trx.jenis == JENIS_PEMASUKAN) {
+            r->total_pemasukan += trx.nominal;
+            r->jumlah_pemasukan++;
+        } else {
+            r->total_pengeluaran += trx.nominal;
+            r->jumlah_pengeluaran++;
+            akum.realisasi[m][idx_pos] += trx.nominal;
+            akum.jumlah_trx[m][idx_pos]++;
+        }
+        hasil->bulan_transaksi[m]++;
+        hasil->baris++;
+    }
+
+    if (fclose(fp) != 0) ok = 0;
+    if (!ok) return 0;
+    hasil->byte_ditulis += ukuran_file(filename);
+
+    return tulis_pos_dan_analisis(cfg, &akum, &benih, hasil);
+}
+
+/**
+ * Membuat direktori kerja sementara dan berpindah ke sana
+ */
+int masuk_direktori_kerja(char *dir) {
+    if (!dir || !mkdtemp(dir)) return 0;
+    if (chdir(dir) != 0) return 0;
+    return mkdir(DATA_DIR, 0755) == 0;
+}
+
+/**
+ * Menghapus file data dan direktori kerja sementara
+ */
+void hapus_direktori_kerja(const char *dir) {
+    char filename[MAX_PATH];
+
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+    unlink(filename);
+    for (int b = BULAN_MIN; b <= BULAN_MAX; b++) {
+        dapatkan_nama_file_bulan(FILE_POS_PREFIX, b, filename, sizeof(filename));
+        unlink(filename);
+        dapatkan_nama_file_bulan(FILE_ANALISIS_PREFIX, b, filename, sizeof(filename));
+        unlink(filename);
+    }
+    rmdir(DATA_DIR);
+
+    if (chdir("/") == 0) rmdir(dir);
+}
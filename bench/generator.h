@@ -0,0 +1,102 @@
+/*
+ * =============================================================================
+ * File        : generator.h
+ * Deskripsi   : Header file untuk generator data ledger sintetis (deterministik)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini membangkitkan direktori data/ lengkap untuk uji beban dan
+ * benchmark tanpa memakai data keuangan asli, termasuk:
+ * - transaksi.txt dengan jumlah baris, rentang tahun, dan campuran
+ *   pemasukan/pengeluaran yang dapat diatur
+ * - pos_MM.txt dengan anggaran dan realisasi yang konsisten dengan transaksi
+ * - analisis_MM.txt hasil perhitungan yang sama dengan aplikasi
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - file.h      : Untuk format_*_ke_string dan nama file data
+ * - pos.h       : Untuk struct PosAnggaran dan status pos
+ * - analisis.h  : Untuk struct AnalisisKeuangan dan perhitungan analisis
+ *
+ * CATATAN:
+ * Benih yang sama dengan konfigurasi yang sama selalu menghasilkan file yang
+ * identik byte demi byte. Semua baris ditulis melalui format_*_ke_string
+ * sehingga formatnya persis seperti yang ditulis aplikasi.
+ * =============================================================================
+ */
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+/* ===== KONSTANTA ===== */
+
+#define GEN_BENIH_DEFAULT       0x2545F4914F6CDD1DULL
+#define GEN_TAHUN_AKHIR_DEFAULT 2026
+#define GEN_KEMIRINGAN_MAKS     8       /* Batas eksponen distribusi */
+
+/* ===== STRUKTUR DATA ===== */
+
+/**
+ * Struct konfigurasi generator
+ */
+typedef struct {
+    unsigned long long benih;           /* Benih generator acak (bukan 0) */
+    long baris;                         /* Jumlah transaksi */
+    int tahun;                          /* Jumlah tahun yang dicakup */
+    int tahun_akhir;                    /* Tahun terakhir dalam rentang */
+    int jumlah_pos;                     /* Jumlah pos anggaran per bulan (1..MAX_POS) */
+    int persen_pemasukan;               /* Porsi transaksi pemasukan (0..100) */
+    int kemiringan;                     /* 0 = merata; makin besar makin condong ke nominal kecil dan pos awal */
+    unsigned long long nominal_min;     /* Nominal pengeluaran terkecil */
+    unsigned long long nominal_maks;    /* Nominal pengeluaran terbesar */
+} KonfigurasiGenerator;
+
+/**
+ * Struct ringkasan hasil generator
+ */
+typedef struct {
+    long baris;                         /* Jumlah transaksi yang ditulis */
+    long bulan_transaksi[13];           /* Jumlah transaksi per bulan [1-12] */
+    long long byte_ditulis;             /* Total ukuran file yang ditulis */
+} HasilGenerator;
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Procedure bertujuan untuk mengisi konfigurasi generator dengan nilai default.
+    I. S. : cfg belum terisi
+    F. S. : cfg berisi 10000 baris, 1 tahun, 8 pos, 20% pemasukan, kemiringan 2.
+*/
+void konfigurasi_generator_default(KonfigurasiGenerator *cfg);
+
+/*
+    Function bertujuan untuk memeriksa konfigurasi generator.
+    Input : cfg (Konfigurasi)
+    Output : Mengembalikan NULL jika valid, atau pesan kesalahan.
+*/
+const char* validasi_konfigurasi_generator(const KonfigurasiGenerator *cfg);
+
+/*
+    Function bertujuan untuk membangkitkan transaksi, pos, dan analisis ke direktori data.
+    Input : cfg (Konfigurasi)
+    Output : hasil (Ringkasan, boleh NULL). Mengembalikan 1 jika semua file berhasil ditulis, 0 jika gagal.
+*/
+int bangkitkan_ledger(const KonfigurasiGenerator *cfg, HasilGenerator *hasil);
+
+/*
+    Function bertujuan untuk membuat direktori kerja sementara dan berpindah ke sana.
+    Input : dir (Template mkdtemp, misal "/tmp/x.XXXXXX"; diisi nama sebenarnya)
+    Output : Mengembalikan 1 jika direktori dan subdirektori data siap, 0 jika gagal.
+*/
+int masuk_direktori_kerja(char *dir);
+
+/*
+    Procedure bertujuan untuk menghapus file data dan direktori kerja sementara.
+    I. S. : Direktori kerja aktif berisi data/ hasil generator
+    F. S. : File data, data/, dan dir terhapus; direktori aktif pindah ke /.
+*/
+void hapus_direktori_kerja(const char *dir);
+
+#endif
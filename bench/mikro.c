@@ -0,0 +1,569 @@
+/*
+ * =============================================================================
+ * File        : mikro.c
+ * Deskripsi   : Microbenchmark parser dan formatter (ns/op dan alokasi/op)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Program ini mengukur fungsi yang dilewati setiap baris saat memuat,
+ * menyimpan, dan menampilkan data, termasuk:
+ * - urai_baris_transaksi, urai_baris_pos, urai_baris_analisis
+ * - format_transaksi_ke_string, format_pos_ke_string, format_analisis_ke_string
+ * - format_angka_pemisah, format_rupiah, format_saldo
+ * Mode --banding juga menjalankan implementasi referensi (referensi.c) pada
+ * input yang sama, menampilkan percepatannya, dan memeriksa hasilnya sama.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, stdlib.h, string.h : Untuk I/O, alokasi, dan string
+ * - time.h      : Untuk clock_gettime (CLOCK_MONOTONIC)
+ * - file.h      : Untuk fungsi parser dan formatter yang diukur
+ * - utils.h     : Untuk format_angka_pemisah, format_rupiah, format_saldo
+ * - generator.h : Untuk input representatif dari ledger sintetis
+ * - referensi.h : Untuk implementasi pembanding
+ *
+ * CATATAN:
+ * Alokasi dihitung dengan membungkus malloc/calloc/realloc saat link
+ * (-Wl,--wrap), sehingga yang terhitung hanya alokasi dari kode aplikasi,
+ * bukan alokasi internal libc. ns_op adalah median beberapa putaran dan
+ * sudah termasuk biaya kecil pemilihan sampel yang sama untuk kedua sisi.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "file.h"
+#include "utils.h"
+#include "generator.h"
+#include "referensi.h"
+
+/* ===== KONSTANTA ===== */
+
+#define MIKRO_VERSI             1           /* Versi format keluaran */
+#define MIKRO_ITERASI_DEFAULT   1000000     /* Pemanggilan per fungsi */
+#define MIKRO_PUTARAN           7           /* Putaran pengukuran (diambil median) */
+#define MIKRO_SAMPEL_TRX        4096        /* Sampel baris transaksi */
+#define MIKRO_SAMPEL_POS        (12 * 20)   /* Sampel baris pos (12 bulan x 20 pos) */
+#define MIKRO_BARIS_LEDGER      20000       /* Ukuran ledger sumber sampel */
+
+/* ===== STRUKTUR DATA ===== */
+
+/**
+ * Struct kumpulan input representatif
+ */
+typedef struct {
+    char baris_trx[MIKRO_SAMPEL_TRX][MAX_LINE_LENGTH];
+    Transaksi trx[MIKRO_SAMPEL_TRX];
+    int n_trx;
+
+    char baris_pos[MIKRO_SAMPEL_POS][MAX_LINE_LENGTH];
+    PosAnggaran pos[MIKRO_SAMPEL_POS];
+    int n_pos;
+
+    char baris_analisis[12][MAX_LINE_LENGTH];
+    AnalisisKeuangan analisis[12];
+    int n_analisis;
+
+    long long saldo[MIKRO_SAMPEL_TRX];      /* Campuran saldo positif dan negatif */
+} SampelMikro;
+
+/**
+ * Callback satu pemanggilan fungsi yang diukur; nilai kembali mencegah
+ * kompilator membuang pemanggilan
+ */
+typedef unsigned long long (*OperasiMikro)(int i);
+
+/**
+ * Callback pemeriksaan kesamaan hasil implementasi baru dan referensi
+ */
+typedef int (*CekMikro)(void);
+
+/* ===== VARIABEL GLOBAL LOKAL ===== */
+
+static SampelMikro sampel;
+static unsigned long long jumlah_alokasi = 0;
+static volatile unsigned long long penampung = 0;
+
+/* ===== PENGHITUNG ALOKASI (-Wl,--wrap) ===== */
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    jumlah_alokasi++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    jumlah_alokasi++;
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    jumlah_alokasi++;
+    return __real_realloc(ptr, size);
+}
+
+/* ===== FUNGSI HELPER ===== */
+
+/**
+ * Helper: Waktu monotonic dalam nanodetik
+ */
+static double waktu_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * Helper: Pembanding double untuk qsort
+ */
+static int banding_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Helper: Membandingkan double dengan toleransi relatif kecil
+ */
+static int double_sama(double a, double b) {
+    double selisih = a > b ? a - b : b - a;
+    double skala = a < 0 ? -a : a;
+    if (skala < 1.0) skala = 1.0;
+    return selisih <= 1e-9 * skala;
+}
+
+/**
+ * Helper: Membaca baris file ke array sampel, mengambil tiap baris ke-langkah
+ */
+static int baca_baris(const char *filename, char (*tujuan)[MAX_LINE_LENGTH], int maks, int langkah) {
+    FILE *fp = fopen(filename, "r");
+    if (!fp) return 0;
+
+    char line[MAX_LINE_LENGTH];
+    int n = 0, nomor = 0;
+    while (n < maks && fgets(line, sizeof(line), fp)) {
+        if (nomor++ % langkah != 0) continue;
+        hapus_newline_string(line);
+        salin_string_aman(tujuan[n++], line, MAX_LINE_LENGTH);
+    }
+    fclose(fp);
+
+    return n;
+}
+
+/**
+ * Helper: Membangkitkan ledger sintetis dan mengambil sampel input darinya
+ */
+static int siapkan_sampel(void) {
+    char dir[] = "/tmp/keuangan_mikro.XXXXXX";
+    if (!masuk_direktori_kerja(dir)) return 0;
+
+    KonfigurasiGenerator cfg;
+    konfigurasi_generator_default(&cfg);
+    cfg.baris = MIKRO_BARIS_LEDGER;
+    cfg.jumlah_pos = 20;
+
+    int ok = bangkitkan_ledger(&cfg, NULL);
+    char filename[MAX_PATH];
+
+    if (ok) {
+        dapatkan_nama_file_transaksi(filename, sizeof(filename));
+        sampel.n_trx = baca_baris(filename, sampel.baris_trx, MIKRO_SAMPEL_TRX,
+                                  MIKRO_BARIS_LEDGER / MIKRO_SAMPEL_TRX);
+
+        for (int b = BULAN_MIN; b <= BULAN_MAX; b++) {
+            dapatkan_nama_file_bulan(FILE_POS_PREFIX, b, filename, sizeof(filename));
+            sampel.n_pos += baca_baris(filename, sampel.baris_pos + sampel.n_pos,
+                                       MIKRO_SAMPEL_POS - sampel.n_pos, 1);
+            dapatkan_nama_file_bulan(FILE_ANALISIS_PREFIX, b, filename, sizeof(filename));
+            sampel.n_analisis += baca_baris(filename, sampel.baris_analisis + sampel.n_analisis, 1, 1);
+        }
+    }
+
+    hapus_direktori_kerja(dir);
+    if (!ok || sampel.n_trx == 0 || sampel.n_pos == 0 || sampel.n_analisis == 0) return 0;
+
+    /* Struct sumber untuk formatter diambil dari hasil parser */
+    for (int i = 0; i < sampel.n_trx; i++) {
+        urai_baris_transaksi(sampel.baris_trx[i], &sampel.trx[i]);
+        long long n = (long long)sampel.trx[i].nominal;
+        sampel.saldo[i] = (i % 3 == 0) ? -n : n * (i % 7 + 1);
+    }
+    for (int i = 0; i < sampel.n_pos; i++) {
+        memset(&sampel.pos[i], 0, sizeof(PosAnggaran));
+        urai_baris_pos(sampel.baris_pos[i], &sampel.pos[i]);
+    }
+    for (int i = 0; i < sampel.n_analisis; i++) {
+        memset(&sampel.analisis[i], 0, sizeof(AnalisisKeuangan));
+        urai_baris_analisis(sampel.baris_analisis[i], &sampel.analisis[i]);
+    }
+
+    return 1;
+}
+
+/* ===== OPERASI YANG DIUKUR ===== */
+
+/*
+ * op_* memanggil implementasi di src/, opref_* memanggil salinan referensi.
+ * Sampel dipilih bergilir (i modulo jumlah sampel) agar input bervariasi.
+ */
+
+static unsigned long long op_urai_transaksi(int i) {
+    Transaksi t;
+    urai_baris_transaksi(sampel.baris_trx[i % sampel.n_trx], &t);
+    return t.nominal;
+}
+
+static unsigned long long opref_urai_transaksi(int i) {
+    Transaksi t;
+    ref_urai_baris_transaksi(sampel.baris_trx[i % sampel.n_trx], &t);
+    return t.nominal;
+}
+
+static unsigned long long op_urai_pos(int i) {
+    PosAnggaran p;
+    urai_baris_pos(sampel.baris_pos[i % sampel.n_pos], &p);
+    return p.realisasi;
+}
+
+static unsigned long long opref_urai_pos(int i) {
+    PosAnggaran p;
+    ref_urai_baris_pos(sampel.baris_pos[i % sampel.n_pos], &p);
+    return p.realisasi;
+}
+
+static unsigned long long op_urai_analisis(int i) {
+    AnalisisKeuangan a;
+    urai_baris_analisis(sampel.baris_analisis[i % sampel.n_analisis], &a);
+    return a.total_pengeluaran;
+}
+
+static unsigned long long opref_urai_analisis(int i) {
+    AnalisisKeuangan a;
+    ref_urai_baris_analisis(sampel.baris_analisis[i % sampel.n_analisis], &a);
+    return a.total_pengeluaran;
+}
+
+static unsigned long long op_format_transaksi(int i) {
+    char buf[MAX_LINE_LENGTH];
+    format_transaksi_ke_string(&sampel.trx[i % sampel.n_trx], buf, sizeof(buf));
+    return (unsigned char)buf[0];
+}
+
+static unsigned long long opref_format_transaksi(int i) {
+    char buf[MAX_LINE_LENGTH];
+    ref_format_transaksi_ke_string(&sampel.trx[i % sampel.n_trx], buf, sizeof(buf));
+    return (unsigned char)buf[0];
+}
+
+static unsigned long long op_format_pos(int i) {
+    char buf[MAX_LINE_LENGTH];
+    format_pos_ke_string(&sampel.pos[i % sampel.n_pos], buf, sizeof(buf));
+    return (unsigned char)buf[0];
+}
+
+static unsigned long long opref_format_pos(int i) {
+    char buf[MAX_LINE_LENGTH];
+    ref_format_pos_ke_string(&sampel.pos[i % sampel.n_pos], buf, sizeof(buf));
+    return (unsigned char)buf[0];
+}
+
+static unsigned long long op_format_analisis(int i) {
+    char buf[MAX_LINE_LENGTH];
+    format_analisis_ke_string(&sampel.analisis[i % sampel.n_analisis], buf, sizeof(buf));
+    return (unsigned char)buf[0];
+}
+
+static unsigned long long opref_format_analisis(int i) {
+    char buf[MAX_LINE_LENGTH];
+    ref_format_analisis_ke_string(&sampel.analisis[i % sampel.n_analisis], buf, sizeof(buf));
+    return (unsigned char)buf[0];
+}
+
+static unsigned long long op_format_angka(int i) {
+    char buf[32];
+    format_angka_pemisah(sampel.trx[i % sampel.n_trx].nominal, buf);
+    return (unsigned char)buf[0];
+}
+
+static unsigned long long opref_format_angka(int i) {
+    char buf[32];
+    ref_format_angka_pemisah(sampel.trx[i % sampel.n_trx].nominal, buf);
+    return (unsigned char)buf[0];
+}
+
+static unsigned long long op_format_rupiah(int i) {
+    char buf[40];
+    format_rupiah(sampel.trx[i % sampel.n_trx].nominal, buf);
+    return (unsigned char)buf[3];
+}
+
+static unsigned long long opref_format_rupiah(int i) {
+    char buf[40];
+    ref_format_rupiah(sampel.trx[i % sampel.n_trx].nominal, buf);
+    return (unsigned char)buf[3];
+}
+
+static unsigned long long op_format_saldo(int i) {
+    char buf[40];
+    format_saldo(sampel.saldo[i % sampel.n_trx], buf);
+    return (unsigned char)buf[0];
+}
+
+static unsigned long long opref_format_saldo(int i) {
+    char buf[40];
+    ref_format_saldo(sampel.saldo[i % sampel.n_trx], buf);
+    return (unsigned char)buf[0];
+}
+
+/* ===== PEMERIKSAAN KESAMAAN HASIL ===== */
+
+/*
+ * cek_* menjalankan kedua implementasi pada semua sampel (ditambah nilai
+ * tepi untuk formatter angka) dan mengembalikan 1 jika hasilnya sama.
+ */
+
+static int cek_urai_transaksi(void) {
+    for (int i = 0; i < sampel.n_trx; i++) {
+        Transaksi a, b;
+        memset(&a, 0, sizeof(a));
+        memset(&b, 0, sizeof(b));
+        if (urai_baris_transaksi(sampel.baris_trx[i], &a) !=
+            ref_urai_baris_transaksi(sampel.baris_trx[i], &b)) return 0;
+        if (strcmp(a.id, b.id) || strcmp(a.tanggal, b.tanggal) || a.jenis != b.jenis ||
+            strcmp(a.pos, b.pos) || a.nominal != b.nominal || strcmp(a.deskripsi, b.deskripsi)) return 0;
+    }
+    return 1;
+}
+
+static int cek_urai_pos(void) {
+    for (int i = 0; i < sampel.n_pos; i++) {
+        PosAnggaran a, b;
+        memset(&a, 0, sizeof(a));
+        memset(&b, 0, sizeof(b));
+        if (urai_baris_pos(sampel.baris_pos[i], &a) != ref_urai_baris_pos(sampel.baris_pos[i], &b)) return 0;
+        if (a.no != b.no || strcmp(a.nama, b.nama) || a.nominal != b.nominal ||
+            a.realisasi != b.realisasi || a.sisa != b.sisa ||
+            a.jumlah_transaksi != b.jumlah_transaksi || a.status != b.status) return 0;
+    }
+    return 1;
+}
+
+static int cek_urai_analisis(void) {
+    for (int i = 0; i < sampel.n_analisis; i++) {
+        AnalisisKeuangan a, b;
+        memset(&a, 0, sizeof(a));
+        memset(&b, 0, sizeof(b));
+        if (urai_baris_analisis(sampel.baris_analisis[i], &a) !=
+            ref_urai_baris_analisis(sampel.baris_analisis[i], &b)) return 0;
+        if (a.total_pemasukan != b.total_pemasukan || a.total_pengeluaran != b.total_pengeluaran ||
+            !double_sama(a.rata_rata_pengeluaran, b.rata_rata_pengeluaran) ||
+            !double_sama(a.persentase_sisa, b.persentase_sisa) || a.saldo_akhir != b.saldo_akhir ||
+            a.kondisi_keuangan != b.kondisi_keuangan || a.kesimpulan != b.kesimpulan ||
+            a.total_trx_pengeluaran != b.total_trx_pengeluaran ||
+            a.total_trx_pemasukan != b.total_trx_pemasukan) return 0;
+    }
+    return 1;
+}
+
+static int cek_format_transaksi(void) {
+    char a[MAX_LINE_LENGTH], b[MAX_LINE_LENGTH];
+    for (int i = 0; i < sampel.n_trx; i++) {
+        format_transaksi_ke_string(&sampel.trx[i], a, sizeof(a));
+        ref_format_transaksi_ke_string(&sampel.trx[i], b, sizeof(b));
+        if (strcmp(a, b) != 0) return 0;
+    }
+    return 1;
+}
+
+static int cek_format_pos(void) {
+    char a[MAX_LINE_LENGTH], b[MAX_LINE_LENGTH];
+    for (int i = 0; i < sampel.n_pos; i++) {
+        format_pos_ke_string(&sampel.pos[i], a, sizeof(a));
+        ref_format_pos_ke_string(&sampel.pos[i], b, sizeof(b));
+        if (strcmp(a, b) != 0) return 0;
+    }
+    return 1;
+}
+
+static int cek_format_analisis(void) {
+    char a[MAX_LINE_LENGTH], b[MAX_LINE_LENGTH];
+    for (int i = 0; i < sampel.n_analisis; i++) {
+        format_analisis_ke_string(&sampel.analisis[i], a, sizeof(a));
+        ref_format_analisis_ke_string(&sampel.analisis[i], b, sizeof(b));
+        if (strcmp(a, b) != 0) return 0;
+    }
+    return 1;
+}
+
+static int cek_format_angka(void) {
+    static const unsigned long long tepi[] = { 0, 1, 999, 1000, 999999, 1000000, 18446744073709551615ULL };
+    char a[32], b[32];
+    for (int i = 0; i < (int)(sizeof(tepi) / sizeof(tepi[0])); i++) {
+        format_angka_pemisah(tepi[i], a);
+        ref_format_angka_pemisah(tepi[i], b);
+        if (strcmp(a, b) != 0) return 0;
+    }
+    for (int i = 0; i < sampel.n_trx; i++) {
+        format_angka_pemisah(sampel.trx[i].nominal, a);
+        ref_format_angka_pemisah(sampel.trx[i].nominal, b);
+        if (strcmp(a, b) != 0) return 0;
+    }
+    return 1;
+}
+
+static int cek_format_rupiah(void) {
+    char a[40], b[40];
+    for (int i = 0; i < sampel.n_trx; i++) {
+        format_rupiah(sampel.trx[i].nominal, a);
+        ref_format_rupiah(sampel.trx[i].nominal, b);
+        if (strcmp(a, b) != 0) return 0;
+    }
+    return 1;
+}
+
+static int cek_format_saldo(void) {
+    static const long long tepi[] = { 0, -1, 1, -1000, 9223372036854775807LL, -9223372036854775807LL };
+    char a[40], b[40];
+    for (int i = 0; i < (int)(sizeof(tepi) / sizeof(tepi[0])); i++) {
+        format_saldo(tepi[i], a);
+        ref_format_saldo(tepi[i], b);
+        if (strcmp(a, b) != 0) return 0;
+    }
+    for (int i = 0; i < sampel.n_trx; i++) {
+        format_saldo(sampel.saldo[i], a);
+        ref_format_saldo(sampel.saldo[i], b);
+        if (strcmp(a, b) != 0) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Daftar fungsi yang diukur
+ */
+static const struct {
+    const char *nama;
+    OperasiMikro baru;
+    OperasiMikro referensi;
+    CekMikro cek;
+} DAFTAR_MIKRO[] = {
+    { "urai_baris_transaksi",       op_urai_transaksi,   opref_urai_transaksi,   cek_urai_transaksi },
+    { "urai_baris_pos",             op_urai_pos,         opref_urai_pos,         cek_urai_pos },
+    { "urai_baris_analisis",        op_urai_analisis,    opref_urai_analisis,    cek_urai_analisis },
+    { "format_transaksi_ke_string", op_format_transaksi, opref_format_transaksi, cek_format_transaksi },
+    { "format_pos_ke_string",       op_format_pos,       opref_format_pos,       cek_format_pos },
+    { "format_analisis_ke_string",  op_format_analisis,  opref_format_analisis,  cek_format_analisis },
+    { "format_angka_pemisah",       op_format_angka,     opref_format_angka,     cek_format_angka },
+    { "format_rupiah",              op_format_rupiah,    opref_format_rupiah,    cek_format_rupiah },
+    { "format_saldo",               op_format_saldo,     opref_format_saldo,     cek_format_saldo },
+};
+
+#define JUMLAH_MIKRO ((int)(sizeof(DAFTAR_MIKRO) / sizeof(DAFTAR_MIKRO[0])))
+
+/* ===== PENGUKURAN ===== */
+
+/**
+ * Helper: Mengukur satu operasi, mengisi median ns/op dan alokasi/op
+ */
+static void ukur(OperasiMikro op, long iterasi, double *ns_op, double *alok_op) {
+    long per_putaran = iterasi / MIKRO_PUTARAN;
+    if (per_putaran < 1) per_putaran = 1;
+
+    double waktu[MIKRO_PUTARAN];
+    unsigned long long jumlah = 0;
+
+    /* Pemanasan: cache dan branch predictor */
+    for (long i = 0; i < per_putaran; i++) jumlah += op((int)i);
+
+    unsigned long long alok_awal = jumlah_alokasi;
+    for (int r = 0; r < MIKRO_PUTARAN; r++) {
+        double mulai = waktu_ns();
+        for (long i = 0; i < per_putaran; i++) jumlah += op((int)i);
+        waktu[r] = (waktu_ns() - mulai) / per_putaran;
+    }
+    unsigned long long alok_akhir = jumlah_alokasi;
+
+    penampung += jumlah;
+    qsort(waktu, MIKRO_PUTARAN, sizeof(double), banding_double);
+    *ns_op = waktu[MIKRO_PUTARAN / 2];
+    *alok_op = (double)(alok_akhir - alok_awal) / ((double)per_putaran * MIKRO_PUTARAN);
+}
+
+/**
+ * Helper: Menampilkan cara pakai
+ */
+static void tampilkan_bantuan(const char *program) {
+    fprintf(stderr,
+        "Penggunaan: %s [--iterasi N] [--banding] [--filter TEKS]\n"
+        "  --iterasi N    Pemanggilan per fungsi (default %d)\n"
+        "  --banding      Bandingkan dengan implementasi referensi (bench/referensi.c)\n"
+        "  --filter TEKS  Hanya ukur fungsi yang namanya mengandung TEKS\n",
+        program, MIKRO_ITERASI_DEFAULT);
+}
+
+/* ===== MAIN ===== */
+
+int main(int argc, char *argv[]) {
+    long iterasi = MIKRO_ITERASI_DEFAULT;
+    int banding = 0;
+    const char *filter = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iterasi") == 0 && i + 1 < argc) {
+            iterasi = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--banding") == 0) {
+            banding = 1;
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else {
+            tampilkan_bantuan(argv[0]);
+            return 2;
+        }
+    }
+    if (iterasi < MIKRO_PUTARAN) iterasi = MIKRO_PUTARAN;
+
+    if (!siapkan_sampel()) {
+        fprintf(stderr, "error: gagal menyiapkan sampel input\n");
+        return 1;
+    }
+
+    printf("# keuangan-mikro v%d\n", MIKRO_VERSI);
+    printf("# sampel: %d transaksi, %d pos, %d analisis; median %d putaran, %ld pemanggilan\n",
+           sampel.n_trx, sampel.n_pos, sampel.n_analisis, MIKRO_PUTARAN, iterasi);
+    if (banding) {
+        printf("%-28s %10s %9s %10s %9s %10s %5s\n",
+               "# fungsi", "ns_op", "alok_op", "ref_ns_op", "ref_alok", "percepatan", "sama");
+    } else {
+        printf("%-28s %10s %9s\n", "# fungsi", "ns_op", "alok_op");
+    }
+
+    int semua_sama = 1;
+    for (int i = 0; i < JUMLAH_MIKRO; i++) {
+        if (filter && !strstr(DAFTAR_MIKRO[i].nama, filter)) continue;
+
+        double ns_op, alok_op;
+        ukur(DAFTAR_MIKRO[i].baru, iterasi, &ns_op, &alok_op);
+
+        if (banding) {
+            double ref_ns, ref_alok;
+            ukur(DAFTAR_MIKRO[i].referensi, iterasi, &ref_ns, &ref_alok);
+            int sama = DAFTAR_MIKRO[i].cek();
+            if (!sama) semua_sama = 0;
+
+            printf("%-28s %10.1f %9.2f %10.1f %9.2f %9.2fx %5s\n",
+                   DAFTAR_MIKRO[i].nama, ns_op, alok_op, ref_ns, ref_alok,
+                   ns_op > 0 ? ref_ns / ns_op : 0.0, sama ? "ya" : "TIDAK");
+        } else {
+            printf("%-28s %10.1f %9.2f\n", DAFTAR_MIKRO[i].nama, ns_op, alok_op);
+        }
+        fflush(stdout);
+    }
+
+    return semua_sama ? 0 : 1;
+}
@@ -0,0 +1,348 @@
+/*
+ * =============================================================================
+ * File        : referensi.c
+ * Deskripsi   : Implementasi referensi parser dan formatter (salinan beku)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Salinan apa adanya dari file.c dan utils.c pada saat harness mikro dibuat
+ * (strtok + strtoull/atof untuk parsing, snprintf/sprintf untuk format).
+ * Hanya nama fungsi publik yang diberi awalan ref_.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, stdlib.h, string.h : Untuk snprintf, strtoull, strtok
+ * - referensi.h : Header file modul ini
+ * - utils.h     : Untuk salin_string_aman, pangkas_string, hapus_newline_string
+ *
+ * CATATAN:
+ * Lihat referensi.h: file ini sengaja tidak ikut dioptimasi.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "referensi.h"
+#include "utils.h"
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Konversi string ke int yang aman (menangani NULL)
+ */
+static int aman_atoi(const char *str) {
+    if (str == NULL) return 0;
+    return atoi(str);
+}
+
+/**
+ * Helper: Konversi string ke unsigned long long yang aman
+ */
+static unsigned long long aman_atoull(const char *str) {
+    if (str == NULL) return 0;
+    return strtoull(str, NULL, 10);
+}
+
+/**
+ * Helper: Konversi string ke double yang aman
+ */
+static double aman_atof(const char *str) {
+    if (str == NULL) return 0.0;
+    return atof(str);
+}
+
+/**
+ * Helper: Konversi string ke long long yang aman
+ */
+static long long aman_atoll(const char *str) {
+    if (str == NULL) return 0;
+    return strtoll(str, NULL, 10);
+}
+
+/**
+ * Helper: Membalik string di tempat (in-place)
+ * I.S.: str berisi string
+ * F.S.: Urutan karakter dalam str dibalik
+ */
+static void balik_string(char *str) {
+    int len = strlen(str);
+    int i, j;
+    char temp;
+
+    for (i = 0, j = len - 1; i < j; i++, j--) {
+        temp = str[i];
+        str[i] = str[j];
+        str[j] = temp;
+    }
+}
+
+/* ===== IMPLEMENTASI REFERENSI ===== */
+
+/**
+ * Parse baris teks ke struct Transaksi
+ * Format: id|tanggal|jenis|pos|nominal|deskripsi
+ */
+int ref_urai_baris_transaksi(const char *line, Transaksi *trx) {
+    if (line == NULL || trx == NULL) return 0;
+
+    /* Field opsional (deskripsi) tidak boleh mewarisi isi sebelumnya */
+    memset(trx, 0, sizeof(Transaksi));
+
+    /* Buat salinan line karena strtok memodifikasi string */
+    char buffer[MAX_LINE_LENGTH];
+    salin_string_aman(buffer, line, MAX_LINE_LENGTH);
+    hapus_newline_string(buffer);
+
+    /* Parse field dengan delimiter | */
+    char *token;
+    int field = 0;
+
+    token = strtok(buffer, "|");
+    while (token != NULL && field < 6) {
+        pangkas_string(token);
+
+        switch (field) {
+            case 0:  /* id */
+                salin_string_aman(trx->id, token, sizeof(trx->id));
+                break;
+            case 1:  /* tanggal */
+                salin_string_aman(trx->tanggal, token, sizeof(trx->tanggal));
+                break;
+            case 2:  /* jenis */
+                trx->jenis = urai_jenis_transaksi(token);
+                break;
+            case 3:  /* pos */
+                salin_string_aman(trx->pos, token, sizeof(trx->pos));
+                break;
+            case 4:  /* nominal */
+                trx->nominal = aman_atoull(token);
+                break;
+            case 5:  /* deskripsi */
+                salin_string_aman(trx->deskripsi, token, sizeof(trx->deskripsi));
+                break;
+        }
+
+        field++;
+        token = strtok(NULL, "|");
+    }
+
+    /* Minimal harus ada 5 field (deskripsi bisa kosong) */
+    return (field >= 5);
+}
+
+/**
+ * Parse baris teks ke struct PosAnggaran
+ * Format: no|nama|nominal|realisasi|sisa|jumlah_trx|status
+ */
+int ref_urai_baris_pos(const char *line, PosAnggaran *pos) {
+    if (line == NULL || pos == NULL) return 0;
+
+    char buffer[MAX_LINE_LENGTH];
+    salin_string_aman(buffer, line, MAX_LINE_LENGTH);
+    hapus_newline_string(buffer);
+
+    char *token;
+    int field = 0;
+
+    token = strtok(buffer, "|");
+    while (token != NULL && field < 7) {
+        pangkas_string(token);
+
+        switch (field) {
+            case 0:  /* no */
+                pos->no = aman_atoi(token);
+                break;
+            case 1:  /* nama */
+                salin_string_aman(pos->nama, token, sizeof(pos->nama));
+                break;
+            case 2:  /* nominal */
+                pos->nominal = aman_atoull(token);
+                break;
+            case 3:  /* realisasi */
+                pos->realisasi = aman_atoull(token);
+                break;
+            case 4:  /* sisa */
+                pos->sisa = aman_atoll(token);
+                break;
+            case 5:  /* jumlah_transaksi */
+                pos->jumlah_transaksi = aman_atoi(token);
+                break;
+            case 6:  /* status */
+                pos->status = aman_atoi(token);
+                break;
+        }
+
+        field++;
+        token = strtok(NULL, "|");
+    }
+
+    return (field >= 7);
+}
+
+/**
+ * Parse baris teks ke struct AnalisisKeuangan
+ * Format: pemasukan|pengeluaran|rata|persen|saldo|kondisi|kesimpulan|trx_out|trx_in
+ */
+int ref_urai_baris_analisis(const char *line, AnalisisKeuangan *data) {
+    if (line == NULL || data == NULL) return 0;
+
+    char buffer[MAX_LINE_LENGTH];
+    salin_string_aman(buffer, line, MAX_LINE_LENGTH);
+    hapus_newline_string(buffer);
+
+    char *token;
+    int field = 0;
+
+    token = strtok(buffer, "|");
+    while (token != NULL && field < 9) {
+        pangkas_string(token);
+
+        switch (field) {
+            case 0:  /* total_pemasukan */
+                data->total_pemasukan = aman_atoull(token);
+                break;
+            case 1:  /* total_pengeluaran */
+                data->total_pengeluaran = aman_atoull(token);
+                break;
+            case 2:  /* rata_rata_pengeluaran */
+                data->rata_rata_pengeluaran = aman_atof(token);
+                break;
+            case 3:  /* persentase_sisa */
+                data->persentase_sisa = aman_atof(token);
+                break;
+            case 4:  /* saldo_akhir */
+                data->saldo_akhir = aman_atoll(token);
+                break;
+            case 5:  /* kondisi_keuangan */
+                data->kondisi_keuangan = aman_atoi(token);
+                break;
+            case 6:  /* kesimpulan */
+                data->kesimpulan = aman_atoi(token);
+                break;
+            case 7:  /* total_trx_pengeluaran */
+                data->total_trx_pengeluaran = aman_atoi(token);
+                break;
+            case 8:  /* total_trx_pemasukan */
+                data->total_trx_pemasukan = aman_atoi(token);
+                break;
+        }
+
+        field++;
+        token = strtok(NULL, "|");
+    }
+
+    return (field >= 9);
+}
+
+/**
+ * Format struct Transaksi ke string pipe-delimited
+ */
+void ref_format_transaksi_ke_string(const Transaksi *trx, char *result, int result_size) {
+    if (trx == NULL || result == NULL || result_size <= 0) return;
+
+    snprintf(result, result_size, "%s|%s|%s|%s|%llu|%s",
+            trx->id,
+            trx->tanggal,
+            dapatkan_label_jenis(trx->jenis),
+            trx->pos,
+            trx->nominal,
+            trx->deskripsi);
+}
+
+/**
+ * Format struct PosAnggaran ke string pipe-delimited
+ */
+void ref_format_pos_ke_string(const PosAnggaran *pos, char *result, int result_size) {
+    if (pos == NULL || result == NULL || result_size <= 0) return;
+
+    snprintf(result, result_size, "%d|%s|%llu|%llu|%lld|%d|%d",
+            pos->no,
+            pos->nama,
+            pos->nominal,
+            pos->realisasi,
+            pos->sisa,
+            pos->jumlah_transaksi,
+            pos->status);
+}
+
+/**
+ * Format struct AnalisisKeuangan ke string pipe-delimited
+ */
+void ref_format_analisis_ke_string(const AnalisisKeuangan *data, char *result, int result_size) {
+    if (data == NULL || result == NULL || result_size <= 0) return;
+
+    snprintf(result, result_size, "%llu|%llu|%.2f|%.2f|%lld|%d|%d|%d|%d",
+            data->total_pemasukan,
+            data->total_pengeluaran,
+            data->rata_rata_pengeluaran,
+            data->persentase_sisa,
+            data->saldo_akhir,
+            data->kondisi_keuangan,
+            data->kesimpulan,
+            data->total_trx_pengeluaran,
+            data->total_trx_pemasukan);
+}
+
+/**
+ * Memformat angka dengan separator ribuan (tanpa prefix Rp)
+ */
+void ref_format_angka_pemisah(unsigned long long nominal, char *result) {
+    if (result == NULL) return;
+
+    if (nominal == 0) {
+        strcpy(result, "0");
+        return;
+    }
+
+    char buffer[30];
+    char formatted[30];
+    int i = 0, j = 0, count = 0;
+
+    /* Konversi angka ke string */
+    sprintf(buffer, "%llu", nominal);
+    int len = strlen(buffer);
+
+    /* Format dengan separator ribuan (titik) */
+    for (i = len - 1; i >= 0; i--) {
+        if (count > 0 && count % 3 == 0) {
+            formatted[j++] = '.';
+        }
+        formatted[j++] = buffer[i];
+        count++;
+    }
+    formatted[j] = '\0';
+
+    balik_string(formatted);
+    strcpy(result, formatted);
+}
+
+/**
+ * Memformat nominal ke format Rupiah dengan separator ribuan
+ */
+void ref_format_rupiah(unsigned long long nominal, char *result) {
+    if (result == NULL) return;
+
+    char formatted[30];
+    ref_format_angka_pemisah(nominal, formatted);
+
+    sprintf(result, "Rp %s", formatted);
+}
+
+/**
+ * Memformat nilai saldo (bisa negatif) ke format Rupiah
+ */
+void ref_format_saldo(long long saldo, char *result) {
+    if (result == NULL) return;
+
+    if (saldo < 0) {
+        char formatted[30];
+        ref_format_angka_pemisah((unsigned long long)(-saldo), formatted);
+        sprintf(result, "-Rp %s", formatted);
+    } else {
+        ref_format_rupiah((unsigned long long)saldo, result);
+    }
+}
+
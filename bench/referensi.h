@@ -0,0 +1,95 @@
+/*
+ * =============================================================================
+ * File        : referensi.h
+ * Deskripsi   : Header file implementasi referensi parser dan formatter
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini menyimpan salinan beku fungsi urai_baris_*, format_*_ke_string,
+ * format_angka_pemisah, format_rupiah, dan format_saldo sebelum dioptimasi.
+ * Mode banding di keuangan_mikro menjalankan implementasi di src/ dan
+ * salinan ini pada input yang sama, lalu membandingkan waktu dan hasilnya.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - file.h      : Untuk struct Transaksi, PosAnggaran, AnalisisKeuangan
+ *
+ * CATATAN:
+ * Jangan mengubah isi referensi.c saat mengoptimasi src/; referensi hanya
+ * diperbarui bila format file atau tampilan memang sengaja diubah.
+ * =============================================================================
+ */
+
+#ifndef REFERENSI_H
+#define REFERENSI_H
+
+#include "file.h"
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk mengurai baris transaksi (implementasi referensi).
+    Input : line (Baris file), trx (Struct tujuan)
+    Output : Mengembalikan 1 jika minimal 5 field terbaca, 0 jika tidak.
+*/
+int ref_urai_baris_transaksi(const char *line, Transaksi *trx);
+
+/*
+    Function bertujuan untuk mengurai baris pos (implementasi referensi).
+    Input : line (Baris file), pos (Struct tujuan)
+    Output : Mengembalikan 1 jika 7 field terbaca, 0 jika tidak.
+*/
+int ref_urai_baris_pos(const char *line, PosAnggaran *pos);
+
+/*
+    Function bertujuan untuk mengurai baris analisis (implementasi referensi).
+    Input : line (Baris file), data (Struct tujuan)
+    Output : Mengembalikan 1 jika 9 field terbaca, 0 jika tidak.
+*/
+int ref_urai_baris_analisis(const char *line, AnalisisKeuangan *data);
+
+/*
+    Procedure bertujuan untuk memformat transaksi ke baris file (implementasi referensi).
+    I. S. : trx terisi
+    F. S. : result berisi baris pipe-delimited.
+*/
+void ref_format_transaksi_ke_string(const Transaksi *trx, char *result, int result_size);
+
+/*
+    Procedure bertujuan untuk memformat pos ke baris file (implementasi referensi).
+    I. S. : pos terisi
+    F. S. : result berisi baris pipe-delimited.
+*/
+void ref_format_pos_ke_string(const PosAnggaran *pos, char *result, int result_size);
+
+/*
+    Procedure bertujuan untuk memformat analisis ke baris file (implementasi referensi).
+    I. S. : data terisi
+    F. S. : result berisi baris pipe-delimited.
+*/
+void ref_format_analisis_ke_string(const AnalisisKeuangan *data, char *result, int result_size);
+
+/*
+    Procedure bertujuan untuk memformat angka dengan pemisah ribuan (implementasi referensi).
+    I. S. : nominal terdefinisi
+    F. S. : result berisi angka dengan titik sebagai pemisah ribuan.
+*/
+void ref_format_angka_pemisah(unsigned long long nominal, char *result);
+
+/*
+    Procedure bertujuan untuk memformat nominal Rupiah (implementasi referensi).
+    I. S. : nominal terdefinisi
+    F. S. : result berisi "Rp " diikuti angka berpemisah.
+*/
+void ref_format_rupiah(unsigned long long nominal, char *result);
+
+/*
+    Procedure bertujuan untuk memformat saldo bertanda (implementasi referensi).
+    I. S. : saldo terdefinisi
+    F. S. : result berisi "Rp ..." atau "-Rp ...".
+*/
+void ref_format_saldo(long long saldo, char *result);
+
+#endif
@@ -15,13 +15,11 @@
  * - Analisis kondisi keuangan (Defisit/Seimbang/Surplus)
  * - Penentuan kesimpulan dan saran keuangan
  * - Perhitungan persentase sisa terhadap pemasukan
- * - Tampilan grafik dan laporan analisis
  *
  * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
  * - transaksi.h : Untuk akses data transaksi dan perhitungan
  * - pos.h       : Untuk akses data pos anggaran
  * - utils.h     : Untuk fungsi utilitas formatting
- * - tui.h       : Untuk tampilan antarmuka pengguna
  * - file.h      : Untuk operasi penyimpanan analisis
  *
  * CATATAN:
@@ -54,6 +52,9 @@
 
 /* ===== STRUKTUR DATA ===== */
 
+/* Deklarasi forward untuk menghindari ketergantungan melingkar */
+typedef struct RingkasanTransaksi RingkasanTransaksi;
+
 /**
  * Struct untuk menyimpan hasil analisis keuangan bulanan
  *
@@ -78,6 +79,13 @@ typedef struct AnalisisKeuangan {
 */
 int hitung_analisis_bulan(int bulan, AnalisisKeuangan *result);
 
+/*
+    Procedure bertujuan untuk mengisi analisis keuangan dari ringkasan transaksi yang sudah dihitung.
+    I. S. : ringkasan berisi total dan jumlah transaksi satu bulan
+    F. S. : result berisi analisis lengkap (saldo, rata-rata, persentase, kondisi, kesimpulan).
+*/
+void isi_analisis_dari_ringkasan(const RingkasanTransaksi *ringkasan, AnalisisKeuangan *result);
+
 /*
     Function bertujuan untuk menentukan kondisi keuangan berdasarkan saldo.
     Input : pemasukan (Total pemasukan), pengeluaran (Total pengeluaran)
@@ -121,46 +129,4 @@ const char* get_deskripsi_kesimpulan(int kesimpulan);
 */
 int refresh_analisis_bulan(int bulan);
 
-/*
-    Procedure bertujuan untuk menampilkan analisis keuangan lengkap untuk bulan.
-    I. S. : bulan (Nomor bulan valid)
-    F. S. : Analisis ditampilkan di layar.
-*/
-void tampilkan_analisis_bulan(int bulan);
-
-/*
-    Function bertujuan untuk menampilkan ringkasan kondisi keuangan.
-    Input : analisis (Pointer ke data analisis), start_y (Baris awal tampilan)
-    Output : Mengembalikan posisi baris berikutnya.
-*/
-int tampilkan_ringkasan_kondisi(AnalisisKeuangan *analisis, int start_y);
-
-/*
-    Function bertujuan untuk menampilkan grafik sederhana perbandingan pemasukan/pengeluaran.
-    Input : analisis (Pointer ke data analisis), start_y (Baris awal tampilan)
-    Output : Mengembalikan posisi baris berikutnya.
-*/
-int tampilkan_grafik_sederhana(AnalisisKeuangan *analisis, int start_y);
-
-/*
-    Function bertujuan untuk menampilkan saran berdasarkan kesimpulan.
-    Input : kesimpulan (Kode kesimpulan), start_y (Baris awal tampilan)
-    Output : Mengembalikan posisi baris berikutnya.
-*/
-int tampilkan_saran(int kesimpulan, int start_y);
-
-/*
-    Procedure bertujuan untuk menjalankan modul analisis keuangan.
-    I. S. : bulan_awal (Bulan awal saat modul dijalankan, valid)
-    F. S. : Modul analisis dijalankan hingga pengguna kembali.
-*/
-void jalankan_modul_analisis(int bulan_awal);
-
-/*
-    Function bertujuan untuk menampilkan menu analisis keuangan.
-    Input : bulan (Bulan aktif)
-    Output : Mengembalikan kode aksi yang dipilih.
-*/
-int menu_analisis_utama(int bulan);
-
 #endif
@@ -0,0 +1,131 @@
+/*
+ * =============================================================================
+ * File        : arsip.h
+ * Deskripsi   : Header file untuk modul arsip kolom periode tertutup
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini menyimpan transaksi tahun yang sudah ditutup dalam format biner
+ * kolom yang ringkas, termasuk:
+ * - Segel tahun: memindahkan transaksi satu tahun dari file teks ke arsip
+ * - Buka segel: mengembalikan transaksi arsip ke file teks
+ * - Pembacaan arsip yang dipakai telusuri_transaksi secara transparan
+ * - Penolakan perubahan transaksi pada tahun yang disegel
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - file.h      : Untuk PengunjungTransaksi, PenulisBaris, dan nama file
+ * - transaksi.h : Untuk struct Transaksi
+ *
+ * CATATAN:
+ * Format file data/arsip_YYYY.bin (semua angka varint LEB128):
+ *   magic "KARSIP01", versi, jumlah baris, jumlah kamus pos,
+ *   panjang mentah dan terkompresi 6 kolom (id, tanggal, jenis, pos,
+ *   nominal, deskripsi), kamus pos (panjang + byte), isi 6 kolom
+ *   terkompresi LZ77, lalu hash FNV-1a 64-bit (8 byte) dari seluruh byte
+ *   sebelumnya.
+ * Kolom id dan tanggal disimpan sebagai selisih terhadap baris sebelumnya
+ * (nomor ID dan nomor hari), jenis dan nominal sebagai varint, pos sebagai
+ * indeks kamus, dan deskripsi sebagai heap (panjang + byte). Nilai yang
+ * tidak kanonik (misal ID bukan Txxxx) disimpan apa adanya sehingga setiap
+ * transaksi terbaca kembali persis sama.
+ * Saat menelusuri, arsip dibaca lebih dulu (urut tahun) sebelum file teks.
+ * =============================================================================
+ */
+
+#ifndef ARSIP_H
+#define ARSIP_H
+
+#include "file.h"
+
+/* ===== KONSTANTA ===== */
+
+#define FILE_ARSIP_PREFIX       "arsip"         /* Prefix file arsip per tahun */
+#define FILE_ARSIP_EXTENSION    ".bin"          /* Ekstensi file arsip */
+#define MAGIC_ARSIP             "KARSIP01"      /* 8 byte pertama file arsip */
+#define PANJANG_MAGIC_ARSIP     8
+#define VERSI_ARSIP             1
+#define MAKS_TAHUN_ARSIP        64              /* Batas tahun arsip yang dikenali */
+#define TAHUN_ARSIP_MIN         1900            /* Tahun terkecil yang bisa disegel */
+#define FILE_JURNAL_SEGEL       "segel.jurnal"  /* Penanda segel/buka segel yang sedang berjalan */
+#define JURNAL_SEGEL            "SEGEL"
+#define JURNAL_BUKA_SEGEL       "BUKA"
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Procedure bertujuan untuk membuat nama file arsip tahun.
+    I. S. : tahun (Tahun arsip)
+    F. S. : result berisi path file, misal "data/arsip_2025.bin".
+*/
+void dapatkan_nama_file_arsip(int tahun, char *result, int result_size);
+
+/*
+    Function bertujuan untuk menulis transaksi ke file arsip kolom.
+    Input : filename (Path arsip), list (Array transaksi), count (Jumlah transaksi)
+    Output : File diganti secara atomik lewat file sementara. Mengembalikan 1 jika berhasil, 0 jika gagal.
+*/
+int arsip_tulis(const char *filename, const Transaksi *list, int count);
+
+/*
+    Function bertujuan untuk menelusuri transaksi di satu file arsip.
+    Input : filename (Path arsip), bulan (Filter bulan 1-12, 0 untuk semua), kunjungi (Callback), konteks (Data callback),
+            berhenti (Diisi 1 jika callback mengembalikan 0, boleh NULL)
+    Output : Mengembalikan jumlah transaksi yang dikunjungi, atau -1 jika arsip rusak atau callback gagal.
+*/
+int arsip_telusuri(const char *filename, int bulan, PengunjungTransaksi kunjungi, void *konteks, int *berhenti);
+
+/*
+    Function bertujuan untuk mendapatkan daftar tahun yang memiliki arsip.
+    Input : tahun (Array tujuan), maks (Kapasitas array)
+    Output : tahun berisi tahun arsip urut naik. Mengembalikan jumlah tahun.
+*/
+int daftar_tahun_arsip(int *tahun, int maks);
+
+/*
+    Function bertujuan untuk menelusuri transaksi di semua arsip, urut tahun.
+    Input : bulan (Filter bulan 1-12, 0 untuk semua), kunjungi (Callback), konteks (Data callback),
+            berhenti (Diisi 1 jika callback mengembalikan 0, boleh NULL)
+    Output : Mengembalikan jumlah transaksi yang dikunjungi, atau -1 jika ada arsip rusak atau callback gagal.
+*/
+int telusuri_arsip(int bulan, PengunjungTransaksi kunjungi, void *konteks, int *berhenti);
+
+/*
+    Function bertujuan untuk memeriksa apakah tahun sudah disegel ke arsip.
+    Input : tahun (Tahun yang diperiksa)
+    Output : Mengembalikan 1 jika ada arsip tahun tersebut, 0 jika tidak.
+*/
+int cek_tahun_tersegel(int tahun);
+
+/*
+    Function bertujuan untuk memeriksa apakah tanggal berada di tahun yang disegel.
+    Input : tanggal (String tanggal dd-mm-YYYY)
+    Output : Mengembalikan 1 jika tahunnya disegel, 0 jika tidak atau tanggal tidak valid.
+*/
+int cek_tanggal_tersegel(const char *tanggal);
+
+/*
+    Function bertujuan untuk menyegel satu tahun: memindahkan transaksinya dari file teks ke arsip.
+    Input : tahun (Tahun yang sudah lewat), error_msg (Buffer pesan error, boleh NULL)
+    Output : Mengembalikan jumlah transaksi yang diarsipkan, atau -1 jika gagal.
+*/
+int segel_tahun(int tahun, char *error_msg);
+
+/*
+    Function bertujuan untuk membuka segel tahun: mengembalikan transaksi arsip ke file teks.
+    Input : tahun (Tahun yang disegel), error_msg (Buffer pesan error, boleh NULL)
+    Output : Mengembalikan jumlah transaksi yang dikembalikan, atau -1 jika gagal.
+*/
+int buka_segel_tahun(int tahun, char *error_msg);
+
+/*
+    Function bertujuan untuk menuntaskan segel/buka segel yang terhenti (misal proses mati di tengah).
+    Input : error_msg (Buffer pesan error, boleh NULL)
+    Output : Jika data/segel.jurnal ada, operasinya diselesaikan dari arsip yang tersisa lalu jurnal
+             dihapus. Mengembalikan 1 jika tidak ada yang perlu dipulihkan atau berhasil, 0 jika gagal.
+*/
+int pulihkan_segel(char *error_msg);
+
+#endif
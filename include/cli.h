@@ -0,0 +1,56 @@
+/*
+ * =============================================================================
+ * File        : cli.h
+ * Deskripsi   : Header file untuk mode perintah non-interaktif (batch CLI)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini menyediakan mode perintah tanpa ncurses sehingga aplikasi dapat
+ * dijalankan dari skrip, cron, atau pipeline, termasuk:
+ * - add     : Menambah transaksi
+ * - list    : Menampilkan transaksi atau pos anggaran
+ * - report  : Menampilkan analisis keuangan bulanan
+ * - recalc  : Menghitung ulang pos dan analisis
+ * - import  : Mengimpor transaksi dari file
+ * - export  : Mengekspor transaksi, pos, atau analisis
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - transaksi.h : Untuk operasi transaksi
+ * - pos.h       : Untuk data pos anggaran
+ * - analisis.h  : Untuk perhitungan analisis
+ * - file.h      : Untuk akses file data
+ * - pekerja.h   : Untuk menunda perhitungan ulang pada operasi massal
+ * - impor.h     : Untuk impor massal CSV/TSV
+ * - ekspor.h    : Untuk ekspor TSV/CSV/JSON
+ * - utils.h     : Untuk validasi dan konversi
+ *
+ * CATATAN:
+ * Keluaran dibuat agar mudah diproses mesin: satu rekaman per baris dengan
+ * kolom dipisah TAB dan baris pertama berisi nama kolom. Pesan kesalahan
+ * ditulis ke stderr dengan awalan "error: ". ncurses tidak pernah diinisialisasi.
+ * =============================================================================
+ */
+
+#ifndef CLI_H
+#define CLI_H
+
+/* ===== KONSTANTA ===== */
+
+/* Kode Keluar */
+#define CLI_SUKSES          0       /* Perintah berhasil */
+#define CLI_GAGAL           1       /* Perintah gagal dijalankan */
+#define CLI_SALAH_PAKAI     2       /* Perintah atau opsi tidak dikenal */
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk menjalankan satu perintah non-interaktif.
+    Input : argc, argv (Argumen program; argv[1] adalah nama perintah)
+    Output : Mengembalikan kode keluar (CLI_SUKSES, CLI_GAGAL, atau CLI_SALAH_PAKAI).
+*/
+int cli_jalankan(int argc, char *argv[]);
+
+#endif
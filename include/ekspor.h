@@ -0,0 +1,144 @@
+/*
+ * =============================================================================
+ * File        : ekspor.h
+ * Deskripsi   : Header file untuk modul ekspor data (TSV, CSV, JSON)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini menyediakan ekspor data keuangan ke file atau stream, termasuk:
+ * - Transaksi (satu bulan atau semua bulan)
+ * - Tabel pos anggaran per bulan beserta realisasinya
+ * - Laporan analisis keuangan per bulan
+ * dalam format TSV, CSV (RFC 4180), atau JSON (array objek).
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h     : Untuk FILE tujuan
+ * - transaksi.h : Untuk struct Transaksi dan ringkasan bulanan
+ * - pos.h       : Untuk daftar pos anggaran
+ * - analisis.h  : Untuk struct AnalisisKeuangan
+ * - file.h      : Untuk penelusuran file transaksi dan PenulisBaris
+ * - utils.h     : Untuk perbandingan string
+ *
+ * CATATAN:
+ * Data ditulis langsung dari penelusuran file (telusuri_transaksi) melalui
+ * PenulisEkspor, buffer tulis berukuran tetap. Seluruh ledger tidak pernah
+ * dimuat ke memori sehingga pemakaian memori konstan berapa pun ukurannya.
+ * =============================================================================
+ */
+
+#ifndef EKSPOR_H
+#define EKSPOR_H
+
+#include <stdio.h>
+#include "file.h"
+
+/* ===== KONSTANTA ===== */
+
+/* Format Keluaran */
+#define EKSPOR_FORMAT_TSV       0       /* Dipisah TAB, sama dengan keluaran CLI */
+#define EKSPOR_FORMAT_CSV       1       /* Dipisah koma, kutip ganda bila perlu */
+#define EKSPOR_FORMAT_JSON      2       /* Array objek JSON */
+
+/* Jenis Data */
+#define EKSPOR_DATA_TRANSAKSI   1       /* Daftar transaksi */
+#define EKSPOR_DATA_POS         2       /* Tabel pos anggaran per bulan */
+#define EKSPOR_DATA_ANALISIS    3       /* Laporan analisis per bulan */
+
+#define UKURAN_BUFFER_EKSPOR    16384   /* Ukuran buffer tulis */
+
+/* ===== STRUKTUR DATA ===== */
+
+/**
+ * Struct penulis ekspor dengan buffer tetap
+ *
+ * Semua keluaran dikumpulkan di buffer dan dikirim ke FILE atau PenulisBaris
+ * per blok, sehingga escape per karakter (CSV/JSON) tidak memanggil stdio
+ * untuk tiap byte.
+ */
+typedef struct {
+    FILE *out;                          /* Stream tujuan */
+    PenulisBaris *file;                 /* Penulis file tujuan (ekspor_ke_file), NULL jika ke out */
+    int format;                         /* EKSPOR_FORMAT_* */
+    char buffer[UKURAN_BUFFER_EKSPOR];  /* Buffer tulis */
+    int terpakai;                       /* Byte terisi di buffer */
+    int kolom;                          /* Indeks kolom dalam rekaman saat ini */
+    long rekaman;                       /* Jumlah rekaman yang sudah ditulis */
+    int gagal;                          /* 1 jika penulisan ke stream gagal */
+} PenulisEkspor;
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk mengurai nama format ekspor.
+    Input : nama ("tsv", "csv", atau "json", tidak peka huruf besar/kecil)
+    Output : Mengembalikan EKSPOR_FORMAT_*, atau -1 jika tidak dikenal.
+*/
+int urai_format_ekspor(const char *nama);
+
+/*
+    Function bertujuan untuk mengurai nama jenis data ekspor.
+    Input : nama ("transaksi", "pos", atau "analisis")
+    Output : Mengembalikan EKSPOR_DATA_*, atau -1 jika tidak dikenal.
+*/
+int urai_data_ekspor(const char *nama);
+
+/*
+    Function bertujuan untuk mendapatkan ekstensi file untuk format ekspor.
+    Input : format (EKSPOR_FORMAT_*)
+    Output : Mengembalikan "tsv", "csv", atau "json".
+*/
+const char* dapatkan_ekstensi_ekspor(int format);
+
+/*
+    Procedure bertujuan untuk menyiapkan penulis ekspor.
+    I. S. : w belum diinisialisasi
+    F. S. : w siap menulis ke out dengan format yang diberikan.
+*/
+void penulis_ekspor_mulai(PenulisEkspor *w, FILE *out, int format);
+
+/*
+    Function bertujuan untuk mengirim sisa buffer ke stream.
+    Input : w (Penulis ekspor)
+    Output : Mengembalikan 1 jika seluruh keluaran berhasil ditulis, 0 jika ada kegagalan.
+*/
+int penulis_ekspor_selesai(PenulisEkspor *w);
+
+/*
+    Function bertujuan untuk mengekspor transaksi langsung dari file transaksi.
+    Input : w (Penulis ekspor), bulan (Bulan 1-12, atau 0 untuk semua)
+    Output : Mengembalikan jumlah transaksi yang ditulis, atau -1 jika gagal.
+*/
+long ekspor_transaksi(PenulisEkspor *w, int bulan);
+
+/*
+    Function bertujuan untuk mengekspor tabel pos anggaran beserta realisasinya.
+    Input : w (Penulis ekspor), bulan (Bulan 1-12, atau 0 untuk semua bulan yang memiliki pos)
+    Output : Mengembalikan jumlah pos yang ditulis, atau -1 jika gagal.
+*/
+long ekspor_pos(PenulisEkspor *w, int bulan);
+
+/*
+    Function bertujuan untuk mengekspor laporan analisis keuangan.
+    Input : w (Penulis ekspor), bulan (Bulan 1-12, atau 0 untuk semua bulan yang memiliki transaksi)
+    Output : Mengembalikan jumlah laporan bulan yang ditulis, atau -1 jika gagal.
+*/
+long ekspor_analisis(PenulisEkspor *w, int bulan);
+
+/*
+    Function bertujuan untuk mengekspor satu jenis data ke stream.
+    Input : out (Stream tujuan), data (EKSPOR_DATA_*), format (EKSPOR_FORMAT_*), bulan (0 = semua)
+    Output : Mengembalikan jumlah rekaman yang ditulis, atau -1 jika gagal.
+*/
+long ekspor_ke_stream(FILE *out, int data, int format, int bulan);
+
+/*
+    Function bertujuan untuk mengekspor satu jenis data ke file (ditulis ke .tmp lalu rename).
+    Input : path (Path file tujuan), data (EKSPOR_DATA_*), format (EKSPOR_FORMAT_*), bulan (0 = semua)
+    Output : Mengembalikan jumlah rekaman yang ditulis, atau -1 jika gagal (file tujuan tidak berubah).
+*/
+long ekspor_ke_file(const char *path, int data, int format, int bulan);
+
+#endif
@@ -48,6 +48,35 @@
 #define MAX_LINE_LENGTH         512                 /* Panjang maksimal baris file */
 #define MAX_PATH_LENGTH         256                 /* Panjang maksimal path file */
 #define MAX_PATH                MAX_PATH_LENGTH     /* Alias untuk MAX_PATH_LENGTH */
+#define UKURAN_BUFFER_PENULIS   65536               /* Buffer tulis PenulisBaris */
+#define FILE_RUSAK_SUFFIX       ".rusak"            /* Akhiran file penampung baris rusak hasil kompaksi */
+
+/* Kebijakan sinkron penulisan ulang penuh */
+#define SINKRON_TIDAK           0                   /* Serahkan ke page cache (default) */
+#define SINKRON_DATA            1                   /* fdatasync sebelum file ditutup */
+#define ENV_SINKRON_FILE        "KEUANGAN_FDATASYNC" /* Isi 1 untuk SINKRON_DATA */
+
+/* ===== TIPE DATA ===== */
+
+/**
+ * Callback penelusuran transaksi baris demi baris.
+ * Mengembalikan 1 untuk lanjut, 0 untuk berhenti, atau -1 untuk membatalkan (gagal).
+ */
+typedef int (*PengunjungTransaksi)(const Transaksi *trx, void *konteks);
+
+/**
+ * Struct penulis baris untuk penulisan ulang file penuh
+ *
+ * Baris diformat langsung ke buffer dan dikirim dengan write/writev per
+ * blok besar, tanpa stdio dan tanpa parsing format string per baris.
+ */
+typedef struct {
+    int fd;                             /* Descriptor file tujuan */
+    char buffer[UKURAN_BUFFER_PENULIS]; /* Buffer tulis */
+    int terpakai;                       /* Byte terisi di buffer */
+    long long total;                    /* Byte yang sudah dikirim ke file */
+    int gagal;                          /* 1 jika ada penulisan yang gagal */
+} PenulisBaris;
 
 /*
     Function bertujuan untuk memastikan direktori data ada.
@@ -112,6 +141,70 @@ int tulis_semua_file(const char *filename, const char *content);
 */
 int tambah_baris_file(const char *filename, const char *line);
 
+/*
+    Procedure bertujuan untuk memasang kebijakan sinkron penulisan ulang penuh.
+    I. S. : Kebijakan default SINKRON_TIDAK
+    F. S. : Penulis yang ditutup setelah ini memakai kebijakan (SINKRON_TIDAK/SINKRON_DATA).
+*/
+void atur_sinkron_file(int kebijakan);
+
+/*
+    Function bertujuan untuk membuka penulis baris ke file (overwrite).
+    Input : w (Penulis), filename (Path file tujuan)
+    Output : Mengembalikan 1 jika file terbuka, 0 jika gagal.
+*/
+int penulis_buka(PenulisBaris *w, const char *filename);
+
+/*
+    Procedure bertujuan untuk menulis potongan byte ke penulis.
+    I. S. : w terbuka
+    F. S. : data masuk buffer, atau dikirim langsung bersama buffer jika tidak muat.
+*/
+void penulis_tulis(PenulisBaris *w, const char *data, int len);
+
+/*
+    Procedure bertujuan untuk menulis satu baris teks beserta newline ke penulis.
+    I. S. : w terbuka
+    F. S. : line dan '\n' masuk buffer penulis.
+*/
+void penulis_tulis_baris(PenulisBaris *w, const char *line);
+
+/*
+    Procedure bertujuan untuk memformat transaksi langsung ke buffer penulis.
+    I. S. : w terbuka, trx terisi
+    F. S. : Baris transaksi (sama dengan format_transaksi_ke_string) dan newline masuk buffer.
+*/
+void penulis_tulis_transaksi(PenulisBaris *w, const Transaksi *trx);
+
+/*
+    Procedure bertujuan untuk memformat pos langsung ke buffer penulis.
+    I. S. : w terbuka, pos terisi
+    F. S. : Baris pos (sama dengan format_pos_ke_string) dan newline masuk buffer.
+*/
+void penulis_tulis_pos(PenulisBaris *w, const PosAnggaran *pos);
+
+/*
+    Function bertujuan untuk menutup penulis baris.
+    Input : w (Penulis terbuka)
+    Output : Sisa buffer dikirim, fdatasync jika SINKRON_DATA, file ditutup.
+             Mengembalikan 1 jika semua penulisan berhasil, 0 jika ada yang gagal.
+*/
+int penulis_tutup(PenulisBaris *w);
+
+/*
+    Function bertujuan untuk menutup file sambil mencatat posisi akhirnya ke penghitung instrumen.
+    Input : f (File terbuka), penghitung (INS_BYTE_BACA atau INS_BYTE_TULIS)
+    Output : Mengembalikan hasil fclose (0 jika berhasil).
+*/
+int tutup_file(FILE *f, int penghitung);
+
+/*
+    Function bertujuan untuk mengganti file tujuan dengan file sementara lewat rename.
+    Input : dari (File sementara yang sudah ditutup), ke (File tujuan)
+    Output : Mengembalikan 1 jika berhasil, 0 jika gagal.
+*/
+int ganti_file(const char *dari, const char *ke);
+
 /*
     Procedure bertujuan untuk menghasilkan nama file dengan suffix bulan.
     Input : base (Nama dasar file), bulan (Nomor bulan 1-12), result_size (Ukuran buffer result)
@@ -168,6 +261,20 @@ void format_pos_ke_string(const PosAnggaran *pos, char *result, int result_size)
 */
 void format_analisis_ke_string(const AnalisisKeuangan *data, char *result, int result_size);
 
+/*
+    Function bertujuan untuk menghitung ukuran baris transaksi di file (termasuk newline).
+    Input : trx (Pointer ke struct Transaksi)
+    Output : Mengembalikan jumlah byte baris, 0 jika trx NULL.
+*/
+int ukuran_baris_transaksi(const Transaksi *trx);
+
+/*
+    Function bertujuan untuk menghitung ukuran baris pos di file (termasuk newline).
+    Input : pos (Pointer ke struct PosAnggaran)
+    Output : Mengembalikan jumlah byte baris, 0 jika pos NULL.
+*/
+int ukuran_baris_pos(const PosAnggaran *pos);
+
 /*
     Function bertujuan untuk mendapatkan label jenis transaksi.
     Input : jenis (Kode jenis transaksi 0 atau 1)
@@ -280,6 +387,15 @@ int inisialisasi_pos_bulan(int bulan);
 */
 int salin_pos_dari_bulan(int bulan_tujuan, int bulan_sumber);
 
+/*
+    Function bertujuan untuk menelusuri transaksi di file satu per satu tanpa memuat semuanya.
+             Arsip tahun yang disegel ditelusuri lebih dulu, lalu file teks.
+    Input : bulan (Bulan yang difilter 1-12, atau 0 untuk semua), kunjungi (Callback per transaksi),
+            konteks (Data milik pemanggil yang diteruskan ke callback)
+    Output : Mengembalikan jumlah transaksi yang dikunjungi, atau -1 jika dibatalkan callback atau arsip rusak.
+*/
+int telusuri_transaksi(int bulan, PengunjungTransaksi kunjungi, void *konteks);
+
 /*
     Function bertujuan untuk memuat semua transaksi dari file.
     Input : max_count (Kapasitas maksimal array)
@@ -294,6 +410,30 @@ int muat_transaksi(Transaksi *list, int max_count);
 */
 int muat_transaksi_bulan(Transaksi *list, int max_count, int bulan);
 
+/*
+    Function bertujuan untuk memuat transaksi ke list dinamis tanpa batas jumlah.
+    Input : list (ListTransaksi yang sudah diinisialisasi), bulan (Bulan yang difilter 1-12, atau 0 untuk semua)
+    Output : list (Terisi transaksi hasil filter). Mengembalikan jumlah transaksi, atau -1 jika gagal alokasi.
+*/
+int muat_transaksi_ke_list(ListTransaksi *list, int bulan);
+
+/*
+    Function bertujuan untuk menjaga transaksi satu bulan tetap terurai di memori (cache hangat).
+    Input : bulan (Bulan 1-12, menggantikan bulan hangat sebelumnya)
+    Output : telusuri_transaksi, muat_transaksi_bulan, dan muat_transaksi_ke_list untuk bulan itu
+             dilayani dari memori selama stat file transaksi tidak berubah; setelah berubah, pemuatan
+             berikutnya membaca file lalu memperbarui cache. Mengembalikan jumlah transaksi bulan,
+             atau -1 jika gagal.
+*/
+int hangatkan_transaksi_bulan(int bulan);
+
+/*
+    Procedure bertujuan untuk melepas memori cache hangat transaksi.
+    I. S. : Cache hangat mungkin berisi
+    F. S. : Cache kosong dan tidak ada bulan yang dijaga hangat.
+*/
+void lepaskan_cache_hangat(void);
+
 /*
     Function bertujuan untuk menyimpan semua transaksi ke file.
     Input : list (Array transaksi), count (Jumlah transaksi)
@@ -322,6 +462,15 @@ int ubah_transaksi_di_file(const char *id, Transaksi *trx);
 */
 int hapus_transaksi_dari_file(const char *id);
 
+/*
+    Function bertujuan untuk merapikan file transaksi dari baris kosong atau rusak.
+    Input : -
+    Output : Baris rusak ditambahkan utuh ke data/transaksi.txt.rusak sebelum file transaksi
+             diganti; baris kosong dibuang. Mengembalikan jumlah baris rusak yang dipindah, atau
+             -1 jika gagal menulis (file transaksi tidak berubah).
+*/
+int kompaksi_file_transaksi(void);
+
 /*
     Function bertujuan untuk mencari transaksi berdasarkan ID.
     Input : id (ID transaksi yang dicari)
@@ -330,11 +479,27 @@ int hapus_transaksi_dari_file(const char *id);
 int cari_transaksi_berdasarkan_id(const char *id, Transaksi *result);
 
 /*
-    Procedure bertujuan untuk menghasilkan ID transaksi baru yang unik.
+    Function bertujuan untuk mencari nomor ID transaksi terbesar di file.
     Input : -
-    Output : buffer (Buffer untuk menyimpan ID baru (format Txxxx))
+    Output : Mengembalikan nomor terbesar (bagian angka ID), atau 0 jika belum ada transaksi.
+*/
+int ambil_nomor_id_terbesar(void);
+
+/*
+    Function bertujuan untuk membentuk ID transaksi dari nomor urut.
+    Input : nomor (Nomor urut ID, 1..MAX_NOMOR_ID), buffer_size (Ukuran buffer)
+    Output : buffer (ID format Txxxx). Mengembalikan 1 jika berhasil, 0 jika nomor di luar
+             rentang atau buffer terlalu kecil (buffer berisi string kosong).
+*/
+int format_id_transaksi(int nomor, char *buffer, int buffer_size);
+
+/*
+    Function bertujuan untuk menghasilkan ID transaksi baru yang unik.
+    Input : buffer_size (Ukuran buffer)
+    Output : buffer (ID baru format Txxxx). Mengembalikan 1 jika berhasil, 0 jika nomor ID
+             sudah melewati MAX_NOMOR_ID.
 */
-void buat_id_transaksi(char *buffer);
+int buat_id_transaksi(char *buffer, int buffer_size);
 
 /*
     Function bertujuan untuk menghitung jumlah transaksi untuk pos tertentu.
@@ -0,0 +1,89 @@
+/*
+ * =============================================================================
+ * File        : impor.h
+ * Deskripsi   : Header file untuk modul impor massal transaksi (CSV/TSV)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini menyediakan impor transaksi dalam jumlah besar (misalnya mutasi
+ * rekening bank) dari file CSV atau TSV, termasuk:
+ * - Pembacaan input baris demi baris (streaming)
+ * - Validasi setiap baris dengan aturan yang sama seperti form tambah
+ * - Pemberian ID transaksi secara massal
+ * - Laporan baris yang ditolak beserta nomor barisnya
+ * - Penyimpanan semua baris yang diterima sekaligus di akhir (satu commit)
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h     : Untuk FILE input dan file sementara
+ * - transaksi.h : Untuk struct Transaksi dan validasi transaksi
+ * - file.h      : Untuk akses file transaksi
+ * - pekerja.h   : Untuk perhitungan ulang pos dan analisis bulan terdampak
+ * - utils.h     : Untuk validasi tanggal, nominal, dan string
+ *
+ * CATATAN:
+ * Kolom input: tanggal, jenis, pos, nominal, deskripsi (opsional).
+ * Baris pertama yang kolom pertamanya "tanggal" dianggap header dan dilewati,
+ * begitu juga baris kosong dan baris berawalan '#'. Baris diterima ditampung
+ * di file sementara sehingga memori tetap konstan berapa pun ukuran input;
+ * file transaksi baru diganti (rename) setelah seluruh input selesai dibaca.
+ * =============================================================================
+ */
+
+#ifndef IMPOR_H
+#define IMPOR_H
+
+#include <stdio.h>
+#include "transaksi.h"
+
+/* ===== KONSTANTA ===== */
+
+/* Format Input */
+#define IMPOR_FORMAT_OTOMATIS   0       /* Deteksi dari baris data pertama */
+#define IMPOR_FORMAT_CSV        1       /* Dipisah koma, kutip ganda ala RFC 4180 */
+#define IMPOR_FORMAT_TSV        2       /* Dipisah TAB tanpa kutip */
+
+#define MAX_BARIS_IMPOR         1024    /* Panjang maksimal satu baris input */
+#define MAX_KOLOM_IMPOR         5       /* tanggal, jenis, pos, nominal, deskripsi */
+
+/* ===== STRUKTUR DATA ===== */
+
+/**
+ * Struct hasil satu kali impor
+ */
+typedef struct {
+    int baris_dibaca;                       /* Jumlah baris input yang dibaca */
+    int diterima;                           /* Baris yang lolos validasi dan disimpan */
+    int ditolak;                            /* Baris yang ditolak */
+    int bulan_terdampak[13];                /* 1 jika bulan [1-12] mendapat transaksi baru */
+    char id_pertama[MAX_ID_LENGTH + 1];     /* ID transaksi pertama yang diberikan */
+    char id_terakhir[MAX_ID_LENGTH + 1];    /* ID transaksi terakhir yang diberikan */
+} HasilImpor;
+
+/**
+ * Callback pelaporan baris yang ditolak
+ */
+typedef void (*PelaporTolakImpor)(int nomor_baris, const char *pesan, void *konteks);
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk mengurai nama format impor.
+    Input : nama ("csv" atau "tsv", tidak peka huruf besar/kecil)
+    Output : Mengembalikan IMPOR_FORMAT_CSV/TSV, atau -1 jika tidak dikenal.
+*/
+int urai_format_impor(const char *nama);
+
+/*
+    Function bertujuan untuk mengimpor transaksi dari stream CSV/TSV dalam satu commit.
+    Input : in (Stream input), format (IMPOR_FORMAT_*), lapor (Callback baris ditolak, boleh NULL),
+            konteks (Data milik pemanggil untuk callback)
+    Output : hasil (Ringkasan impor). Mengembalikan 1 jika semua baris diterima sudah tersimpan
+             dan perhitungan ulang bulan terdampak sudah dijadwalkan, 0 jika gagal menulis atau
+             nomor ID transaksi habis (file transaksi tidak berubah).
+*/
+int impor_transaksi(FILE *in, int format, PelaporTolakImpor lapor, void *konteks, HasilImpor *hasil);
+
+#endif
@@ -0,0 +1,261 @@
+/*
+ * =============================================================================
+ * File        : instrumen.h
+ * Deskripsi   : Header file untuk modul instrumentasi (timer dan penghitung I/O)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini menyediakan instrumentasi ringan yang selalu aktif, termasuk:
+ * - Penghitung global: fopen, rename, byte dibaca/ditulis, baris diurai/diformat
+ * - Timer per fungsi (jumlah panggilan, total, dan waktu terlama)
+ * - Amplifikasi tulis per aksi pengguna (byte logis vs byte fisik)
+ * - Pengambilan statistik untuk layar diagnostik
+ * - Dump ke file log saat program keluar (opsional)
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - pthread.h   : Untuk pendaftaran titik ukur dari beberapa thread
+ * - time.h      : Untuk clock_gettime (CLOCK_MONOTONIC)
+ *
+ * CATATAN:
+ * INSTRUMEN_FUNGSI() di awal fungsi memasang timer berlingkup: waktu dicatat
+ * otomatis di setiap jalur return (atribut cleanup GCC/Clang). Biayanya dua
+ * pembacaan jam dan beberapa operasi atomik per panggilan; untuk penghitung
+ * hanya satu penambahan atomik. Kompilasi dengan -DINSTRUMEN_NONAKTIF
+ * menghapus seluruh instrumentasi dari kode.
+ * Waktu timer bersifat inklusif: fungsi yang memanggil fungsi terukur lain
+ * ikut menghitung waktu fungsi tersebut.
+ * Aksi pengguna (tambah/ubah/hapus, buka layar) dipasang per thread lewat
+ * INSTRUMEN_AKSI(); penghitung yang bertambah selama aksi aktif juga dicatat
+ * ke aksi tersebut. Pekerjaan latar belakang membawa aksi pengirimnya
+ * sehingga perhitungan ulang pos/analisis ikut terhitung pada aksi asal.
+ * =============================================================================
+ */
+
+#ifndef INSTRUMEN_H
+#define INSTRUMEN_H
+
+/* ===== KONSTANTA ===== */
+
+/* Penghitung */
+#define INS_FOPEN               0       /* File dibuka */
+#define INS_RENAME              1       /* File diganti lewat rename */
+#define INS_BYTE_BACA           2       /* Byte dibaca dari file data */
+#define INS_BYTE_TULIS          3       /* Byte ditulis ke file data */
+#define INS_BARIS_URAI          4       /* Baris file yang diurai */
+#define INS_BARIS_FORMAT        5       /* Baris file yang diformat */
+#define INS_JUMLAH_PENGHITUNG   6
+
+/* Aksi pengguna (0 = tidak ada aksi aktif) */
+#define AKSI_TIDAK_ADA          0
+#define AKSI_TAMBAH_TRANSAKSI   1
+#define AKSI_UBAH_TRANSAKSI     2
+#define AKSI_HAPUS_TRANSAKSI    3
+#define AKSI_TAMBAH_POS         4
+#define AKSI_UBAH_POS           5
+#define AKSI_HAPUS_POS          6
+#define AKSI_BUKA_LAYAR         7       /* Memuat layar daftar/analisis */
+#define INS_JUMLAH_AKSI         8
+
+#define ENV_LOG_INSTRUMEN       "KEUANGAN_DIAG_LOG"     /* Path log dump saat keluar */
+
+/* ===== STRUKTUR DATA ===== */
+
+/**
+ * Struct satu titik ukur (satu per fungsi, dibuat statis oleh makro)
+ */
+typedef struct TitikInstrumen {
+    const char *nama;                   /* Nama fungsi */
+    unsigned long long panggilan;       /* Jumlah panggilan */
+    unsigned long long total_ns;        /* Total waktu (inklusif) */
+    unsigned long long maks_ns;         /* Panggilan terlama */
+    int terdaftar;                      /* 1 jika sudah masuk daftar global */
+    struct TitikInstrumen *berikut;     /* Titik berikutnya di daftar global */
+} TitikInstrumen;
+
+/**
+ * Struct timer berlingkup yang sedang berjalan
+ */
+typedef struct {
+    TitikInstrumen *titik;              /* Titik yang diukur */
+    unsigned long long mulai_ns;        /* Waktu mulai */
+} PengukurInstrumen;
+
+/**
+ * Struct salinan statistik satu titik untuk ditampilkan
+ */
+typedef struct {
+    const char *nama;
+    unsigned long long panggilan;
+    unsigned long long total_ns;
+    unsigned long long maks_ns;
+} StatistikInstrumen;
+
+/**
+ * Struct salinan statistik satu jenis aksi pengguna
+ */
+typedef struct {
+    const char *nama;
+    unsigned long long jumlah;          /* Aksi yang selesai dengan berhasil */
+    unsigned long long byte_logis;      /* Byte data yang benar-benar berubah */
+    unsigned long long penghitung[INS_JUMLAH_PENGHITUNG]; /* Kerja fisik selama aksi */
+} StatistikAksi;
+
+/* ===== MAKRO INSTRUMENTASI ===== */
+
+extern unsigned long long instrumen_penghitung[INS_JUMLAH_PENGHITUNG];
+extern unsigned long long instrumen_penghitung_aksi[INS_JUMLAH_AKSI][INS_JUMLAH_PENGHITUNG];
+
+#if defined(INSTRUMEN_NONAKTIF) || !defined(__GNUC__)
+
+#define INSTRUMEN_TAMBAH(penghitung, n)     ((void)(penghitung), (void)(n))
+#define INSTRUMEN_FUNGSI()                  ((void)0)
+#define INSTRUMEN_AKSI(aksi)                ((void)(aksi))
+#define INSTRUMEN_AKSI_SELESAI(aksi, n)     ((void)(aksi), (void)(n))
+
+#else
+
+extern __thread int instrumen_aksi_aktif;
+
+/**
+ * Helper: Menambah penghitung global dan penghitung aksi aktif secara atomik
+ */
+static inline void instrumen_tambah(int penghitung, unsigned long long n) {
+    __atomic_fetch_add(&instrumen_penghitung[penghitung], n, __ATOMIC_RELAXED);
+    if (instrumen_aksi_aktif) {
+        __atomic_fetch_add(&instrumen_penghitung_aksi[instrumen_aksi_aktif][penghitung],
+                           n, __ATOMIC_RELAXED);
+    }
+}
+
+/* Menambah penghitung (aman dari thread pekerja) */
+#define INSTRUMEN_TAMBAH(penghitung, n) \
+    instrumen_tambah((penghitung), (unsigned long long)(n))
+
+/* Memasang aksi pengguna pada thread ini sampai akhir lingkup */
+#define INSTRUMEN_AKSI(aksi) \
+    int ins_aksi_lama_ __attribute__((cleanup(instrumen_aksi_pulihkan))) = \
+        instrumen_aksi_masuk(aksi)
+
+/* Mencatat satu aksi berhasil beserta byte logis yang diubahnya */
+#define INSTRUMEN_AKSI_SELESAI(aksi, n) \
+    instrumen_aksi_selesai((aksi), (unsigned long long)(n))
+
+/* Timer berlingkup untuk fungsi saat ini, dicatat saat keluar lingkup */
+#define INSTRUMEN_FUNGSI() \
+    static TitikInstrumen ins_titik_ = { __func__, 0, 0, 0, 0, 0 }; \
+    PengukurInstrumen ins_ukur_ __attribute__((cleanup(instrumen_selesai))) = \
+        instrumen_mulai(&ins_titik_)
+
+#endif
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk memulai timer pada titik ukur (dipakai lewat INSTRUMEN_FUNGSI).
+    Input : titik (Titik ukur statis)
+    Output : Mengembalikan pengukur yang berisi waktu mulai.
+*/
+PengukurInstrumen instrumen_mulai(TitikInstrumen *titik);
+
+/*
+    Procedure bertujuan untuk mencatat waktu pengukur yang selesai (dipakai lewat INSTRUMEN_FUNGSI).
+    I. S. : p berisi waktu mulai
+    F. S. : Panggilan, total, dan maksimum titik diperbarui.
+*/
+void instrumen_selesai(PengukurInstrumen *p);
+
+/*
+    Function bertujuan untuk memasang aksi pengguna pada thread saat ini.
+    Input : aksi (AKSI_*, AKSI_TIDAK_ADA untuk melepas)
+    Output : Mengembalikan aksi yang sebelumnya terpasang.
+*/
+int instrumen_aksi_masuk(int aksi);
+
+/*
+    Procedure bertujuan untuk memulihkan aksi sebelumnya (dipakai lewat INSTRUMEN_AKSI).
+    I. S. : sebelumnya berisi nilai kembalian instrumen_aksi_masuk
+    F. S. : Aksi thread kembali seperti sebelum INSTRUMEN_AKSI.
+*/
+void instrumen_aksi_pulihkan(int *sebelumnya);
+
+/*
+    Function bertujuan untuk mengambil aksi yang terpasang pada thread saat ini.
+    Input : -
+    Output : Mengembalikan AKSI_* yang aktif.
+*/
+int instrumen_aksi_sekarang(void);
+
+/*
+    Procedure bertujuan untuk mencatat satu aksi berhasil (dipakai lewat INSTRUMEN_AKSI_SELESAI).
+    I. S. : Aksi sudah dikerjakan
+    F. S. : Jumlah aksi bertambah 1 dan byte logis ditambahkan.
+*/
+void instrumen_aksi_selesai(int aksi, unsigned long long byte_logis);
+
+/*
+    Function bertujuan untuk mendapatkan nama aksi.
+    Input : aksi (AKSI_*)
+    Output : Mengembalikan nama singkat aksi.
+*/
+const char* instrumen_nama_aksi(int aksi);
+
+/*
+    Function bertujuan untuk menyalin statistik aksi yang pernah terjadi.
+    Input : hasil (Array minimal INS_JUMLAH_AKSI elemen)
+    Output : Mengembalikan jumlah aksi yang disalin (urut AKSI_*).
+*/
+int instrumen_ambil_statistik_aksi(StatistikAksi *hasil);
+
+/*
+    Function bertujuan untuk menghitung amplifikasi satu aksi.
+    Input : stat (Statistik aksi), hanya_tulis (1: byte tulis saja, 0: byte baca+tulis)
+    Output : Mengembalikan byte fisik per byte logis, 0 jika tidak ada byte logis.
+*/
+double instrumen_amplifikasi_aksi(const StatistikAksi *stat, int hanya_tulis);
+
+/*
+    Function bertujuan untuk membaca nilai penghitung.
+    Input : penghitung (INS_*)
+    Output : Mengembalikan nilai saat ini.
+*/
+unsigned long long instrumen_ambil_penghitung(int penghitung);
+
+/*
+    Function bertujuan untuk mendapatkan nama penghitung.
+    Input : penghitung (INS_*)
+    Output : Mengembalikan nama singkat penghitung.
+*/
+const char* instrumen_nama_penghitung(int penghitung);
+
+/*
+    Function bertujuan untuk menyalin statistik semua titik ukur, urut total waktu terbesar.
+    Input : hasil (Array tujuan), maks (Kapasitas array)
+    Output : Mengembalikan jumlah titik yang disalin.
+*/
+int instrumen_ambil_statistik(StatistikInstrumen *hasil, int maks);
+
+/*
+    Procedure bertujuan untuk mengosongkan semua penghitung dan timer.
+    I. S. : Statistik berisi nilai sejak awal program atau reset terakhir
+    F. S. : Semua nilai kembali 0.
+*/
+void instrumen_reset(void);
+
+/*
+    Function bertujuan untuk menambahkan dump statistik ke file log.
+    Input : path (Path file log)
+    Output : Mengembalikan 1 jika berhasil ditulis, 0 jika gagal.
+*/
+int instrumen_tulis_log(const char *path);
+
+/*
+    Procedure bertujuan untuk memasang dump otomatis saat program keluar.
+    I. S. : Variabel lingkungan KEUANGAN_DIAG_LOG mungkin berisi path
+    F. S. : Jika diisi, statistik ditulis ke path tersebut saat exit.
+*/
+void instrumen_pasang_log_keluar(void);
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * =============================================================================
+ * File        : keuangan.h
+ * Deskripsi   : Header payung untuk libkeuangan.a (mesin tanpa TUI)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Header ini menyertakan seluruh API mesin aplikasi keuangan, termasuk:
+ * - Penyimpanan file transaksi, pos, dan analisis
+ * - CRUD dan perhitungan transaksi, pos anggaran, dan analisis
+ * - Ekspor, impor, thread pekerja, pemuatan paralel, arsip, tutup periode, manifes, dan instrumentasi
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - file.h, transaksi.h, pos.h, analisis.h, utils.h
+ * - ekspor.h, impor.h, pekerja.h, instrumen.h, kolam.h, muat_paralel.h, rekap.h, arsip.h,
+ *   periode.h, manifes.h
+ *
+ * CATATAN:
+ * Program yang hanya menyertakan header ini cukup ditautkan dengan
+ * libkeuangan.a dan -lpthread, tanpa -lncurses. Layar TUI dideklarasikan
+ * terpisah di tui.h dan layar_*.h.
+ * =============================================================================
+ */
+
+#ifndef KEUANGAN_H
+#define KEUANGAN_H
+
+#include "utils.h"
+#include "transaksi.h"
+#include "pos.h"
+#include "analisis.h"
+#include "file.h"
+#include "ekspor.h"
+#include "impor.h"
+#include "pekerja.h"
+#include "instrumen.h"
+#include "kolam.h"
+#include "muat_paralel.h"
+#include "rekap.h"
+#include "arsip.h"
+#include "periode.h"
+#include "manifes.h"
+
+#endif
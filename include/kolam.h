@@ -0,0 +1,79 @@
+/*
+ * =============================================================================
+ * File        : kolam.h
+ * Deskripsi   : Header file untuk modul kolam thread (thread pool) mesin
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini menyediakan kolam thread kecil dengan pencurian kerja
+ * (work stealing) untuk komputasi paralel di dalam mesin, termasuk:
+ * - Menjalankan tugas bernomor 0..n-1 di semua core (fork-join)
+ * - Antrian rentang tugas per thread; thread yang menganggur mencuri
+ *   separuh rentang thread lain
+ * - Pengaturan jumlah thread untuk seluruh kerja paralel mesin
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - pthread.h   : Untuk thread, mutex, dan condition variable
+ * - instrumen.h : Untuk membawa aksi pengguna ke thread kolam
+ *
+ * CATATAN:
+ * Thread kolam dibuat saat kolam_jalankan pertama kali dipanggil dan hidup
+ * sampai kolam_hentikan. Thread pemanggil ikut mengerjakan tugas. Satu batch
+ * berjalan pada satu waktu; pemanggil lain menunggu giliran. Tugas yang
+ * memanggil kolam_jalankan lagi dijalankan berurutan di thread itu, sehingga
+ * pemanggilan bersarang tidak pernah deadlock.
+ * Kolam ini terpisah dari thread pekerja (pekerja.h): pekerja mengurutkan
+ * pekerjaan latar belakang, kolam memecah satu pekerjaan menjadi tugas paralel.
+ * =============================================================================
+ */
+
+#ifndef KOLAM_H
+#define KOLAM_H
+
+/* ===== KONSTANTA ===== */
+
+#define MAKS_THREAD_KOLAM       64                  /* Batas atas jumlah thread */
+#define ENV_THREAD_KOLAM        "KEUANGAN_THREAD"   /* Jumlah thread (0 = otomatis) */
+
+/* ===== TIPE DATA ===== */
+
+/**
+ * Callback satu tugas kolam.
+ * Dipanggil sekali untuk setiap indeks 0..jumlah_tugas-1, dari thread mana saja.
+ */
+typedef void (*FungsiTugas)(void *konteks, int indeks);
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Procedure bertujuan untuk mengatur jumlah thread kerja paralel mesin.
+    I. S. : Jumlah thread default otomatis (jumlah core online)
+    F. S. : Batch berikutnya memakai jumlah thread (0 = otomatis, 1 = berurutan).
+*/
+void kolam_atur_thread(int jumlah);
+
+/*
+    Function bertujuan untuk mendapatkan jumlah thread kerja paralel yang berlaku.
+    Input : -
+    Output : Mengembalikan jumlah thread termasuk thread pemanggil (1..MAKS_THREAD_KOLAM).
+*/
+int kolam_ambil_thread(void);
+
+/*
+    Function bertujuan untuk menjalankan tugas 0..jumlah_tugas-1 secara paralel dan menunggu semuanya.
+    Input : fungsi (Callback tugas), konteks (Data bersama untuk callback), jumlah_tugas (Banyak tugas)
+    Output : Semua tugas selesai saat kembali. Mengembalikan jumlah thread yang ikut bekerja.
+*/
+int kolam_jalankan(FungsiTugas fungsi, void *konteks, int jumlah_tugas);
+
+/*
+    Procedure bertujuan untuk menghentikan thread kolam.
+    I. S. : Thread kolam mungkin berjalan
+    F. S. : Semua thread kolam berhenti; kolam_jalankan berikutnya membuatnya lagi.
+*/
+void kolam_hentikan(void);
+
+#endif
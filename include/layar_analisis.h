@@ -0,0 +1,75 @@
+/*
+ * =============================================================================
+ * File        : layar_analisis.h
+ * Deskripsi   : Header file untuk layar TUI analisis keuangan
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini berisi layar interaktif untuk analisis keuangan, termasuk:
+ * - Laporan keuangan bulanan, grafik sederhana, dan saran
+ * - Daftar transaksi terfilter per jenis
+ * - Menu ekspor data
+ * - Menu dan handler modul analisis
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - analisis.h  : Untuk struct AnalisisKeuangan
+ *
+ * CATATAN:
+ * Deklarasi ini dipisahkan dari analisis.h agar mesin (libkeuangan.a) tidak
+ * bergantung pada ncurses. Hanya aplikasi TUI yang menyertakan header ini.
+ * =============================================================================
+ */
+
+#ifndef LAYAR_ANALISIS_H
+#define LAYAR_ANALISIS_H
+
+#include "analisis.h"
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Procedure bertujuan untuk menampilkan analisis keuangan lengkap untuk bulan.
+    I. S. : bulan (Nomor bulan valid)
+    F. S. : Analisis ditampilkan di layar.
+*/
+void tampilkan_analisis_bulan(int bulan);
+
+/*
+    Function bertujuan untuk menampilkan ringkasan kondisi keuangan.
+    Input : analisis (Pointer ke data analisis), start_y (Baris awal tampilan)
+    Output : Mengembalikan posisi baris berikutnya.
+*/
+int tampilkan_ringkasan_kondisi(AnalisisKeuangan *analisis, int start_y);
+
+/*
+    Function bertujuan untuk menampilkan grafik sederhana perbandingan pemasukan/pengeluaran.
+    Input : analisis (Pointer ke data analisis), start_y (Baris awal tampilan)
+    Output : Mengembalikan posisi baris berikutnya.
+*/
+int tampilkan_grafik_sederhana(AnalisisKeuangan *analisis, int start_y);
+
+/*
+    Function bertujuan untuk menampilkan saran berdasarkan kesimpulan.
+    Input : kesimpulan (Kode kesimpulan), start_y (Baris awal tampilan)
+    Output : Mengembalikan posisi baris berikutnya.
+*/
+int tampilkan_saran(int kesimpulan, int start_y);
+
+/*
+    Procedure bertujuan untuk menjalankan modul analisis keuangan.
+    I. S. : bulan_awal (Bulan awal saat modul dijalankan, valid)
+    F. S. : Modul analisis dijalankan hingga pengguna kembali.
+*/
+void jalankan_modul_analisis(int bulan_awal);
+
+/*
+    Function bertujuan untuk menampilkan menu analisis keuangan.
+    Input : bulan (Bulan aktif)
+    Output : Mengembalikan kode aksi yang dipilih.
+*/
+int menu_analisis_utama(int bulan);
+
+#endif
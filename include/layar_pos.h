@@ -0,0 +1,155 @@
+/*
+ * =============================================================================
+ * File        : layar_pos.h
+ * Deskripsi   : Header file untuk layar TUI pos anggaran
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini berisi layar interaktif untuk pos anggaran, termasuk:
+ * - Daftar pos dengan snapshot dan viewport tabel
+ * - Form tambah, edit, dan konfirmasi hapus pos
+ * - Pemilihan pos dan pemilihan bulan
+ * - Inisialisasi pos bulan baru (dengan konfirmasi salin dari bulan lalu)
+ * - Menu dan handler modul pos
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - tui.h       : Untuk TableViewport dan fungsi tampilan
+ * - pos.h       : Untuk struct PosAnggaran dan SnapshotPos
+ *
+ * CATATAN:
+ * Deklarasi ini dipisahkan dari pos.h agar mesin (libkeuangan.a) tidak
+ * bergantung pada ncurses. Hanya aplikasi TUI yang menyertakan header ini.
+ * =============================================================================
+ */
+
+#ifndef LAYAR_POS_H
+#define LAYAR_POS_H
+
+#include "tui.h"
+#include "pos.h"
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk menampilkan daftar pos anggaran dengan kalkulasi.
+    Input : bulan (Nomor bulan), selected (Index pos yang dipilih), view (Viewport tabel, boleh NULL)
+    Output : Mengembalikan posisi baris berikutnya setelah tabel.
+*/
+int tampilkan_daftar_pos(int bulan, int selected, TableViewport *view);
+
+/*
+    Function bertujuan untuk menampilkan detail satu pos anggaran.
+    Input : pos (Pointer ke data pos), start_y (Baris awal tampilan)
+    Output : Mengembalikan posisi baris berikutnya setelah detail.
+*/
+int tampilkan_detail_pos(PosAnggaran *pos, int start_y);
+
+/*
+    Function bertujuan untuk menampilkan ringkasan pos anggaran bulan.
+    Input : bulan (Nomor bulan), start_y (Baris awal tampilan)
+    Output : Mengembalikan posisi baris berikutnya setelah ringkasan.
+*/
+int tampilkan_ringkasan_pos(int bulan, int start_y);
+
+/*
+    Function bertujuan untuk menampilkan daftar pos dari snapshot tanpa membaca file.
+    Input : snap (Snapshot pos), selected (Index pos yang dipilih), view (Viewport tabel, boleh NULL)
+    Output : Mengembalikan posisi baris berikutnya setelah tabel.
+*/
+int tampilkan_daftar_snapshot_pos(const SnapshotPos *snap, int selected, TableViewport *view);
+
+/*
+    Function bertujuan untuk menampilkan ringkasan pos dari total yang tersimpan di snapshot.
+    Input : snap (Snapshot pos), start_y (Baris awal tampilan)
+    Output : Mengembalikan posisi baris berikutnya setelah ringkasan.
+*/
+int tampilkan_ringkasan_snapshot_pos(const SnapshotPos *snap, int start_y);
+
+/*
+    Function bertujuan untuk menampilkan form tambah pos.
+    Input : bulan (Nomor bulan untuk pos baru)
+    Output : Mengembalikan 1 jika berhasil tambah, 0 jika dibatalkan.
+*/
+int tampilkan_form_tambah_pos(int bulan);
+
+/*
+    Function bertujuan untuk menampilkan form edit pos.
+    Input : no (Nomor pos), bulan (Nomor bulan)
+    Output : Mengembalikan 1 jika berhasil edit, 0 jika dibatalkan.
+*/
+int tampilkan_form_edit_pos(int no, int bulan);
+
+/*
+    Function bertujuan untuk menampilkan konfirmasi hapus pos.
+    Input : no (Nomor pos), bulan (Nomor bulan)
+    Output : Mengembalikan 1 jika berhasil hapus, 0 jika dibatalkan.
+*/
+int tampilkan_konfirmasi_hapus_pos(int no, int bulan);
+
+/*
+    Function bertujuan untuk menampilkan pilihan pos untuk input transaksi.
+    Input : bulan (Nomor bulan)
+    Output : result (Buffer untuk menyimpan nama pos terpilih). Mengembalikan 1 jika dipilih, 0 jika dibatalkan.
+*/
+int tampilkan_pilih_pos(int bulan, char *result);
+
+/*
+    Procedure bertujuan untuk menjalankan modul pos anggaran.
+    I. S. : bulan_awal (Bulan awal saat modul dijalankan, valid)
+    F. S. : Modul pos dijalankan hingga pengguna kembali.
+*/
+void jalankan_modul_pos(int bulan_awal);
+
+/*
+    Function bertujuan untuk menginisialisasi data pos untuk bulan baru.
+    Input : bulan (Bulan yang akan diinisialisasi)
+    Output : Mengembalikan 1 jika berhasil, 0 jika gagal.
+*/
+int inisialisasi_pos_untuk_bulan(int bulan);
+
+/*
+    Function bertujuan untuk menampilkan dan menjalankan menu utama pos anggaran.
+    Input : bulan (Bulan aktif)
+    Output : Mengembalikan kode aksi yang dipilih.
+*/
+int menu_pos_utama(int bulan);
+
+/*
+    Function bertujuan untuk menampilkan menu pilih bulan.
+    Input : bulan_saat_ini (Bulan saat ini)
+    Output : Mengembalikan bulan yang dipilih, atau 0 jika dibatalkan.
+*/
+int menu_pilih_bulan(int bulan_saat_ini);
+
+/*
+    Procedure bertujuan untuk menangani tampilan daftar pos dengan navigasi.
+    I. S. : bulan (Nomor bulan valid)
+    F. S. : Pengguna kembali dari tampilan.
+*/
+void penanganan_lihat_pos(int bulan);
+
+/*
+    Procedure bertujuan untuk menangani tambah pos baru.
+    I. S. : bulan (Nomor bulan valid)
+    F. S. : Pos baru ditambahkan jika pengguna konfirmasi.
+*/
+void penanganan_tambah_pos(int bulan);
+
+/*
+    Procedure bertujuan untuk menangani edit pos.
+    I. S. : bulan (Nomor bulan valid)
+    F. S. : Pos diedit jika pengguna konfirmasi.
+*/
+void penanganan_ubah_pos(int bulan);
+
+/*
+    Procedure bertujuan untuk menangani hapus pos.
+    I. S. : bulan (Nomor bulan valid)
+    F. S. : Pos dihapus jika pengguna konfirmasi.
+*/
+void penanganan_hapus_pos(int bulan);
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ * =============================================================================
+ * File        : layar_transaksi.h
+ * Deskripsi   : Header file untuk layar TUI transaksi keuangan
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini berisi layar interaktif untuk transaksi keuangan, termasuk:
+ * - Daftar transaksi dengan snapshot dan viewport tabel
+ * - Form tambah dan edit transaksi
+ * - Konfirmasi hapus transaksi
+ * - Menu dan handler modul transaksi
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - tui.h       : Untuk TableViewport dan fungsi tampilan
+ * - transaksi.h : Untuk struct Transaksi dan SnapshotTransaksi
+ *
+ * CATATAN:
+ * Deklarasi ini dipisahkan dari transaksi.h agar mesin (libkeuangan.a) tidak
+ * bergantung pada ncurses. Hanya aplikasi TUI yang menyertakan header ini.
+ * =============================================================================
+ */
+
+#ifndef LAYAR_TRANSAKSI_H
+#define LAYAR_TRANSAKSI_H
+
+#include "tui.h"
+#include "transaksi.h"
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk menampilkan daftar transaksi bulan.
+    Input : bulan (Nomor bulan), selected (Index terpilih), view (Viewport tabel, boleh NULL)
+    Output : Mengembalikan posisi baris berikutnya setelah tabel.
+*/
+int tampilkan_daftar_transaksi(int bulan, int selected, TableViewport *view);
+
+/*
+    Function bertujuan untuk menampilkan detail satu transaksi.
+    Input : trx (Pointer ke transaksi), start_y (Baris awal)
+    Output : Mengembalikan posisi baris berikutnya setelah detail.
+*/
+int tampilkan_detail_transaksi(Transaksi *trx, int start_y);
+
+/*
+    Function bertujuan untuk menampilkan ringkasan transaksi bulan.
+    Input : bulan (Nomor bulan), start_y (Baris awal)
+    Output : Mengembalikan posisi baris berikutnya setelah ringkasan.
+*/
+int tampilkan_ringkasan_transaksi(int bulan, int start_y);
+
+/*
+    Function bertujuan untuk menampilkan daftar transaksi dari snapshot tanpa membaca file.
+    Input : snap (Snapshot transaksi), selected (Index terpilih), view (Viewport tabel, boleh NULL)
+    Output : Mengembalikan posisi baris berikutnya setelah tabel.
+*/
+int tampilkan_daftar_snapshot_transaksi(const SnapshotTransaksi *snap, int selected, TableViewport *view);
+
+/*
+    Function bertujuan untuk menampilkan ringkasan transaksi dari total yang tersimpan di snapshot.
+    Input : snap (Snapshot transaksi), start_y (Baris awal)
+    Output : Mengembalikan posisi baris berikutnya setelah ringkasan.
+*/
+int tampilkan_ringkasan_snapshot_transaksi(const SnapshotTransaksi *snap, int start_y);
+
+/*
+    Function bertujuan untuk menampilkan form tambah transaksi.
+    Input : bulan (Bulan default)
+    Output : Mengembalikan 1 jika berhasil tambah, 0 jika dibatalkan.
+*/
+int tampilkan_form_tambah_transaksi(int bulan);
+
+/*
+    Function bertujuan untuk menampilkan form edit transaksi.
+    Input : id (ID transaksi)
+    Output : Mengembalikan 1 jika berhasil edit, 0 jika dibatalkan.
+*/
+int tampilkan_form_edit_transaksi(const char *id);
+
+/*
+    Function bertujuan untuk menampilkan konfirmasi hapus transaksi.
+    Input : id (ID transaksi)
+    Output : Mengembalikan 1 jika berhasil hapus, 0 jika dibatalkan.
+*/
+int tampilkan_konfirmasi_hapus_transaksi(const char *id);
+
+/*
+    Procedure bertujuan untuk menjalankan modul transaksi.
+    I. S. : bulan_awal (Bulan awal saat modul dijalankan, valid)
+    F. S. : Modul transaksi dijalankan hingga pengguna kembali.
+*/
+void jalankan_modul_transaksi(int bulan_awal);
+
+/*
+    Function bertujuan untuk menampilkan menu utama transaksi.
+    Input : bulan (Bulan aktif)
+    Output : Mengembalikan kode aksi yang dipilih.
+*/
+int menu_transaksi_utama(int bulan);
+
+/*
+    Procedure bertujuan untuk menangani tampilan daftar transaksi.
+    I. S. : bulan (Nomor bulan valid)
+    F. S. : Pengguna kembali dari tampilan.
+*/
+void penanganan_lihat_transaksi(int bulan);
+
+/*
+    Procedure bertujuan untuk menangani tambah transaksi.
+    I. S. : bulan (Nomor bulan valid)
+    F. S. : Transaksi baru ditambahkan jika pengguna konfirmasi.
+*/
+void penanganan_tambah_transaksi(int bulan);
+
+/*
+    Procedure bertujuan untuk menangani edit transaksi.
+    I. S. : bulan (Nomor bulan valid)
+    F. S. : Transaksi diedit jika pengguna konfirmasi.
+*/
+void penanganan_ubah_transaksi(int bulan);
+
+/*
+    Procedure bertujuan untuk menangani hapus transaksi.
+    I. S. : bulan (Nomor bulan valid)
+    F. S. : Transaksi dihapus jika pengguna konfirmasi.
+*/
+void penanganan_hapus_transaksi(int bulan);
+
+/*
+    Procedure bertujuan untuk memindahkan baris rusak file transaksi ke file .rusak.
+    I. S. : Pengguna memilih Rapikan File Transaksi, antrian pekerja sudah kosong
+    F. S. : Setelah konfirmasi, baris rusak dipindah dan jumlahnya ditampilkan.
+*/
+void penanganan_rapikan_file_transaksi(void);
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * =============================================================================
+ * File        : manifes.h
+ * Deskripsi   : Header file untuk modul manifes data (validasi saat mulai)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mencatat keadaan setiap file di direktori data ke data/manifes.txt
+ * agar saat aplikasi dimulai cukup membandingkan stat file, termasuk:
+ * - Inode, ukuran, mtime, dan hash isi per file (buku besar, snapshot, pos, analisis)
+ * - Checksum transaksi per bulan untuk menentukan bulan yang terdampak
+ * - Versi cache turunan (pos dan analisis) yang dipakai saat manifes ditulis
+ * - Pembangunan ulang pos dan analisis hanya untuk bulan yang berubah
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - (tidak ada, hanya tipe dasar)
+ *
+ * CATATAN:
+ * Format file (baris dipisah newline):
+ *   MANIFES|versi|versi_cache|jumlah_file
+ *   FILE|nama|peran|bulan|inode|device|ukuran|mtime_detik|mtime_nano|hash   (per file)
+ *   BULAN|bulan|jumlah_transaksi|hash                          (bulan 1-12)
+ *   AKHIR|hash_manifes
+ * Hash berupa FNV-1a 64-bit (16 digit heksadesimal). Hash bulan adalah jumlah
+ * hash tiap baris transaksi bulan itu (arsip dan transaksi.txt), sehingga
+ * segel/buka segel dan kompaksi tidak dianggap perubahan. File yang stat-nya
+ * sama dengan manifes dipercaya tanpa dibaca; file yang stat-nya berbeda
+ * di-hash dulu, dan baru dianggap berubah jika hash isinya berbeda.
+ * =============================================================================
+ */
+
+#ifndef MANIFES_H
+#define MANIFES_H
+
+/* ===== KONSTANTA ===== */
+
+#define FILE_MANIFES_NAME       "manifes.txt"   /* Nama file manifes di direktori data */
+#define PENANDA_MANIFES         "MANIFES"       /* Kolom pertama baris kepala */
+#define VERSI_MANIFES           2               /* Versi format file manifes */
+#define VERSI_CACHE_TURUNAN     1               /* Naikkan jika format/perhitungan pos atau analisis berubah */
+
+/* Peran file dalam manifes */
+#define PERAN_BUKU              0       /* Partisi buku besar: transaksi.txt dan arsip_YYYY.bin */
+#define PERAN_TUTUP             1       /* Snapshot bulan tertutup tutup_MM.txt */
+#define PERAN_POS               2       /* Cache turunan pos_MM.txt */
+#define PERAN_ANALISIS          3       /* Cache turunan analisis_MM.txt */
+
+/* ===== STRUKTUR DATA ===== */
+
+/**
+ * Struct ringkasan hasil pemeriksaan manifes
+ */
+typedef struct {
+    int file_diperiksa;         /* File data yang ada saat ini */
+    int file_dibaca;            /* File yang stat-nya berbeda sehingga di-hash ulang */
+    int file_berubah;           /* File yang isinya berbeda, baru, atau hilang */
+    int buku_dipindai;          /* 1 jika transaksi dipindai ulang untuk checksum bulan */
+    int bulan_dibangun[13];     /* Indeks 1-12: 1 jika pos/analisis bulan dibangun ulang */
+    int jumlah_bulan_dibangun;
+} HasilManifes;
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk memvalidasi data terhadap manifes dan membangun ulang yang berubah.
+    Input : hasil (Pointer ringkasan hasil, boleh NULL)
+    Output : Pos dan analisis bulan yang buku besar, snapshot, atau file turunannya berubah (atau semua
+             bulan berdata jika manifes belum ada/versi cache berbeda) dihitung ulang, lalu manifes
+             ditulis ulang jika ada yang berbeda. Mengembalikan 1 jika berhasil, 0 jika gagal.
+*/
+int sinkronkan_manifes(HasilManifes *hasil);
+
+/*
+    Function bertujuan untuk mencatat keadaan data saat ini ke manifes tanpa membangun ulang.
+    Input : hasil (Pointer ringkasan hasil, boleh NULL)
+    Output : Manifes ditulis ulang jika ada file yang berbeda. Dipakai setelah aplikasi sendiri
+             menyelesaikan semua perhitungan ulang. Mengembalikan 1 jika berhasil, 0 jika gagal.
+*/
+int catat_manifes(HasilManifes *hasil);
+
+#endif
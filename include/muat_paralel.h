@@ -0,0 +1,60 @@
+/*
+ * =============================================================================
+ * File        : muat_paralel.h
+ * Deskripsi   : Header file untuk modul pemuatan file transaksi secara paralel
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini memuat file transaksi berukuran besar dengan beberapa thread,
+ * termasuk:
+ * - Pemetaan file ke memori (mmap) tanpa salinan ke buffer stdio
+ * - Pembagian file menjadi potongan yang berakhir tepat di newline
+ * - Parsing tiap potongan sebagai tugas kolam thread dengan urai_baris_transaksi
+ * - Penggabungan hasil sesuai urutan baris di file
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - kolam.h     : Untuk menjalankan potongan di kolam thread
+ * - sys/mman.h  : Untuk mmap file transaksi
+ * - file.h      : Untuk urai_baris_transaksi dan nama file transaksi
+ * - utils.h     : Untuk ListTransaksi dan urai_tanggal_struct
+ *
+ * CATATAN:
+ * Hasil pemuatan paralel sama persis dengan penelusuran fgets berurutan,
+ * termasuk pemotongan baris yang lebih panjang dari MAX_LINE_LENGTH.
+ * muat_transaksi, muat_transaksi_bulan, dan muat_transaksi_ke_list memakai
+ * modul ini otomatis jika file minimal AMBANG_MUAT_PARALEL byte dan jumlah
+ * thread kolam (kolam_ambil_thread) lebih dari satu.
+ * =============================================================================
+ */
+
+#ifndef MUAT_PARALEL_H
+#define MUAT_PARALEL_H
+
+#include "transaksi.h"
+
+/* ===== KONSTANTA ===== */
+
+#define AMBANG_MUAT_PARALEL     (1024 * 1024)   /* Ukuran file minimal untuk paralel */
+#define POTONGAN_MIN_PARALEL    (256 * 1024)    /* Ukuran potongan minimal per thread */
+#define POTONGAN_PER_THREAD     4               /* Potongan per thread agar beban rata */
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk memeriksa apakah file sebaiknya dimuat paralel.
+    Input : filename (Path file transaksi)
+    Output : Mengembalikan 1 jika thread > 1 dan ukuran file >= AMBANG_MUAT_PARALEL, 0 jika tidak.
+*/
+int muat_paralel_dianjurkan(const char *filename);
+
+/*
+    Function bertujuan untuk memuat transaksi dari file secara paralel ke list dinamis.
+    Input : list (ListTransaksi yang sudah diinisialisasi), bulan (Filter bulan 1-12, 0 untuk semua)
+    Output : list berisi transaksi sesuai urutan file. Mengembalikan jumlah transaksi, atau -1 jika gagal.
+*/
+int muat_transaksi_paralel(ListTransaksi *list, int bulan);
+
+#endif
@@ -0,0 +1,117 @@
+/*
+ * =============================================================================
+ * File        : pekerja.h
+ * Deskripsi   : Header file untuk modul pekerja latar belakang (worker thread)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini menyediakan satu thread pekerja dengan antrian pekerjaan FIFO
+ * untuk perhitungan ulang yang berat, sehingga antarmuka tidak membeku
+ * setelah data disimpan, termasuk:
+ * - Perhitungan ulang realisasi pos anggaran per bulan
+ * - Penyegaran file analisis per bulan
+ * - Validasi dan pencatatan manifes data
+ * - Pemanasan data bulan aktif selama splash screen
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - pthread.h   : Untuk thread, mutex, dan condition variable
+ * - pos.h       : Untuk perhitungan ulang pos anggaran
+ * - analisis.h  : Untuk penyegaran analisis
+ * - file.h      : Untuk pemanasan cache transaksi
+ * - manifes.h   : Untuk validasi manifes saat mulai dan pencatatan saat keluar
+ * - periode.h   : Untuk memuat ringkasan bulan tertutup ke cache
+ *
+ * CATATAN:
+ * Pekerjaan dijalankan berurutan sesuai urutan pengiriman. Setiap pekerjaan
+ * mendapat nomor tiket yang naik monoton; tiket selesai juga naik monoton,
+ * sehingga "tiket t selesai" berarti semua pekerjaan sebelum t juga selesai.
+ * Layar yang membaca atau mengubah data wajib menunggu antrian kosong lebih
+ * dahulu (lihat tui_tunggu_pekerja) agar tidak pernah melihat data setengah
+ * diperbarui. Jika thread belum dimulai, pekerjaan dijalankan langsung.
+ * =============================================================================
+ */
+
+#ifndef PEKERJA_H
+#define PEKERJA_H
+
+/* ===== KONSTANTA ===== */
+
+/* Jenis Pekerjaan */
+#define PEKERJA_HITUNG_POS          1   /* Hitung ulang semua pos dalam bulan */
+#define PEKERJA_REFRESH_ANALISIS    2   /* Hitung dan simpan ulang analisis bulan */
+#define PEKERJA_MANIFES             4   /* Validasi manifes dan bangun ulang bulan yang berubah */
+#define PEKERJA_CATAT_MANIFES       5   /* Catat keadaan data ke manifes tanpa membangun ulang */
+#define PEKERJA_HANGATKAN           6   /* Muat transaksi dan ringkasan bulan ke cache memori */
+
+#define MAX_ANTRIAN_PEKERJA         64  /* Kapasitas antrian pekerjaan */
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk memulai thread pekerja.
+    Input : -
+    Output : Mengembalikan 1 jika thread berjalan, 0 jika gagal (pekerjaan akan dijalankan langsung).
+*/
+int pekerja_mulai(void);
+
+/*
+    Procedure bertujuan untuk menghentikan thread pekerja setelah antrian habis.
+    I. S. : Thread pekerja mungkin berjalan dengan antrian berisi
+    F. S. : Semua pekerjaan tersisa selesai dan thread dihentikan.
+*/
+void pekerja_hentikan(void);
+
+/*
+    Function bertujuan untuk mengirim pekerjaan ke antrian.
+    Input : jenis (PEKERJA_*), bulan (Bulan 1-12, diabaikan untuk manifes)
+    Output : Mengembalikan nomor tiket pekerjaan. Pekerjaan sama yang belum dimulai digabung.
+*/
+unsigned long pekerja_kirim(int jenis, int bulan);
+
+/*
+    Function bertujuan untuk memeriksa apakah pekerjaan dengan tiket tertentu sudah selesai.
+    Input : tiket (Nomor tiket dari pekerja_kirim)
+    Output : Mengembalikan 1 jika selesai, 0 jika masih antri/berjalan.
+*/
+int pekerja_selesai(unsigned long tiket);
+
+/*
+    Function bertujuan untuk memeriksa apakah masih ada pekerjaan antri atau berjalan.
+    Input : -
+    Output : Mengembalikan 1 jika sibuk, 0 jika antrian kosong.
+*/
+int pekerja_sibuk(void);
+
+/*
+    Procedure bertujuan untuk menunggu (memblokir) sampai antrian kosong.
+    I. S. : Antrian mungkin berisi
+    F. S. : Semua pekerjaan yang sudah dikirim selesai.
+*/
+void pekerja_tunggu_semua(void);
+
+/*
+    Procedure bertujuan untuk mengaktifkan atau menonaktifkan mode tunda saat thread tidak berjalan.
+    I. S. : Thread pekerja tidak berjalan (mode batch/CLI)
+    F. S. : Jika aktif, pekerjaan dikumpulkan (digabung bila sama) dan baru dijalankan oleh
+            pekerja_jalankan_tertunda, sehingga operasi massal cukup menghitung ulang sekali.
+*/
+void pekerja_tunda(int aktif);
+
+/*
+    Function bertujuan untuk menjalankan semua pekerjaan yang ditunda secara langsung.
+    Input : -
+    Output : Mengembalikan jumlah pekerjaan yang dijalankan.
+*/
+int pekerja_jalankan_tertunda(void);
+
+/*
+    Function bertujuan untuk mengambil jumlah pekerjaan gagal sejak pemanggilan terakhir.
+    Input : -
+    Output : Mengembalikan jumlah pekerjaan gagal, lalu penghitung direset.
+*/
+int pekerja_ambil_jumlah_gagal(void);
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * =============================================================================
+ * File        : periode.h
+ * Deskripsi   : Header file untuk modul tutup periode (snapshot bulan)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini membekukan satu bulan menjadi snapshot hanya-baca, termasuk:
+ * - Tutup periode: menyimpan transaksi bulan, analisis akhir, dan total per
+ *   pos beserta checksum ke data/tutup_MM.txt
+ * - Buka periode: menghapus snapshot agar bulan bisa diubah lagi
+ * - Ringkasan O(1) untuk laporan bulan yang sudah ditutup
+ * - Verifikasi snapshot terhadap isinya sendiri dan transaksi saat ini
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - pos.h       : Untuk struct PosAnggaran dan MAX_POS
+ * - analisis.h  : Untuk struct AnalisisKeuangan
+ *
+ * CATATAN:
+ * Format file (baris dipisah newline):
+ *   TUTUP|versi|bulan|jumlah_transaksi|jumlah_pos|hash_agregat|hash_transaksi
+ *   baris analisis (format analisis_MM.txt)
+ *   jumlah_pos baris pos (format pos_MM.txt)
+ *   jumlah_transaksi baris transaksi (format transaksi.txt)
+ * Hash adalah FNV-1a 64-bit (16 digit heksadesimal) atas baris-baris bagian
+ * masing-masing termasuk newline; hash transaksi dijumlahkan per baris agar
+ * tidak bergantung urutan baris di transaksi.txt. Memuat ringkasan hanya membaca kepala,
+ * analisis, dan pos (tidak bergantung jumlah transaksi), lalu di-cache
+ * selama file tidak berubah. Bulan mengikuti semantik aplikasi: bulan 1-12
+ * tanpa membedakan tahun.
+ * =============================================================================
+ */
+
+#ifndef PERIODE_H
+#define PERIODE_H
+
+#include "pos.h"
+#include "analisis.h"
+
+/* ===== KONSTANTA ===== */
+
+#define FILE_TUTUP_PREFIX       "tutup"         /* Prefix file snapshot per bulan */
+#define FILE_TUTUP_EXTENSION    ".txt"          /* Ekstensi file snapshot */
+#define PENANDA_TUTUP           "TUTUP"         /* Kolom pertama baris kepala */
+#define VERSI_TUTUP             1
+
+/* Hasil verifikasi_periode */
+#define PERIODE_TERBUKA         0       /* Tidak ada snapshot */
+#define PERIODE_TERTUTUP        1       /* Snapshot utuh dan sama dengan transaksi saat ini */
+#define PERIODE_RUSAK           -1      /* Snapshot tidak terbaca atau checksum tidak cocok */
+#define PERIODE_BERUBAH         -2      /* Transaksi bulan di file data berbeda dari snapshot */
+
+/* ===== STRUKTUR DATA ===== */
+
+/**
+ * Struct agregat akhir bulan yang ditutup
+ */
+typedef struct {
+    int bulan;                              /* Bulan 1-12 */
+    int jumlah_transaksi;                   /* Transaksi yang dibekukan */
+    unsigned long long hash_transaksi;      /* Checksum baris transaksi */
+    AnalisisKeuangan analisis;              /* Analisis akhir bulan */
+    PosAnggaran pos[MAX_POS];               /* Pos dengan realisasi akhir */
+    int jumlah_pos;
+} RingkasanPeriode;
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Procedure bertujuan untuk membuat nama file snapshot bulan.
+    I. S. : bulan (Bulan 1-12)
+    F. S. : result berisi path file, misal "data/tutup_03.txt".
+*/
+void dapatkan_nama_file_tutup(int bulan, char *result, int result_size);
+
+/*
+    Function bertujuan untuk memeriksa apakah bulan sudah ditutup.
+    Input : bulan (Bulan 1-12)
+    Output : Mengembalikan 1 jika snapshot bulan ada, 0 jika tidak.
+*/
+int cek_periode_tertutup(int bulan);
+
+/*
+    Function bertujuan untuk memeriksa apakah tanggal berada di bulan yang ditutup.
+    Input : tanggal (String tanggal dd-mm-YYYY)
+    Output : Mengembalikan 1 jika bulannya ditutup, 0 jika tidak atau tanggal tidak valid.
+*/
+int cek_tanggal_tertutup(const char *tanggal);
+
+/*
+    Function bertujuan untuk mengambil agregat akhir bulan yang ditutup.
+    Input : bulan (Bulan 1-12), hasil (Pointer tujuan)
+    Output : hasil terisi dari cache atau kepala snapshot. Mengembalikan 1 jika bulan ditutup dan
+             bagian agregat snapshot utuh, 0 jika tidak (pemanggil menghitung dari transaksi).
+*/
+int ambil_ringkasan_periode(int bulan, RingkasanPeriode *hasil);
+
+/*
+    Function bertujuan untuk menutup periode: membekukan transaksi, analisis, dan pos bulan.
+    Input : bulan (Bulan 1-12 yang sudah lewat, sebelum bulan berjalan), error_msg (Buffer pesan error, boleh NULL)
+    Output : File pos dan analisis bulan ikut disegarkan. Mengembalikan jumlah transaksi yang
+             dibekukan, atau -1 jika gagal.
+*/
+int tutup_periode(int bulan, char *error_msg);
+
+/*
+    Function bertujuan untuk membuka kembali periode yang ditutup.
+    Input : bulan (Bulan 1-12), error_msg (Buffer pesan error, boleh NULL)
+    Output : Snapshot dihapus. Mengembalikan 1 jika berhasil, 0 jika gagal.
+*/
+int buka_periode(int bulan, char *error_msg);
+
+/*
+    Function bertujuan untuk memverifikasi snapshot bulan.
+    Input : bulan (Bulan 1-12)
+    Output : Mengembalikan PERIODE_TERBUKA, PERIODE_TERTUTUP, PERIODE_RUSAK, atau PERIODE_BERUBAH.
+*/
+int verifikasi_periode(int bulan);
+
+#endif
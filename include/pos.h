@@ -13,14 +13,12 @@
  * - Operasi CRUD (Create, Read, Update, Delete) untuk pos anggaran
  * - Perhitungan realisasi dan sisa anggaran per pos
  * - Penentuan status pos (Aman/Tidak Aman berdasarkan budget)
- * - Tampilan interaktif untuk manajemen pos anggaran
  * - Validasi data pos anggaran
  *
  * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
  * - file.h      : Untuk operasi penyimpanan dan pembacaan file pos
  * - transaksi.h : Untuk forward declaration struct Transaksi
  * - utils.h     : Untuk fungsi utilitas string dan formatting
- * - tui.h       : Untuk tampilan antarmuka pengguna
  *
  * CATATAN:
  * Setiap pos anggaran memiliki batas nominal dan status yang otomatis
@@ -48,6 +46,7 @@
 
 /* Deklarasi forward untuk menghindari ketergantungan melingkar */
 typedef struct Transaksi Transaksi;
+typedef struct RingkasanTransaksi RingkasanTransaksi;
 
 /**
  * Struct untuk menyimpan data pos anggaran beserta realisasinya
@@ -75,6 +74,20 @@ typedef struct ListPos {
     int capacity;               /* Kapasitas maksimal array */
 } ListPos;
 
+/**
+ * Struct snapshot data pos anggaran untuk satu layar
+ *
+ * Realisasi setiap pos dan total ringkasan dihitung satu kali saat snapshot
+ * diambil, lalu dipakai ulang untuk setiap tombol navigasi.
+ */
+typedef struct {
+    int bulan;                              /* Bulan snapshot */
+    PosAnggaran list[MAX_POS];              /* Pos dengan kalkulasi terbaru */
+    int count;                              /* Jumlah pos */
+    unsigned long long total_anggaran;      /* Jumlah anggaran semua pos */
+    unsigned long long total_realisasi;     /* Jumlah realisasi semua pos */
+} SnapshotPos;
+
 /*
     Function bertujuan untuk menghitung realisasi pos dari transaksi.
     Input : nama_pos (Nama pos), bulan (Bulan transaksi)
@@ -82,6 +95,15 @@ typedef struct ListPos {
 */
 unsigned long long hitung_realisasi_pos(const char *nama_pos, int bulan);
 
+/*
+    Procedure bertujuan untuk menambahkan satu transaksi ke ringkasan dan pos yang sesuai.
+    I. S. : trx (Transaksi), pos (Daftar pos, boleh NULL jika count 0), ringkasan (Boleh NULL)
+    F. S. : ringkasan bertambah sesuai jenis transaksi. Transaksi dihitung ke pos pertama yang
+            namanya sama tanpa membedakan huruf besar/kecil; realisasi hanya menjumlahkan
+            pengeluaran. Satu-satunya tempat aturan agregasi pos dan ringkasan didefinisikan.
+*/
+void akumulasi_transaksi(const Transaksi *trx, PosAnggaran *pos, int count, RingkasanTransaksi *ringkasan);
+
 /*
     Function bertujuan untuk menghitung sisa anggaran pos.
     Input : nominal (Anggaran awal), realisasi (Realisasi pengeluaran)
@@ -166,6 +188,13 @@ int ambil_daftar_pos(PosAnggaran *list, int max_count, int bulan);
 */
 int ambil_pos_berdasarkan_nomor(int no, int bulan, PosAnggaran *result);
 
+/*
+    Function bertujuan untuk mengambil snapshot pos anggaran beserta total ringkasannya.
+    Input : bulan (Nomor bulan 1-12)
+    Output : snap (Snapshot terisi). Mengembalikan 1 jika berhasil, 0 jika gagal.
+*/
+int ambil_snapshot_pos(SnapshotPos *snap, int bulan);
+
 /*
     Function bertujuan untuk mengambil daftar nama pos untuk dropdown/pilihan.
     Input : max_count (Kapasitas maksimal), bulan (Nomor bulan 1-12)
@@ -187,69 +216,6 @@ int cek_pos_ada(const char *nama, int bulan);
 */
 int segarkan_pos(int bulan);
 
-/*
-    Function bertujuan untuk menampilkan daftar pos anggaran dengan kalkulasi.
-    Input : bulan (Nomor bulan), selected (Index pos yang dipilih)
-    Output : Mengembalikan posisi baris berikutnya setelah tabel.
-*/
-int tampilkan_daftar_pos(int bulan, int selected);
-
-/*
-    Function bertujuan untuk menampilkan detail satu pos anggaran.
-    Input : pos (Pointer ke data pos), start_y (Baris awal tampilan)
-    Output : Mengembalikan posisi baris berikutnya setelah detail.
-*/
-int tampilkan_detail_pos(PosAnggaran *pos, int start_y);
-
-/*
-    Function bertujuan untuk menampilkan ringkasan pos anggaran bulan.
-    Input : bulan (Nomor bulan), start_y (Baris awal tampilan)
-    Output : Mengembalikan posisi baris berikutnya setelah ringkasan.
-*/
-int tampilkan_ringkasan_pos(int bulan, int start_y);
-
-/*
-    Function bertujuan untuk menampilkan form tambah pos.
-    Input : bulan (Nomor bulan untuk pos baru)
-    Output : Mengembalikan 1 jika berhasil tambah, 0 jika dibatalkan.
-*/
-int tampilkan_form_tambah_pos(int bulan);
-
-/*
-    Function bertujuan untuk menampilkan form edit pos.
-    Input : no (Nomor pos), bulan (Nomor bulan)
-    Output : Mengembalikan 1 jika berhasil edit, 0 jika dibatalkan.
-*/
-int tampilkan_form_edit_pos(int no, int bulan);
-
-/*
-    Function bertujuan untuk menampilkan konfirmasi hapus pos.
-    Input : no (Nomor pos), bulan (Nomor bulan)
-    Output : Mengembalikan 1 jika berhasil hapus, 0 jika dibatalkan.
-*/
-int tampilkan_konfirmasi_hapus_pos(int no, int bulan);
-
-/*
-    Function bertujuan untuk menampilkan pilihan pos untuk input transaksi.
-    Input : bulan (Nomor bulan)
-    Output : result (Buffer untuk menyimpan nama pos terpilih). Mengembalikan 1 jika dipilih, 0 jika dibatalkan.
-*/
-int tampilkan_pilih_pos(int bulan, char *result);
-
-/*
-    Procedure bertujuan untuk menjalankan modul pos anggaran.
-    I. S. : bulan_awal (Bulan awal saat modul dijalankan, valid)
-    F. S. : Modul pos dijalankan hingga pengguna kembali.
-*/
-void jalankan_modul_pos(int bulan_awal);
-
-/*
-    Function bertujuan untuk menginisialisasi data pos untuk bulan baru.
-    Input : bulan (Bulan yang akan diinisialisasi)
-    Output : Mengembalikan 1 jika berhasil, 0 jika gagal.
-*/
-int inisialisasi_pos_untuk_bulan(int bulan);
-
 /*
     Function bertujuan untuk menyinkronisasi kalkulasi pos dengan transaksi.
     Input : bulan (Bulan yang akan disinkronisasi)
@@ -257,48 +223,6 @@ int inisialisasi_pos_untuk_bulan(int bulan);
 */
 int sinkronisasi_pos_transaksi(int bulan);
 
-/*
-    Function bertujuan untuk menampilkan dan menjalankan menu utama pos anggaran.
-    Input : bulan (Bulan aktif)
-    Output : Mengembalikan kode aksi yang dipilih.
-*/
-int menu_pos_utama(int bulan);
-
-/*
-    Function bertujuan untuk menampilkan menu pilih bulan.
-    Input : bulan_saat_ini (Bulan saat ini)
-    Output : Mengembalikan bulan yang dipilih, atau 0 jika dibatalkan.
-*/
-int menu_pilih_bulan(int bulan_saat_ini);
-
-/*
-    Procedure bertujuan untuk menangani tampilan daftar pos dengan navigasi.
-    I. S. : bulan (Nomor bulan valid)
-    F. S. : Pengguna kembali dari tampilan.
-*/
-void penanganan_lihat_pos(int bulan);
-
-/*
-    Procedure bertujuan untuk menangani tambah pos baru.
-    I. S. : bulan (Nomor bulan valid)
-    F. S. : Pos baru ditambahkan jika pengguna konfirmasi.
-*/
-void penanganan_tambah_pos(int bulan);
-
-/*
-    Procedure bertujuan untuk menangani edit pos.
-    I. S. : bulan (Nomor bulan valid)
-    F. S. : Pos diedit jika pengguna konfirmasi.
-*/
-void penanganan_ubah_pos(int bulan);
-
-/*
-    Procedure bertujuan untuk menangani hapus pos.
-    I. S. : bulan (Nomor bulan valid)
-    F. S. : Pos dihapus jika pengguna konfirmasi.
-*/
-void penanganan_hapus_pos(int bulan);
-
 /* ===== FUNGSI VALIDASI POS (dipindahkan dari validator.h) ===== */
 
 /*
@@ -0,0 +1,86 @@
+/*
+ * =============================================================================
+ * File        : rekap.h
+ * Deskripsi   : Header file untuk modul rekap tahunan (agregasi paralel)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini menghitung ulang analisis dan pos anggaran seluruh bulan
+ * sekaligus, termasuk:
+ * - Satu kali pemuatan file transaksi untuk 12 bulan
+ * - Agregasi per potongan transaksi sebagai tugas kolam thread
+ * - Penggabungan hasil parsial secara deterministik (urut potongan)
+ * - Penyimpanan pos dan analisis per bulan sebagai tugas kolam
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - pos.h       : Untuk struct PosAnggaran, sisa, dan status pos
+ * - analisis.h  : Untuk struct AnalisisKeuangan dan isi_analisis_dari_ringkasan
+ * - kolam.h     : Untuk menjalankan tugas paralel
+ *
+ * CATATAN:
+ * Hasil rekap sama dengan memanggil update_semua_pos_bulan dan
+ * refresh_analisis_bulan untuk setiap bulan secara berurutan, tetapi file
+ * transaksi hanya dibaca sekali. Semua penjumlahan memakai bilangan bulat dan
+ * hasil parsial digabung sesuai urutan potongan, sehingga hasilnya tidak
+ * bergantung pada jumlah thread.
+ * =============================================================================
+ */
+
+#ifndef REKAP_H
+#define REKAP_H
+
+#include "pos.h"
+#include "analisis.h"
+
+/* ===== KONSTANTA ===== */
+
+#define REKAP_TRANSAKSI_PER_TUGAS   16384   /* Transaksi minimal per potongan agregasi */
+#define REKAP_TUGAS_PER_THREAD      4       /* Potongan per thread agar beban rata */
+
+/* Status per bulan hasil refresh_rekap_tahunan */
+#define REKAP_DILEWATI          -1      /* Bulan tidak memiliki data */
+#define REKAP_GAGAL             0       /* Penyimpanan gagal */
+#define REKAP_OK                1       /* Pos dan analisis tersimpan */
+
+/* ===== STRUKTUR DATA ===== */
+
+/**
+ * Struct hasil rekap seluruh bulan (indeks 0 = Januari)
+ */
+typedef struct {
+    AnalisisKeuangan analisis[12];          /* Analisis per bulan */
+    PosAnggaran pos[12][MAX_POS];           /* Pos per bulan dengan kalkulasi terbaru */
+    int jumlah_pos[12];                     /* Banyak pos per bulan */
+} RekapTahunan;
+
+/* ===== DEKLARASI FUNGSI ===== */
+
+/*
+    Function bertujuan untuk menghitung analisis dan kalkulasi pos seluruh bulan secara paralel.
+    Input : rekap (Pointer tujuan hasil)
+    Output : rekap terisi untuk 12 bulan. Mengembalikan 1 jika berhasil, 0 jika gagal memuat data.
+*/
+int hitung_rekap_tahunan(RekapTahunan *rekap);
+
+/*
+    Function bertujuan untuk menghitung ulang dan menyimpan pos serta analisis seluruh bulan.
+    Input : hanya_berdata (1: hanya bulan yang memiliki file pos atau analisis, 0: semua bulan),
+            status (Array 13 elemen untuk status per bulan, indeks 1-12, boleh NULL)
+    Output : status[bulan] berisi REKAP_*. Mengembalikan 1 jika semua bulan yang diproses berhasil, 0 jika ada yang gagal.
+*/
+int refresh_rekap_tahunan(int hanya_berdata, int status[13]);
+
+/*
+    Function bertujuan untuk menghitung ulang dan menyimpan pos serta analisis bulan tertentu saja.
+    Input : dipilih (Array 13 elemen, indeks 1-12 bernilai 1 untuk bulan yang dibangun ulang),
+            status (Array 13 elemen untuk status per bulan, boleh NULL)
+    Output : status[bulan] berisi REKAP_*. File transaksi dimuat sekali untuk semua bulan terpilih
+             dan tidak dimuat sama sekali jika tidak ada yang dipilih. Mengembalikan 1 jika semua
+             bulan terpilih berhasil, 0 jika ada yang gagal.
+*/
+int refresh_rekap_bulan(const int dipilih[13], int status[13]);
+
+#endif
@@ -14,17 +14,16 @@
  * - Pencatatan transaksi pemasukan dan pengeluaran
  * - Perhitungan total pemasukan, pengeluaran, dan jumlah transaksi
  * - Generate ID transaksi unik secara otomatis
- * - Tampilan interaktif untuk manajemen transaksi
  * - Validasi data transaksi
  *
  * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
  * - file.h  : Untuk operasi penyimpanan dan pembacaan file transaksi
  * - pos.h   : Untuk integrasi dengan pos anggaran
  * - utils.h : Untuk fungsi utilitas string dan formatting
- * - tui.h   : Untuk tampilan antarmuka pengguna
  *
  * CATATAN:
- * Setiap transaksi memiliki ID unik dengan format T0001-T9999.
+ * Setiap transaksi memiliki ID unik dengan format T0001, T0002, dst.
+ * (minimal 4 digit, bertambah digit setelah T9999).
  * Transaksi terbagi menjadi dua jenis: Pemasukan dan Pengeluaran.
  * Fungsi validasi transaksi telah dipindahkan dari validator.h ke modul ini.
  * =============================================================================
@@ -37,7 +36,8 @@
 
 /* Konfigurasi Transaksi */
 #define MAX_DESKRIPSI_LENGTH    50      /* Panjang maksimal deskripsi */
-#define MAX_ID_LENGTH           5       /* Panjang ID transaksi (T0001) */
+#define MAX_ID_LENGTH           10      /* Panjang maksimal ID transaksi (T + 9 digit) */
+#define MAX_NOMOR_ID            999999999       /* Nomor ID terbesar yang muat di MAX_ID_LENGTH */
 #define MAX_TANGGAL_LENGTH      10      /* Format dd-mm-YYYY */
 #define MAX_TRANSAKSI           1000    /* Maksimal transaksi per bulan */
 #define FILE_TRANSAKSI          "transaksi"         /* Nama dasar file transaksi */
@@ -55,7 +55,7 @@
  * Menyimpan informasi lengkap tentang transaksi baik pemasukan maupun pengeluaran
  */
 typedef struct Transaksi {
-    char id[6];                 /* ID transaksi (T0001-T9999) */
+    char id[MAX_ID_LENGTH + 1]; /* ID transaksi (T0001, T0002, ...) */
     char tanggal[11];           /* Format dd-mm-YYYY */
     int jenis;                  /* 0=Pengeluaran, 1=Pemasukan */
     char pos[21];               /* Nama pos anggaran (max 20 char) */
@@ -74,6 +74,33 @@ typedef struct ListTransaksi {
     int capacity;               /* Kapasitas maksimal array */
 } ListTransaksi;
 
+/**
+ * Struct ringkasan total transaksi satu bulan
+ *
+ * Dihitung dalam satu lintasan file tanpa memuat transaksi ke memori.
+ */
+typedef struct RingkasanTransaksi {
+    unsigned long long total_pemasukan;     /* Jumlah nominal pemasukan */
+    unsigned long long total_pengeluaran;   /* Jumlah nominal pengeluaran */
+    int jumlah_pemasukan;                   /* Banyak transaksi pemasukan */
+    int jumlah_pengeluaran;                 /* Banyak transaksi pengeluaran */
+} RingkasanTransaksi;
+
+/**
+ * Struct snapshot data transaksi untuk satu layar
+ *
+ * Diambil satu kali saat layar dibuka dan dipakai ulang untuk setiap tombol
+ * navigasi. Total turunan dihitung dalam satu lintasan saat snapshot diambil.
+ */
+typedef struct {
+    int bulan;                              /* Bulan snapshot (0 = semua bulan) */
+    ListTransaksi list;                     /* Salinan transaksi (tidak diubah) */
+    unsigned long long total_pemasukan;     /* Jumlah nominal pemasukan */
+    unsigned long long total_pengeluaran;   /* Jumlah nominal pengeluaran */
+    int jumlah_pemasukan;                   /* Banyak transaksi pemasukan */
+    int jumlah_pengeluaran;                 /* Banyak transaksi pengeluaran */
+} SnapshotTransaksi;
+
 /*
     Function bertujuan untuk menambahkan transaksi baru dengan validasi.
     Input : tanggal (Tanggal transaksi), jenis (Jenis transaksi), pos (Nama pos), nominal (Nilai nominal), deskripsi (Deskripsi transaksi)
@@ -83,6 +110,16 @@ int tambah_transaksi(const char *tanggal, int jenis, const char *pos,
                      unsigned long long nominal, const char *deskripsi,
                      char *error_msg);
 
+/*
+    Function bertujuan untuk menambahkan transaksi baru dan mengembalikan ID yang diberikan.
+    Input : tanggal, jenis, pos, nominal, deskripsi (Sama dengan tambah_transaksi)
+    Output : id_baru (Buffer minimal sebesar Transaksi.id, boleh NULL), error_msg (Buffer pesan error).
+             Mengembalikan 1 jika berhasil, 0 jika gagal.
+*/
+int tambah_transaksi_dengan_id(const char *tanggal, int jenis, const char *pos,
+                               unsigned long long nominal, const char *deskripsi,
+                               char *id_baru, char *error_msg);
+
 /*
     Function bertujuan untuk mengedit transaksi dengan validasi.
     Input : id (ID transaksi), tanggal (Tanggal baru), jenis (Jenis baru), pos (Pos baru), nominal (Nominal baru), deskripsi (Deskripsi baru)
@@ -114,109 +151,54 @@ int ambil_daftar_transaksi(Transaksi *list, int max_count, int bulan);
 int ambil_transaksi_berdasarkan_id(const char *id, Transaksi *result);
 
 /*
-    Function bertujuan untuk menghitung total pemasukan untuk bulan tertentu.
-    Input : bulan (Nomor bulan 1-12)
-    Output : Mengembalikan total pemasukan.
-*/
-unsigned long long hitung_total_pemasukan_transaksi(int bulan);
-
-/*
-    Function bertujuan untuk menghitung total pengeluaran untuk bulan tertentu.
-    Input : bulan (Nomor bulan 1-12)
-    Output : Mengembalikan total pengeluaran.
-*/
-unsigned long long hitung_total_pengeluaran_transaksi(int bulan);
-
-/*
-    Function bertujuan untuk menghitung jumlah transaksi untuk bulan tertentu.
-    Input : bulan (Nomor bulan 1-12), jenis (Jenis transaksi, -1 untuk semua)
-    Output : Mengembalikan jumlah transaksi.
-*/
-int hitung_jumlah_transaksi(int bulan, int jenis);
-
-/*
-    Function bertujuan untuk menampilkan daftar transaksi bulan.
-    Input : bulan (Nomor bulan), selected (Index terpilih)
-    Output : Mengembalikan posisi baris berikutnya setelah tabel.
-*/
-int tampilkan_daftar_transaksi(int bulan, int selected);
-
-/*
-    Function bertujuan untuk menampilkan detail satu transaksi.
-    Input : trx (Pointer ke transaksi), start_y (Baris awal)
-    Output : Mengembalikan posisi baris berikutnya setelah detail.
-*/
-int tampilkan_detail_transaksi(Transaksi *trx, int start_y);
-
-/*
-    Function bertujuan untuk menampilkan ringkasan transaksi bulan.
-    Input : bulan (Nomor bulan), start_y (Baris awal)
-    Output : Mengembalikan posisi baris berikutnya setelah ringkasan.
-*/
-int tampilkan_ringkasan_transaksi(int bulan, int start_y);
-
-/*
-    Function bertujuan untuk menampilkan form tambah transaksi.
-    Input : bulan (Bulan default)
-    Output : Mengembalikan 1 jika berhasil tambah, 0 jika dibatalkan.
-*/
-int tampilkan_form_tambah_transaksi(int bulan);
-
-/*
-    Function bertujuan untuk menampilkan form edit transaksi.
-    Input : id (ID transaksi)
-    Output : Mengembalikan 1 jika berhasil edit, 0 jika dibatalkan.
+    Function bertujuan untuk mengambil snapshot transaksi beserta totalnya dalam satu kali baca file.
+    Input : bulan (Bulan filter 1-12, 0 untuk semua)
+    Output : snap (Snapshot terisi, wajib dibebaskan). Mengembalikan 1 jika berhasil, 0 jika gagal.
 */
-int tampilkan_form_edit_transaksi(const char *id);
+int ambil_snapshot_transaksi(SnapshotTransaksi *snap, int bulan);
 
 /*
-    Function bertujuan untuk menampilkan konfirmasi hapus transaksi.
-    Input : id (ID transaksi)
-    Output : Mengembalikan 1 jika berhasil hapus, 0 jika dibatalkan.
+    Procedure bertujuan untuk membebaskan memori snapshot transaksi.
+    I. S. : snap berisi data hasil ambil_snapshot_transaksi
+    F. S. : Memori snapshot dibebaskan, snap kosong.
 */
-int tampilkan_konfirmasi_hapus_transaksi(const char *id);
+void bebaskan_snapshot_transaksi(SnapshotTransaksi *snap);
 
 /*
-    Procedure bertujuan untuk menjalankan modul transaksi.
-    I. S. : bulan_awal (Bulan awal saat modul dijalankan, valid)
-    F. S. : Modul transaksi dijalankan hingga pengguna kembali.
-*/
-void jalankan_modul_transaksi(int bulan_awal);
-
-/*
-    Function bertujuan untuk menampilkan menu utama transaksi.
-    Input : bulan (Bulan aktif)
-    Output : Mengembalikan kode aksi yang dipilih.
+    Function bertujuan untuk menghitung ringkasan total dan jumlah transaksi bulan dalam satu lintasan.
+    Input : bulan (Nomor bulan 1-12)
+    Output : hasil (Ringkasan transaksi bulan). Mengembalikan 1 jika berhasil, 0 jika bulan tidak valid.
 */
-int menu_transaksi_utama(int bulan);
+int hitung_ringkasan_transaksi(int bulan, RingkasanTransaksi *hasil);
 
 /*
-    Procedure bertujuan untuk menangani tampilan daftar transaksi.
-    I. S. : bulan (Nomor bulan valid)
-    F. S. : Pengguna kembali dari tampilan.
+    Procedure bertujuan untuk menghitung ringkasan transaksi seluruh bulan dalam satu lintasan.
+    I. S. : hasil berupa array 13 elemen
+    F. S. : hasil[1..12] berisi ringkasan tiap bulan (bulan yang ditutup dari snapshot),
+            hasil[0] berisi total semua bulan.
 */
-void penanganan_lihat_transaksi(int bulan);
+void hitung_ringkasan_semua_bulan(RingkasanTransaksi hasil[13]);
 
 /*
-    Procedure bertujuan untuk menangani tambah transaksi.
-    I. S. : bulan (Nomor bulan valid)
-    F. S. : Transaksi baru ditambahkan jika pengguna konfirmasi.
+    Function bertujuan untuk menghitung total pemasukan untuk bulan tertentu.
+    Input : bulan (Nomor bulan 1-12)
+    Output : Mengembalikan total pemasukan.
 */
-void penanganan_tambah_transaksi(int bulan);
+unsigned long long hitung_total_pemasukan_transaksi(int bulan);
 
 /*
-    Procedure bertujuan untuk menangani edit transaksi.
-    I. S. : bulan (Nomor bulan valid)
-    F. S. : Transaksi diedit jika pengguna konfirmasi.
+    Function bertujuan untuk menghitung total pengeluaran untuk bulan tertentu.
+    Input : bulan (Nomor bulan 1-12)
+    Output : Mengembalikan total pengeluaran.
 */
-void penanganan_ubah_transaksi(int bulan);
+unsigned long long hitung_total_pengeluaran_transaksi(int bulan);
 
 /*
-    Procedure bertujuan untuk menangani hapus transaksi.
-    I. S. : bulan (Nomor bulan valid)
-    F. S. : Transaksi dihapus jika pengguna konfirmasi.
+    Function bertujuan untuk menghitung jumlah transaksi untuk bulan tertentu.
+    Input : bulan (Nomor bulan 1-12), jenis (Jenis transaksi, -1 untuk semua)
+    Output : Mengembalikan jumlah transaksi.
 */
-void penanganan_hapus_transaksi(int bulan);
+int hitung_jumlah_transaksi(int bulan, int jenis);
 
 /* ===== FUNGSI VALIDASI TRANSAKSI (dipindahkan dari validator.h) ===== */
 
@@ -235,7 +217,7 @@ int validasi_jenis_transaksi(int jenis);
 int validasi_panjang_deskripsi(const char *deskripsi);
 
 /*
-    Function bertujuan untuk memvalidasi format ID transaksi (T0001-T9999).
+    Function bertujuan untuk memvalidasi format ID transaksi (T diikuti 4-9 digit).
     Input : id (String ID transaksi)
     Output : Mengembalikan 1 jika valid, 0 jika tidak valid.
 */
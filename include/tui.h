@@ -66,6 +66,14 @@
 #define ALIGN_CENTER            1       /* Rata tengah */
 #define ALIGN_RIGHT             2       /* Rata kanan */
 
+/* Viewport Tabel */
+#define TABLE_MIN_ROWS          3       /* Minimal baris data yang ditampilkan */
+
+/* CACHE TAMPILAN BARIS */
+#define KAPASITAS_CACHE_TAMPILAN 128    /* Entri cache per viewport (dipetakan per index) */
+#define MAX_SEL_TAMPILAN        4       /* Sel terformat per baris */
+#define UKURAN_SEL_TAMPILAN     32      /* Cukup untuk "-Rp " + 26 digit berpemisah */
+
 /* ===== STRUKTUR DATA ===== */
 
 /**
@@ -86,6 +94,8 @@ typedef struct {
     int selected;                   /* Index item yang sedang dipilih */
     int start_y;                    /* Posisi Y (baris) awal menu */
     int start_x;                    /* Posisi X (kolom) awal menu */
+    int tombol_tersembunyi;         /* Tombol pintas yang tidak ditampilkan (0 = tidak ada) */
+    int nilai_tersembunyi;          /* Nilai yang dikembalikan tombol pintas tersebut */
 } Menu;
 
 /**
@@ -107,6 +117,46 @@ typedef struct {
     int start_x;                         /* Posisi X (kolom) awal tabel */
 } Table;
 
+/**
+ * Struct entri cache string tampilan satu baris data
+ *
+ * Menyimpan sel yang mahal diformat (nomor, Rupiah, saldo) beserta nilai
+ * sumbernya. Entri hanya dipakai jika index dan semua nilai sumber sama,
+ * sehingga record yang berubah otomatis diformat ulang.
+ */
+typedef struct {
+    int indeks;                                         /* Index data pemilik (-1 = kosong) */
+    unsigned long long kunci[MAX_SEL_TAMPILAN];         /* Nilai sumber saat diformat */
+    char sel[MAX_SEL_TAMPILAN][UKURAN_SEL_TAMPILAN];    /* String siap gambar */
+} EntriTampilan;
+
+/**
+ * Struct untuk mengelola jendela baris tabel yang terlihat (viewport)
+ *
+ * Hanya baris pada rentang [offset, offset + max_rows) yang diformat dan
+ * digambar, sehingga biaya gambar tidak bergantung pada jumlah data.
+ * Field drawn_* mencatat isi layar terakhir agar perpindahan sorotan cukup
+ * menggambar ulang baris lama dan baris baru. Cache menyimpan string tampilan
+ * per baris sehingga gambar ulang tidak memformat angka lagi.
+ */
+typedef struct TableViewport {
+    int offset;                          /* Index data pertama yang terlihat */
+    int max_rows;                        /* Jumlah maksimal baris data di layar */
+    int drawn_offset;                    /* Offset saat terakhir digambar */
+    int drawn_selected;                  /* Baris terpilih saat terakhir digambar */
+    int drawn_count;                     /* Jumlah data saat digambar (-1 = belum) */
+    EntriTampilan cache[KAPASITAS_CACHE_TAMPILAN]; /* String tampilan per baris data */
+} TableViewport;
+
+/**
+ * Struct untuk statistik penyegaran frame buffer terakhir
+ */
+typedef struct {
+    int panggilan_ncurses;               /* Jumlah panggilan ncurses untuk satu frame */
+    int baris_dikirim;                   /* Jumlah baris layar yang berubah */
+    int sel_dikirim;                     /* Jumlah sel yang dikirim ke stdscr */
+} StatistikFrame;
+
 /* ===== DEKLARASI FUNGSI ===== */
 
 /* --- Tampilan & Warna Dasar --- */
@@ -128,17 +178,31 @@ void tui_bersihkan(void);
 /*
     Procedure bertujuan untuk membersihkan layar.
     I. S. : Layar mungkin berisi teks
-    F. S. : Layar bersih.
+    F. S. : Frame buffer bersih; terminal hanya diperbarui pada sel yang berubah.
 */
 void tui_hapus_layar(void);
 
 /*
     Procedure bertujuan untuk menyegarkan layar untuk menampilkan perubahan.
-    I. S. : Ada perubahan di buffer window
-    F. S. : Perubahan ditampilkan di layar fisik.
+    I. S. : Ada perubahan di frame buffer
+    F. S. : Run sel yang berubah dikirim ke ncurses lalu ke layar fisik (wnoutrefresh + doupdate).
 */
 void tui_segarkan(void);
 
+/*
+    Procedure bertujuan untuk memaksa layar fisik digambar ulang seluruhnya.
+    I. S. : Layar fisik mungkin rusak (misal setelah resize atau output luar)
+    F. S. : Penyegaran berikutnya mengirim ulang seluruh layar.
+*/
+void tui_paksa_gambar_ulang(void);
+
+/*
+    Procedure bertujuan untuk mengambil statistik penyegaran frame terakhir.
+    I. S. : stat terdefinisi
+    F. S. : stat berisi jumlah panggilan ncurses, baris, dan sel yang dikirim pada frame terakhir.
+*/
+void tui_ambil_statistik_frame(StatistikFrame *stat);
+
 /*
     Function bertujuan untuk mendapatkan lebar terminal.
     Input : -
@@ -274,6 +338,34 @@ void tui_gambar_garis_horizontal(int y, int x, int length, char ch);
 */
 void tui_gambar_kotak(int y, int x, int height, int width);
 
+/*
+    Procedure bertujuan untuk mengisi rentang sel dengan satu karakter (dengan atribut aktif).
+    I. S. : Layar siap
+    F. S. : length sel mulai (y,x) berisi ch; dikirim sebagai satu run saat disegarkan.
+*/
+void tui_isi_rentang(int y, int x, int length, char ch);
+
+/*
+    Procedure bertujuan untuk mengisi rentang sel dengan satu karakter berwarna.
+    I. S. : Layar siap
+    F. S. : length sel mulai (y,x) berisi ch dengan warna pair_id.
+*/
+void tui_isi_rentang_berwarna(int y, int x, int length, char ch, int pair_id);
+
+/*
+    Procedure bertujuan untuk menulis teks terformat selebar width sel pada satu baris.
+    I. S. : Layar siap
+    F. S. : Teks ditulis di (y,x), dipotong atau dipad spasi hingga width (width <= 0 berarti sampai tepi layar).
+*/
+void tui_cetak_baris(int y, int x, int width, const char *fmt, ...);
+
+/*
+    Procedure bertujuan untuk mengosongkan baris mulai kolom x hingga tepi layar.
+    I. S. : Layar siap
+    F. S. : Sel (y, x..akhir) kosong tanpa atribut.
+*/
+void tui_bersihkan_baris(int y, int x);
+
 /* --- Input & Kursor --- */
 
 /*
@@ -390,6 +482,13 @@ void menu_inisialisasi(Menu *menu, const char *title);
 */
 int menu_tambah_item(Menu *menu, const char *text, int value);
 
+/*
+    Procedure bertujuan untuk memasang tombol pintas yang tidak ditampilkan di menu.
+    I. S. : menu sudah diinisialisasi
+    F. S. : Menekan tombol saat navigasi mengembalikan value.
+*/
+void menu_atur_tombol_tersembunyi(Menu *menu, int tombol, int value);
+
 /*
     Procedure bertujuan untuk mengatur posisi awal menu.
     I. S. : menu terdefinisi
@@ -497,6 +596,14 @@ void tampilkan_status(const char *message);
 */
 void tampilkan_memuat(const char *message);
 
+/*
+    Function bertujuan untuk menunggu pekerja latar belakang selesai sambil menampilkan spinner.
+    Input : message (Pesan di samping spinner, boleh NULL)
+    Output : Mengembalikan 1 jika semua pekerjaan berhasil, 0 jika ada yang gagal.
+             Tombol yang ditekan selama menunggu dikembalikan ke antrian input.
+*/
+int tui_tunggu_pekerja(const char *message);
+
 /*
     Procedure bertujuan untuk membersihkan area pesan.
     I. S. : Area pesan mungkin berisi teks
@@ -548,18 +655,62 @@ void tabel_gambar_baris(Table *table, int row, int selected, const char **values
 */
 void tabel_gambar_pemisah(Table *table, int y);
 
+/*
+    Function bertujuan untuk menghitung jumlah baris data tabel yang muat di layar.
+    Input : start_y (Baris awal tabel), reserved_bottom (Jumlah baris bawah yang dicadangkan)
+    Output : Mengembalikan jumlah baris data (minimal TABLE_MIN_ROWS).
+*/
+int tabel_hitung_baris_muat(int start_y, int reserved_bottom);
+
+/*
+    Procedure bertujuan untuk menginisialisasi viewport tabel.
+    I. S. : view sembarang
+    F. S. : view berada di awal data dengan kapasitas max_rows baris, cache tampilan kosong.
+*/
+void tabel_viewport_inisialisasi(TableViewport *view, int max_rows);
+
+/*
+    Procedure bertujuan untuk menandai viewport agar digambar ulang penuh pada pemanggilan berikutnya.
+    I. S. : view terdefinisi
+    F. S. : Status gambar terakhir view dihapus (misal setelah layar dibersihkan).
+*/
+void tabel_viewport_invalidasi(TableViewport *view);
+
+/*
+    Function bertujuan untuk memeriksa apakah viewport masih memiliki gambar yang valid di layar.
+    Input : view (Pointer ke viewport, boleh NULL)
+    Output : Mengembalikan 1 jika tabel sudah tergambar dan bisa diperbarui sebagian, 0 jika tidak.
+*/
+int tabel_viewport_sudah_digambar(const TableViewport *view);
+
+/*
+    Procedure bertujuan untuk menggeser viewport agar baris terpilih tetap terlihat.
+    I. S. : view terdefinisi, selected dan count valid
+    F. S. : offset view digeser seminimal mungkin sehingga selected berada di dalam jendela.
+*/
+void tabel_viewport_ikuti(TableViewport *view, int selected, int count);
+
+/*
+    Function bertujuan untuk memproses tombol navigasi tabel (atas/bawah, PgUp/PgDn, Home/End).
+    Input : ch (Kode tombol), count (Jumlah data), page (Jumlah baris per halaman)
+    Output : selected (Index terpilih yang diperbarui). Mengembalikan 1 jika tombol ditangani, 0 jika tidak.
+*/
+int tabel_navigasi(int ch, int *selected, int count, int page);
+
 /*
     Function bertujuan untuk menampilkan tabel daftar transaksi.
-    Input : list (Array transaksi), count (Jumlah transaksi), start_y (Baris awal), selected (Index transaksi terpilih)
+    Input : list (Array transaksi), count (Jumlah transaksi), start_y (Baris awal), selected (Index transaksi terpilih),
+            view (Viewport tabel, NULL untuk jendela selebar layar)
     Output : Mengembalikan posisi baris (y) setelah tabel.
 */
-int tampilkan_tabel_transaksi(Transaksi *list, int count, int start_y, int selected);
+int tampilkan_tabel_transaksi(const Transaksi *list, int count, int start_y, int selected, TableViewport *view);
 
 /*
     Function bertujuan untuk menampilkan tabel daftar pos anggaran.
-    Input : list (Array pos anggaran), count (Jumlah pos), start_y (Baris awal), selected (Index pos terpilih)
+    Input : list (Array pos anggaran), count (Jumlah pos), start_y (Baris awal), selected (Index pos terpilih),
+            view (Viewport tabel, NULL untuk jendela selebar layar)
     Output : Mengembalikan posisi baris (y) setelah tabel.
 */
-int tampilkan_tabel_pos(PosAnggaran *list, int count, int start_y, int selected);
+int tampilkan_tabel_pos(const PosAnggaran *list, int count, int start_y, int selected, TableViewport *view);
 
 #endif
@@ -34,6 +34,9 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+/* Deklarasi forward untuk stat_sama */
+struct stat;
+
 /* ===== DEFINISI KONSTANTA ===== */
 
 /* KODE RETURN */
@@ -41,6 +44,10 @@
 #define FAILURE                 0       /* Operasi gagal */
 #define CANCEL                  -1      /* Operasi dibatalkan user */
 
+/* HASH */
+#define HASH_FNV_AWAL           14695981039346656037ULL /* Nilai awal FNV-1a 64-bit */
+#define HASH_FNV_PRIMA          1099511628211ULL        /* Bilangan prima FNV-1a 64-bit */
+
 /* BULAN */
 #define BULAN_MIN               1       /* Januari */
 #define BULAN_MAX               12      /* Desember */
@@ -58,6 +65,16 @@ typedef struct {
     int tahun;                  /* Tahun (4 digit) */
 } Tanggal;
 
+/**
+ * Struct rentang teks (pandangan ke bagian string tanpa salinan)
+ *
+ * Digunakan oleh pisah_rentang; ptr tidak null-terminated pada posisi len
+ */
+typedef struct {
+    const char *ptr;            /* Awal rentang di string sumber */
+    int len;                    /* Panjang rentang (byte) */
+} RentangTeks;
+
 /* Forward declarations untuk tipe yang digunakan pada fungsi-fungsi alloc */
 /* Definisi sebenarnya ada pada .c masing-masing */
 typedef struct Transaksi Transaksi;
@@ -248,6 +265,20 @@ int cek_tahun_kabisat(int year);
 */
 int dapatkan_jumlah_hari_bulan(int month, int year);
 
+/*
+    Function bertujuan untuk mengubah tanggal menjadi nomor hari (hari sejak 01-01-1970).
+    Input : d (Hari), m (Bulan 1-12), y (Tahun)
+    Output : Mengembalikan nomor hari; negatif untuk tanggal sebelum 1970.
+*/
+long long tanggal_ke_nomor_hari(int d, int m, int y);
+
+/*
+    Procedure bertujuan untuk mengubah nomor hari kembali menjadi tanggal.
+    I. S. : nomor (Nomor hari dari tanggal_ke_nomor_hari)
+    F. S. : d, m, y berisi hari, bulan, dan tahun tanggal tersebut.
+*/
+void nomor_hari_ke_tanggal(long long nomor, int *d, int *m, int *y);
+
 /*
     Function bertujuan untuk mengekstrak bulan dari string tanggal.
     Input : tanggal (String tanggal format dd-mm-YYYY)
@@ -304,6 +335,20 @@ void format_angka_pemisah(unsigned long long nominal, char *result);
 */
 void format_saldo(long long saldo, char *result);
 
+/*
+    Function bertujuan untuk menulis angka desimal tanpa tanda ke buffer (seperti "%llu").
+    Input : nilai (Angka), buf (Buffer minimal 21 byte)
+    Output : buf berisi digit angka (tidak null-terminated). Mengembalikan jumlah byte yang ditulis.
+*/
+int tulis_desimal_ull(unsigned long long nilai, char *buf);
+
+/*
+    Function bertujuan untuk menulis angka desimal bertanda ke buffer (seperti "%lld").
+    Input : nilai (Angka), buf (Buffer minimal 21 byte)
+    Output : buf berisi tanda dan digit angka (tidak null-terminated). Mengembalikan jumlah byte yang ditulis.
+*/
+int tulis_desimal_ll(long long nilai, char *buf);
+
 /*
     Function bertujuan untuk mengkonversi string angka ke unsigned long long.
     Input : str (String yang berisi angka)
@@ -353,6 +398,49 @@ void salin_string_aman(char *dst, const char *src, int max);
 */
 int pisah_string(char *str, char delim, char **result, int max_parts);
 
+/*
+    Function bertujuan untuk memisahkan string menjadi rentang field tanpa menyalin atau mengubah string.
+    Input : str (String sumber), delim (Karakter delimiter), hasil (Array rentang), maks (Jumlah maksimal field)
+    Output : hasil berisi rentang tiap field yang sudah dipangkas, field kosong tetap dihitung.
+             Mengembalikan jumlah field yang dihasilkan.
+*/
+int pisah_rentang(const char *str, char delim, RentangTeks *hasil, int maks);
+
+/*
+    Procedure bertujuan untuk menyalin rentang teks ke buffer dengan batasan ukuran.
+    I. S. : dst (Buffer tujuan), rentang (Rentang sumber), max (Ukuran maksimal buffer)
+    F. S. : Isi rentang disalin ke dst (maksimal max-1 karakter), dst null-terminated.
+*/
+void salin_rentang(char *dst, RentangTeks rentang, int max);
+
+/*
+    Function bertujuan untuk mengkonversi rentang teks ke unsigned long long (seperti strtoull).
+    Input : rentang (Rentang berisi angka)
+    Output : Mengembalikan hasil konversi, 0 jika tidak ada angka.
+*/
+unsigned long long rentang_ke_ull(RentangTeks rentang);
+
+/*
+    Function bertujuan untuk mengkonversi rentang teks ke long long (seperti strtoll).
+    Input : rentang (Rentang berisi angka, boleh bertanda)
+    Output : Mengembalikan hasil konversi, 0 jika tidak ada angka.
+*/
+long long rentang_ke_ll(RentangTeks rentang);
+
+/*
+    Function bertujuan untuk mengkonversi rentang teks ke int (seperti atoi).
+    Input : rentang (Rentang berisi angka, boleh bertanda)
+    Output : Mengembalikan hasil konversi, 0 jika tidak ada angka.
+*/
+int rentang_ke_int(RentangTeks rentang);
+
+/*
+    Function bertujuan untuk mengkonversi rentang teks ke double (seperti atof).
+    Input : rentang (Rentang berisi angka desimal)
+    Output : Mengembalikan hasil konversi, 0.0 jika tidak ada angka.
+*/
+double rentang_ke_double(RentangTeks rentang);
+
 /*
     Function bertujuan untuk memeriksa apakah string kosong (hanya whitespace atau NULL).
     Input : str (String yang diperiksa)
@@ -374,6 +462,27 @@ int banding_string_tanpa_case(const char *s1, const char *s2);
 */
 void hapus_newline_string(char *str);
 
+/*
+    Function bertujuan untuk menghitung hash FNV-1a 64-bit dari sekumpulan byte.
+    Input : data (Byte yang di-hash), panjang (Jumlah byte), hash (HASH_FNV_AWAL atau hasil sebelumnya untuk melanjutkan)
+    Output : Mengembalikan hash setelah semua byte diproses.
+*/
+unsigned long long hash_fnv1a(const void *data, unsigned long panjang, unsigned long long hash);
+
+/*
+    Function bertujuan untuk menambahkan satu baris beserta newline ke hash FNV-1a berjalan.
+    Input : hash (HASH_FNV_AWAL atau hasil sebelumnya), line (Baris tanpa newline)
+    Output : Mengembalikan hash setelah isi baris dan "\n" diproses.
+*/
+unsigned long long hash_baris(unsigned long long hash, const char *line);
+
+/*
+    Function bertujuan untuk memeriksa apakah dua hasil stat menunjukkan file yang sama tanpa perubahan.
+    Input : a, b (Hasil stat)
+    Output : Mengembalikan 1 jika inode, device, ukuran, dan mtime (sampai nanodetik) sama, 0 jika tidak.
+*/
+int stat_sama(const struct stat *a, const struct stat *b);
+
 /* ===== FUNGSI VALIDASI (dipindahkan dari validator.h) ===== */
 
 /*
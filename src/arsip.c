@@ -0,0 +1,1026 @@
+/*
+ * =============================================================================
+ * File        : arsip.c
+ * Deskripsi   : Implementasi modul arsip kolom periode tertutup
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan encoder/decoder arsip kolom (lihat arsip.h
+ * untuk format file), kompresi LZ77 sederhana per kolom, daftar
+ * tahun arsip dengan cache per direktori, serta operasi segel dan buka segel
+ * tahun.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, stdlib.h, string.h : Untuk fgets, alokasi, dan manipulasi byte
+ * - limits.h    : Untuk batas jumlah baris arsip
+ * - fcntl.h, unistd.h, sys/stat.h : Untuk open, read, dan stat
+ * - dirent.h    : Untuk memindai file arsip di direktori data
+ * - pthread.h   : Untuk mutex cache daftar tahun
+ * - arsip.h     : Header file modul ini
+ * - utils.h     : Untuk tanggal, nomor hari, hash FNV-1a, dan ListTransaksi
+ * - instrumen.h : Untuk penghitung I/O
+ *
+ * CATATAN:
+ * Segel menulis arsip lebih dulu, baru mengganti file teks; buka segel
+ * mengganti file teks lebih dulu, baru menghapus arsip. Keduanya dicatat di
+ * data/segel.jurnal sebelum mengubah apa pun, sehingga jika proses terhenti
+ * di tengah, pulihkan_segel (dipanggil saat program mulai) menuntaskannya:
+ * selama arsip masih ada, arsip adalah sumber kebenaran tahun itu dan baris
+ * teks tahun yang sama dibuang agar tidak terhitung dua kali. Daftar tahun
+ * arsip di-cache dan hanya dipindai ulang jika direktori data berubah
+ * (inode, mtime, atau ctime berbeda).
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "arsip.h"
+#include "utils.h"
+#include "instrumen.h"
+
+/* ===== KONSTANTA LOKAL ===== */
+
+#define JUMLAH_KOLOM_ARSIP  6       /* id, tanggal, jenis, pos, nominal, deskripsi */
+#define KOLOM_ID            0
+#define KOLOM_TANGGAL       1
+#define KOLOM_JENIS         2
+#define KOLOM_POS           3
+#define KOLOM_NOMINAL       4
+#define KOLOM_DESKRIPSI     5
+#define MAX_BYTE_BARIS_ARSIP    (MAX_DESKRIPSI_LENGTH + 1)  /* Batas byte mentah satu baris per kolom */
+
+#define LZ_MIN_COCOK        4       /* Panjang minimal rujukan balik */
+#define LZ_BIT_HASH         15      /* Ukuran tabel hash kompresor (2^15 slot) */
+
+/* ===== STRUKTUR DATA LOKAL ===== */
+
+/**
+ * Struct buffer byte yang tumbuh otomatis untuk encoder
+ */
+typedef struct {
+    unsigned char *data;
+    size_t panjang;
+    size_t kapasitas;
+    int gagal;                  /* 1 jika alokasi pernah gagal */
+} BufferArsip;
+
+/**
+ * Struct kursor baca satu bagian arsip
+ */
+typedef struct {
+    const unsigned char *p;
+    const unsigned char *akhir;
+    int rusak;                  /* 1 jika membaca melewati batas */
+} KursorArsip;
+
+/* ===== VARIABEL GLOBAL LOKAL ===== */
+
+static pthread_mutex_t kunci_daftar = PTHREAD_MUTEX_INITIALIZER;
+static int daftar_valid = 0;
+static struct stat stat_daftar;                 /* Stat direktori saat daftar dipindai */
+static int daftar_tahun[MAKS_TAHUN_ARSIP];
+static int jumlah_daftar = 0;
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Mengisi pesan error jika buffer tersedia
+ */
+static void atur_pesan_error(char *error_msg, const char *msg) {
+    if (error_msg && msg) {
+        salin_string_aman(error_msg, msg, 100);
+    }
+}
+
+/**
+ * Helper: Menambah byte ke buffer, menggandakan kapasitas bila perlu
+ */
+static void buffer_tambah(BufferArsip *b, const void *data, size_t n) {
+    if (b->gagal || n == 0) return;
+
+    if (b->panjang + n > b->kapasitas) {
+        size_t baru = b->kapasitas ? b->kapasitas : 4096;
+        while (baru < b->panjang + n) baru *= 2;
+        unsigned char *p = (unsigned char *)realloc(b->data, baru);
+        if (p == NULL) {
+            b->gagal = 1;
+            return;
+        }
+        b->data = p;
+        b->kapasitas = baru;
+    }
+    memcpy(b->data + b->panjang, data, n);
+    b->panjang += n;
+}
+
+/**
+ * Helper: Menambah bilangan sebagai varint LEB128 (7 bit per byte)
+ */
+static void buffer_varint(BufferArsip *b, unsigned long long nilai) {
+    unsigned char tmp[10];
+    int n = 0;
+
+    do {
+        unsigned char byte = nilai & 0x7F;
+        nilai >>= 7;
+        tmp[n++] = byte | (nilai ? 0x80 : 0);
+    } while (nilai);
+
+    buffer_tambah(b, tmp, n);
+}
+
+/**
+ * Helper: Memetakan bilangan bertanda ke tak bertanda (0,-1,1,-2 -> 0,1,2,3)
+ */
+static unsigned long long zigzag(long long nilai) {
+    return ((unsigned long long)nilai << 1) ^ (unsigned long long)(nilai >> 63);
+}
+
+/**
+ * Helper: Kebalikan zigzag
+ */
+static long long unzigzag(unsigned long long nilai) {
+    return (long long)(nilai >> 1) ^ -(long long)(nilai & 1);
+}
+
+/**
+ * Helper: Membaca satu varint dari kursor
+ */
+static unsigned long long baca_varint(KursorArsip *k) {
+    unsigned long long nilai = 0;
+    int geser = 0;
+
+    while (k->p < k->akhir && geser < 64) {
+        unsigned char byte = *k->p++;
+        nilai |= (unsigned long long)(byte & 0x7F) << geser;
+        if (!(byte & 0x80)) return nilai;
+        geser += 7;
+    }
+
+    k->rusak = 1;
+    return 0;
+}
+
+/**
+ * Helper: Mengambil n byte dari kursor, NULL jika melewati batas
+ */
+static const unsigned char *baca_byte(KursorArsip *k, unsigned long long n) {
+    if (k->rusak || n > (unsigned long long)(k->akhir - k->p)) {
+        k->rusak = 1;
+        return NULL;
+    }
+    const unsigned char *awal = k->p;
+    k->p += n;
+    return awal;
+}
+
+/**
+ * Helper: Membaca string berawalan panjang ke dst (maks ukuran-1 karakter)
+ */
+static void baca_teks(KursorArsip *k, char *dst, int ukuran) {
+    unsigned long long len = baca_varint(k);
+    if (len >= (unsigned long long)ukuran) {
+        k->rusak = 1;
+        return;
+    }
+    const unsigned char *p = baca_byte(k, len);
+    if (p == NULL) return;
+
+    memcpy(dst, p, len);
+    dst[len] = '\0';
+}
+
+/**
+ * Helper: Mengompresi src dengan LZ77 greedy ke out.
+ * Urutan: varint panjang literal, literal, lalu (jika belum habis)
+ * varint panjang cocok - LZ_MIN_COCOK dan varint jarak mundur.
+ */
+static void kompres_lz(const unsigned char *src, size_t n, BufferArsip *out) {
+    size_t *tabel = (size_t *)calloc((size_t)1 << LZ_BIT_HASH, sizeof(size_t));
+    if (tabel == NULL) {
+        out->gagal = 1;
+        return;
+    }
+
+    size_t i = 0, awal_literal = 0;
+    while (i + LZ_MIN_COCOK <= n) {
+        unsigned int v;
+        memcpy(&v, src + i, sizeof(v));
+        unsigned int h = (v * 2654435761u) >> (32 - LZ_BIT_HASH);
+        size_t calon = tabel[h];        /* Posisi + 1, 0 = kosong */
+        tabel[h] = i + 1;
+
+        if (calon == 0 || memcmp(src + calon - 1, src + i, LZ_MIN_COCOK) != 0) {
+            i++;
+            continue;
+        }
+
+        size_t j = calon - 1;
+        size_t len = LZ_MIN_COCOK;
+        while (i + len < n && src[j + len] == src[i + len]) len++;
+
+        buffer_varint(out, i - awal_literal);
+        buffer_tambah(out, src + awal_literal, i - awal_literal);
+        buffer_varint(out, len - LZ_MIN_COCOK);
+        buffer_varint(out, i - j);
+
+        /* Daftarkan posisi di dalam rujukan agar pola berikutnya tetap ditemukan */
+        size_t akhir = i + len;
+        for (i++; i < akhir && i + LZ_MIN_COCOK <= n; i++) {
+            memcpy(&v, src + i, sizeof(v));
+            tabel[(v * 2654435761u) >> (32 - LZ_BIT_HASH)] = i + 1;
+        }
+        i = akhir;
+        awal_literal = i;
+    }
+
+    buffer_varint(out, n - awal_literal);
+    buffer_tambah(out, src + awal_literal, n - awal_literal);
+    free(tabel);
+}
+
+/**
+ * Helper: Mendekompresi hasil kompres_lz. Mengembalikan 1 jika tepat n_dst byte dihasilkan.
+ */
+static int dekompres_lz(const unsigned char *src, size_t n, unsigned char *dst, size_t n_dst) {
+    KursorArsip k = { src, src + n, 0 };
+    size_t keluar = 0;
+
+    while (k.p < k.akhir) {
+        unsigned long long literal = baca_varint(&k);
+        if (literal > n_dst - keluar) return 0;
+        const unsigned char *p = baca_byte(&k, literal);
+        if (p == NULL) return 0;
+        memcpy(dst + keluar, p, literal);
+        keluar += literal;
+        if (k.p >= k.akhir) break;
+
+        unsigned long long len = baca_varint(&k) + LZ_MIN_COCOK;
+        unsigned long long jarak = baca_varint(&k);
+        if (k.rusak || jarak == 0 || jarak > keluar || len > n_dst - keluar) return 0;
+
+        /* Salin per byte: rujukan boleh tumpang tindih dengan hasil sendiri */
+        const unsigned char *dari = dst + keluar - jarak;
+        for (unsigned long long i = 0; i < len; i++) dst[keluar + i] = dari[i];
+        keluar += len;
+    }
+
+    return !k.rusak && keluar == n_dst;
+}
+
+/**
+ * Helper: Mengambil nomor ID kanonik "T%04d", 0 jika ID tidak kanonik
+ */
+static int id_kanonik(const char *id, long long *nomor) {
+    if (id[0] != 'T') return 0;
+
+    int len = 0;
+    long long n = 0;
+    for (const char *p = id + 1; *p; p++, len++) {
+        if (*p < '0' || *p > '9' || len >= 9) return 0;
+        n = n * 10 + (*p - '0');
+    }
+    if (len == 0) return 0;
+
+    char buf[MAX_ID_LENGTH + 8];
+    if (!format_id_transaksi((int)n, buf, sizeof(buf))) return 0;
+    if (strcmp(buf, id) != 0) return 0;
+
+    *nomor = n;
+    return 1;
+}
+
+/**
+ * Helper: Mengambil nomor hari tanggal kanonik "dd-mm-YYYY", 0 jika tidak kanonik
+ */
+static int tanggal_kanonik(const char *tanggal, long long *nomor) {
+    int d, m, y;
+    if (!urai_tanggal(tanggal, &d, &m, &y) || y < 1 || y > 9999) return 0;
+
+    char buf[32];
+    format_tanggal(d, m, y, buf);
+    if (strcmp(buf, tanggal) != 0) return 0;
+
+    /* Hanya tanggal yang bolak-balik persis yang dikodekan sebagai nomor hari */
+    long long n = tanggal_ke_nomor_hari(d, m, y);
+    int d2, m2, y2;
+    nomor_hari_ke_tanggal(n, &d2, &m2, &y2);
+    if (d2 != d || m2 != m || y2 != y) return 0;
+
+    *nomor = n;
+    return 1;
+}
+
+/**
+ * Helper: Menulis ID kanonik "T%04d" tanpa sprintf (jalur panas decoder)
+ */
+static void tulis_id_kanonik(long long nomor, char *id) {
+    char angka[24];
+    int len = tulis_desimal_ull((unsigned long long)nomor, angka);
+    int nol = (len < 4) ? 4 - len : 0;
+
+    id[0] = 'T';
+    memset(id + 1, '0', nol);
+    memcpy(id + 1 + nol, angka, len);
+    id[1 + nol + len] = '\0';
+}
+
+/**
+ * Helper: Menambah teks ke kolom dengan tanda "bukan kanonik" (bit terendah 0)
+ */
+static void kolom_teks_mentah(BufferArsip *kolom, const char *teks) {
+    size_t len = strlen(teks);
+    buffer_varint(kolom, (unsigned long long)len << 1);
+    buffer_tambah(kolom, teks, len);
+}
+
+/**
+ * Helper: Mencari atau menambah nama pos ke kamus (tabel hash terbuka).
+ * Mengembalikan indeks kamus, -1 jika alokasi gagal.
+ */
+static int indeks_kamus(const char **kamus, int *jumlah, int *slot, int kapasitas_slot, const char *nama) {
+    unsigned long long h = hash_fnv1a(nama, strlen(nama), HASH_FNV_AWAL);
+    int i = (int)(h & (unsigned long long)(kapasitas_slot - 1));
+
+    while (slot[i] >= 0) {
+        if (strcmp(kamus[slot[i]], nama) == 0) return slot[i];
+        i = (i + 1) & (kapasitas_slot - 1);
+    }
+
+    kamus[*jumlah] = nama;
+    slot[i] = *jumlah;
+    return (*jumlah)++;
+}
+
+/**
+ * Helper: Menutup file baca sambil mencatat byte yang dibaca
+ */
+static void tutup_baca(FILE *fp) {
+    long posisi = ftell(fp);
+    if (posisi > 0) INSTRUMEN_TAMBAH(INS_BYTE_BACA, posisi);
+    fclose(fp);
+}
+
+/**
+ * Helper: Membaca seluruh file ke memori. Mengembalikan buffer (free oleh pemanggil) atau NULL.
+ */
+static unsigned char *baca_file_penuh(const char *filename, size_t *panjang) {
+    INSTRUMEN_TAMBAH(INS_FOPEN, 1);
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t ukuran = (size_t)st.st_size;
+    unsigned char *data = (unsigned char *)malloc(ukuran);
+    size_t terbaca = 0;
+    while (data && terbaca < ukuran) {
+        ssize_t n = read(fd, data + terbaca, ukuran - terbaca);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            free(data);
+            data = NULL;
+            break;
+        }
+        terbaca += (size_t)n;
+    }
+    close(fd);
+
+    if (data) {
+        INSTRUMEN_TAMBAH(INS_BYTE_BACA, ukuran);
+        *panjang = ukuran;
+    }
+    return data;
+}
+
+/**
+ * Helper: Menandai cache daftar tahun agar dipindai ulang
+ */
+static void batalkan_daftar_tahun(void) {
+    pthread_mutex_lock(&kunci_daftar);
+    daftar_valid = 0;
+    pthread_mutex_unlock(&kunci_daftar);
+}
+
+/**
+ * Helper: Pengunjung yang menulis transaksi arsip kembali sebagai baris teks
+ */
+static int kunjungi_tulis_teks(const Transaksi *trx, void *konteks) {
+    penulis_tulis_transaksi((PenulisBaris *)konteks, trx);
+    return 1;
+}
+
+/* ===== IMPLEMENTASI ENCODER & DECODER ===== */
+
+/**
+ * Membuat nama file arsip tahun
+ */
+void dapatkan_nama_file_arsip(int tahun, char *result, int result_size) {
+    if (result == NULL || result_size <= 0) return;
+
+    snprintf(result, result_size, "%s%s_%04d%s", DATA_DIR, FILE_ARSIP_PREFIX, tahun, FILE_ARSIP_EXTENSION);
+}
+
+/**
+ * Menulis transaksi ke file arsip kolom
+ */
+int arsip_tulis(const char *filename, const Transaksi *list, int count) {
+    INSTRUMEN_FUNGSI();
+    if (filename == NULL || count < 0 || (list == NULL && count > 0)) return 0;
+
+    BufferArsip kolom[JUMLAH_KOLOM_ARSIP], kompres[JUMLAH_KOLOM_ARSIP], kepala;
+    memset(kolom, 0, sizeof(kolom));
+    memset(kompres, 0, sizeof(kompres));
+    memset(&kepala, 0, sizeof(kepala));
+
+    /* Kamus pos: tabel hash terbuka berkapasitas pangkat dua >= 2 * count */
+    int kapasitas_slot = 16;
+    while (kapasitas_slot < 2 * count) kapasitas_slot *= 2;
+    const char **kamus = (const char **)malloc((size_t)(count + 1) * sizeof(char *));
+    int *slot = (int *)malloc((size_t)kapasitas_slot * sizeof(int));
+    int jumlah_kamus = 0;
+    int ok = (kamus != NULL && slot != NULL);
+    if (ok) memset(slot, -1, (size_t)kapasitas_slot * sizeof(int));
+
+    long long id_lalu = 0, hari_lalu = 0;
+    for (int i = 0; ok && i < count; i++) {
+        const Transaksi *trx = &list[i];
+        long long nomor;
+
+        /* Bit terendah 1: selisih kanonik (zigzag); 0: teks apa adanya */
+        if (id_kanonik(trx->id, &nomor)) {
+            buffer_varint(&kolom[KOLOM_ID], zigzag(nomor - id_lalu) << 1 | 1);
+            id_lalu = nomor;
+        } else {
+            kolom_teks_mentah(&kolom[KOLOM_ID], trx->id);
+        }
+
+        if (tanggal_kanonik(trx->tanggal, &nomor)) {
+            buffer_varint(&kolom[KOLOM_TANGGAL], zigzag(nomor - hari_lalu) << 1 | 1);
+            hari_lalu = nomor;
+        } else {
+            kolom_teks_mentah(&kolom[KOLOM_TANGGAL], trx->tanggal);
+        }
+
+        buffer_varint(&kolom[KOLOM_JENIS], zigzag(trx->jenis));
+        buffer_varint(&kolom[KOLOM_POS],
+                      (unsigned long long)indeks_kamus(kamus, &jumlah_kamus, slot, kapasitas_slot, trx->pos));
+        buffer_varint(&kolom[KOLOM_NOMINAL], trx->nominal);
+
+        size_t len = strlen(trx->deskripsi);
+        buffer_varint(&kolom[KOLOM_DESKRIPSI], len);
+        buffer_tambah(&kolom[KOLOM_DESKRIPSI], trx->deskripsi, len);
+    }
+
+    /* Kolom berurutan (selisih +1, jenis berulang) menyusut drastis oleh LZ77 */
+    for (int k = 0; ok && k < JUMLAH_KOLOM_ARSIP; k++) {
+        kompres_lz(kolom[k].data ? kolom[k].data : (const unsigned char *)"", kolom[k].panjang, &kompres[k]);
+    }
+
+    /* Kepala: magic, versi, jumlah, panjang kolom (mentah, terkompresi), lalu kamus */
+    buffer_tambah(&kepala, MAGIC_ARSIP, PANJANG_MAGIC_ARSIP);
+    buffer_varint(&kepala, VERSI_ARSIP);
+    buffer_varint(&kepala, (unsigned long long)count);
+    buffer_varint(&kepala, (unsigned long long)jumlah_kamus);
+    for (int k = 0; k < JUMLAH_KOLOM_ARSIP; k++) {
+        buffer_varint(&kepala, kolom[k].panjang);
+        buffer_varint(&kepala, kompres[k].panjang);
+    }
+    for (int i = 0; ok && i < jumlah_kamus; i++) {
+        size_t len = strlen(kamus[i]);
+        buffer_varint(&kepala, len);
+        buffer_tambah(&kepala, kamus[i], len);
+    }
+
+    for (int k = 0; k < JUMLAH_KOLOM_ARSIP; k++) ok = ok && !kolom[k].gagal && !kompres[k].gagal;
+    ok = ok && !kepala.gagal;
+
+    char temp_name[MAX_PATH + 8];
+    snprintf(temp_name, sizeof(temp_name), "%s.tmp", filename);
+
+    PenulisBaris w;
+    if (ok && penulis_buka(&w, temp_name)) {
+        unsigned long long hash = HASH_FNV_AWAL;
+        BufferArsip *bagian[JUMLAH_KOLOM_ARSIP + 1];
+        bagian[0] = &kepala;
+        for (int k = 0; k < JUMLAH_KOLOM_ARSIP; k++) bagian[k + 1] = &kompres[k];
+
+        for (int k = 0; k < JUMLAH_KOLOM_ARSIP + 1; k++) {
+            if (bagian[k]->panjang == 0) continue;
+            penulis_tulis(&w, (const char *)bagian[k]->data, (int)bagian[k]->panjang);
+            hash = hash_fnv1a(bagian[k]->data, bagian[k]->panjang, hash);
+        }
+
+        unsigned char ekor[8];
+        for (int i = 0; i < 8; i++) ekor[i] = (unsigned char)(hash >> (8 * i));
+        penulis_tulis(&w, (const char *)ekor, sizeof(ekor));
+
+        ok = penulis_tutup(&w);
+        if (ok) ok = ganti_file(temp_name, filename);
+        if (!ok) remove(temp_name);
+    } else {
+        ok = 0;
+    }
+
+    for (int k = 0; k < JUMLAH_KOLOM_ARSIP; k++) {
+        free(kolom[k].data);
+        free(kompres[k].data);
+    }
+    free(kepala.data);
+    free(kamus);
+    free(slot);
+    return ok;
+}
+
+/**
+ * Menelusuri transaksi di satu file arsip
+ */
+int arsip_telusuri(const char *filename, int bulan, PengunjungTransaksi kunjungi, void *konteks, int *berhenti) {
+    INSTRUMEN_FUNGSI();
+    if (berhenti) *berhenti = 0;
+    if (filename == NULL || kunjungi == NULL || bulan < 0 || bulan > 12) return -1;
+
+    size_t ukuran = 0;
+    unsigned char *data = baca_file_penuh(filename, &ukuran);
+    if (data == NULL) return -1;
+
+    /* Magic dan hash ekor harus cocok sebelum isi dipercaya */
+    if (ukuran < PANJANG_MAGIC_ARSIP + 8 || memcmp(data, MAGIC_ARSIP, PANJANG_MAGIC_ARSIP) != 0) {
+        free(data);
+        return -1;
+    }
+    unsigned long long hash_simpan = 0;
+    for (int i = 0; i < 8; i++) hash_simpan |= (unsigned long long)data[ukuran - 8 + i] << (8 * i);
+    if (hash_fnv1a(data, ukuran - 8, HASH_FNV_AWAL) != hash_simpan) {
+        free(data);
+        return -1;
+    }
+
+    KursorArsip kepala = { data + PANJANG_MAGIC_ARSIP, data + ukuran - 8, 0 };
+    unsigned long long versi = baca_varint(&kepala);
+    unsigned long long jumlah = baca_varint(&kepala);
+    unsigned long long jumlah_kamus = baca_varint(&kepala);
+    unsigned long long panjang_mentah[JUMLAH_KOLOM_ARSIP], panjang_kompres[JUMLAH_KOLOM_ARSIP];
+    int ok = 1;
+    for (int k = 0; k < JUMLAH_KOLOM_ARSIP; k++) {
+        panjang_mentah[k] = baca_varint(&kepala);
+        panjang_kompres[k] = baca_varint(&kepala);
+        /* Satu baris paling banyak MAX_BYTE_BARIS_ARSIP byte per kolom */
+        if (panjang_mentah[k] > jumlah * MAX_BYTE_BARIS_ARSIP) ok = 0;
+    }
+
+    /* Kamus minimal satu byte per entri */
+    if (!ok || kepala.rusak || versi != VERSI_ARSIP || jumlah > INT_MAX / MAX_BYTE_BARIS_ARSIP ||
+        jumlah_kamus > (unsigned long long)(kepala.akhir - kepala.p)) {
+        free(data);
+        return -1;
+    }
+
+    RentangTeks *kamus = (RentangTeks *)malloc((size_t)(jumlah_kamus + 1) * sizeof(RentangTeks));
+    for (unsigned long long i = 0; kamus && i < jumlah_kamus; i++) {
+        unsigned long long len = baca_varint(&kepala);
+        const unsigned char *p = baca_byte(&kepala, len);
+        if (p == NULL || len > MAX_POS_LENGTH) {
+            kepala.rusak = 1;
+            break;
+        }
+        kamus[i].ptr = (const char *)p;
+        kamus[i].len = (int)len;
+    }
+    ok = (kamus != NULL);
+
+    /* Dekompresi setiap kolom ke buffernya sendiri */
+    unsigned char *mentah[JUMLAH_KOLOM_ARSIP];
+    KursorArsip kolom[JUMLAH_KOLOM_ARSIP];
+    for (int k = 0; k < JUMLAH_KOLOM_ARSIP; k++) {
+        const unsigned char *p = baca_byte(&kepala, panjang_kompres[k]);
+        mentah[k] = ok ? (unsigned char *)malloc(panjang_mentah[k] ? (size_t)panjang_mentah[k] : 1) : NULL;
+        ok = ok && p != NULL && mentah[k] != NULL &&
+             dekompres_lz(p, (size_t)panjang_kompres[k], mentah[k], (size_t)panjang_mentah[k]);
+
+        kolom[k].p = mentah[k];
+        kolom[k].akhir = mentah[k] ? mentah[k] + panjang_mentah[k] : NULL;
+        kolom[k].rusak = 0;
+    }
+    ok = ok && !kepala.rusak && kepala.p == kepala.akhir;
+
+    long long id_lalu = 0, hari_lalu = 0;
+    int dikunjungi = 0;
+    Transaksi trx;
+
+    /* Tanggal berurutan: diformat ulang hanya saat berganti hari */
+    long long hari_terformat = -1;
+    char tanggal_terformat[sizeof(trx.tanggal)] = "";
+    int bulan_terformat = 0;
+
+    for (unsigned long long i = 0; ok && i < jumlah; i++) {
+        memset(&trx, 0, sizeof(Transaksi));
+        int bulan_trx = 0;
+
+        unsigned long long v = baca_varint(&kolom[KOLOM_ID]);
+        if (v & 1) {
+            id_lalu += unzigzag(v >> 1);
+            if (id_lalu < 0 || id_lalu > 999999999LL) kolom[KOLOM_ID].rusak = 1;
+            else tulis_id_kanonik(id_lalu, trx.id);
+        } else {
+            const unsigned char *p = baca_byte(&kolom[KOLOM_ID], v >> 1);
+            if (p && (v >> 1) < sizeof(trx.id)) memcpy(trx.id, p, v >> 1);
+            else kolom[KOLOM_ID].rusak = 1;
+        }
+
+        v = baca_varint(&kolom[KOLOM_TANGGAL]);
+        if (v & 1) {
+            hari_lalu += unzigzag(v >> 1);
+            if (hari_lalu != hari_terformat) {
+                int d, y;
+                nomor_hari_ke_tanggal(hari_lalu, &d, &bulan_terformat, &y);
+                if (y < 1 || y > 9999) kolom[KOLOM_TANGGAL].rusak = 1;
+                else format_tanggal(d, bulan_terformat, y, tanggal_terformat);
+                hari_terformat = hari_lalu;
+            }
+            memcpy(trx.tanggal, tanggal_terformat, sizeof(trx.tanggal));
+            bulan_trx = bulan_terformat;
+        } else {
+            const unsigned char *p = baca_byte(&kolom[KOLOM_TANGGAL], v >> 1);
+            if (p && (v >> 1) < sizeof(trx.tanggal)) memcpy(trx.tanggal, p, v >> 1);
+            else kolom[KOLOM_TANGGAL].rusak = 1;
+            /* Filter bulan sama dengan telusuri_transaksi: tanggal gagal diurai tidak cocok */
+            Tanggal tgl;
+            if (urai_tanggal_struct(trx.tanggal, &tgl)) bulan_trx = tgl.bulan;
+        }
+
+        trx.jenis = (int)unzigzag(baca_varint(&kolom[KOLOM_JENIS]));
+
+        unsigned long long indeks = baca_varint(&kolom[KOLOM_POS]);
+        if (indeks < jumlah_kamus) memcpy(trx.pos, kamus[indeks].ptr, kamus[indeks].len);
+        else kolom[KOLOM_POS].rusak = 1;
+
+        trx.nominal = baca_varint(&kolom[KOLOM_NOMINAL]);
+        baca_teks(&kolom[KOLOM_DESKRIPSI], trx.deskripsi, sizeof(trx.deskripsi));
+
+        for (int k = 0; k < JUMLAH_KOLOM_ARSIP; k++) ok = ok && !kolom[k].rusak;
+        if (!ok) break;
+
+        INSTRUMEN_TAMBAH(INS_BARIS_URAI, 1);
+        if (bulan > 0 && bulan_trx != bulan) continue;
+
+        dikunjungi++;
+        int lanjut = kunjungi(&trx, konteks);
+        if (lanjut < 0) {
+            ok = 0;
+            break;
+        }
+        if (lanjut == 0) {
+            if (berhenti) *berhenti = 1;
+            break;
+        }
+    }
+
+    for (int k = 0; k < JUMLAH_KOLOM_ARSIP; k++) free(mentah[k]);
+    free(kamus);
+    free(data);
+    return ok ? dikunjungi : -1;
+}
+
+/* ===== IMPLEMENTASI DAFTAR ARSIP ===== */
+
+/**
+ * Mendapatkan daftar tahun yang memiliki arsip, urut naik
+ */
+int daftar_tahun_arsip(int *tahun, int maks) {
+    if (tahun == NULL || maks <= 0) return 0;
+
+    struct stat st;
+    if (stat(DATA_DIR, &st) != 0) return 0;
+
+    pthread_mutex_lock(&kunci_daftar);
+    int sama = daftar_valid &&
+               st.st_ino == stat_daftar.st_ino && st.st_dev == stat_daftar.st_dev &&
+               st.st_mtim.tv_sec == stat_daftar.st_mtim.tv_sec &&
+               st.st_mtim.tv_nsec == stat_daftar.st_mtim.tv_nsec &&
+               st.st_ctim.tv_sec == stat_daftar.st_ctim.tv_sec &&
+               st.st_ctim.tv_nsec == stat_daftar.st_ctim.tv_nsec;
+
+    if (!sama) {
+        jumlah_daftar = 0;
+        DIR *dir = opendir(DATA_DIR);
+        struct dirent *entri;
+        while (dir && (entri = readdir(dir)) != NULL) {
+            int t;
+            char nama[MAX_PATH], akhiran[8];
+            if (sscanf(entri->d_name, FILE_ARSIP_PREFIX "_%d%7s", &t, akhiran) != 2) continue;
+
+            /* Hanya nama persis arsip_YYYY.bin (bukan .tmp atau variasi lain) */
+            snprintf(nama, sizeof(nama), "%s_%04d%s", FILE_ARSIP_PREFIX, t, FILE_ARSIP_EXTENSION);
+            if (strcmp(nama, entri->d_name) != 0 || jumlah_daftar >= MAKS_TAHUN_ARSIP) continue;
+
+            /* Sisip terurut */
+            int i = jumlah_daftar++;
+            while (i > 0 && daftar_tahun[i - 1] > t) {
+                daftar_tahun[i] = daftar_tahun[i - 1];
+                i--;
+            }
+            daftar_tahun[i] = t;
+        }
+        if (dir) closedir(dir);
+        stat_daftar = st;
+        daftar_valid = 1;
+    }
+
+    int n = (jumlah_daftar < maks) ? jumlah_daftar : maks;
+    memcpy(tahun, daftar_tahun, (size_t)n * sizeof(int));
+    pthread_mutex_unlock(&kunci_daftar);
+
+    return n;
+}
+
+/**
+ * Menelusuri transaksi di semua arsip, urut tahun
+ */
+int telusuri_arsip(int bulan, PengunjungTransaksi kunjungi, void *konteks, int *berhenti) {
+    if (berhenti) *berhenti = 0;
+
+    int tahun[MAKS_TAHUN_ARSIP];
+    int jumlah = daftar_tahun_arsip(tahun, MAKS_TAHUN_ARSIP);
+    int total = 0;
+
+    for (int i = 0; i < jumlah; i++) {
+        char filename[MAX_PATH];
+        int stop = 0;
+        dapatkan_nama_file_arsip(tahun[i], filename, sizeof(filename));
+
+        int n = arsip_telusuri(filename, bulan, kunjungi, konteks, &stop);
+        if (n < 0) return -1;
+        total += n;
+        if (stop) {
+            if (berhenti) *berhenti = 1;
+            break;
+        }
+    }
+
+    return total;
+}
+
+/**
+ * Memeriksa apakah tahun sudah disegel
+ */
+int cek_tahun_tersegel(int tahun) {
+    int daftar[MAKS_TAHUN_ARSIP];
+    int jumlah = daftar_tahun_arsip(daftar, MAKS_TAHUN_ARSIP);
+
+    for (int i = 0; i < jumlah; i++) {
+        if (daftar[i] == tahun) return 1;
+    }
+    return 0;
+}
+
+/**
+ * Memeriksa apakah tanggal berada di tahun yang disegel
+ */
+int cek_tanggal_tersegel(const char *tanggal) {
+    int tahun = ekstrak_tahun(tanggal);
+    return tahun > 0 && cek_tahun_tersegel(tahun);
+}
+
+/* ===== IMPLEMENTASI SEGEL & BUKA SEGEL ===== */
+
+/**
+ * Helper: Membuat nama file jurnal segel
+ */
+static void dapatkan_nama_file_jurnal(char *result, int result_size) {
+    snprintf(result, result_size, "%s%s", DATA_DIR, FILE_JURNAL_SEGEL);
+}
+
+/**
+ * Helper: Mencatat operasi segel/buka segel yang sedang berjalan
+ */
+static int tulis_jurnal_segel(const char *aksi, int tahun) {
+    char nama[MAX_PATH], line[32];
+    PenulisBaris w;
+    dapatkan_nama_file_jurnal(nama, sizeof(nama));
+    if (!penulis_buka(&w, nama)) return 0;
+
+    snprintf(line, sizeof(line), "%s %04d", aksi, tahun);
+    penulis_tulis_baris(&w, line);
+    return penulis_tutup(&w);
+}
+
+/**
+ * Helper: Menghapus jurnal setelah operasi selesai atau dibatalkan
+ */
+static void hapus_jurnal_segel(void) {
+    char nama[MAX_PATH];
+    dapatkan_nama_file_jurnal(nama, sizeof(nama));
+    remove(nama);
+}
+
+/**
+ * Helper: Menulis file teks sementara tanpa baris tahun tertentu.
+ * Jika nama_arsip diisi, isi arsip ditulis lebih dulu (buka segel); jika kumpul
+ * diisi, baris tahun itu dikumpulkan ke list (segel). Mengembalikan jumlah
+ * transaksi arsip atau yang dikumpulkan, atau -1 jika gagal.
+ */
+static int tulis_teks_tanpa_tahun(int tahun, const char *nama_arsip, ListTransaksi *kumpul,
+                                  const char *temp_name, char *error_msg) {
+    char filename[MAX_PATH];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+
+    PenulisBaris out;
+    if (!penulis_buka(&out, temp_name)) {
+        atur_pesan_error(error_msg, "Gagal membuat file sementara");
+        return -1;
+    }
+
+    /* Urutan tampil tidak berubah: arsip memang ditelusuri sebelum file teks */
+    int jumlah = 0;
+    if (nama_arsip) {
+        jumlah = arsip_telusuri(nama_arsip, 0, kunjungi_tulis_teks, &out, NULL);
+        if (jumlah < 0) atur_pesan_error(error_msg, "Arsip rusak atau tidak terbaca");
+    }
+
+    /* Baris tahun tersebut keluar dari file teks; baris lain (termasuk yang rusak) tetap */
+    FILE *in = buka_file_baca(filename);
+    if (in && jumlah >= 0) {
+        char line[MAX_LINE_LENGTH];
+        Transaksi trx;
+        while (fgets(line, sizeof(line), in)) {
+            hapus_newline_string(line);
+            if (strlen(line) == 0) continue;
+
+            if (urai_baris_transaksi(line, &trx) && ekstrak_tahun(trx.tanggal) == tahun) {
+                if (!kumpul) continue;
+                if (!tambah_ke_list_transaksi(kumpul, &trx)) {
+                    atur_pesan_error(error_msg, "Memori tidak cukup");
+                    jumlah = -1;
+                    break;
+                }
+                jumlah++;
+                continue;
+            }
+            penulis_tulis_baris(&out, line);
+        }
+    }
+    if (in) tutup_baca(in);
+
+    if (!penulis_tutup(&out) && jumlah >= 0) {
+        atur_pesan_error(error_msg, "Gagal menulis file transaksi");
+        jumlah = -1;
+    }
+    if (jumlah < 0) remove(temp_name);
+    return jumlah;
+}
+
+/**
+ * Helper: Menulis ulang file teks tanpa baris tahun tertentu lalu menggantinya.
+ * Dipakai buka segel dan pemulihan; aman diulang dari keadaan mana pun.
+ */
+static int ganti_teks_tanpa_tahun(int tahun, const char *nama_arsip, char *error_msg) {
+    char filename[MAX_PATH], temp_name[MAX_PATH + 8];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+    snprintf(temp_name, sizeof(temp_name), "%s.tmp", filename);
+
+    int jumlah = tulis_teks_tanpa_tahun(tahun, nama_arsip, NULL, temp_name, error_msg);
+    if (jumlah < 0) return -1;
+
+    if (!ganti_file(temp_name, filename)) {
+        remove(temp_name);
+        atur_pesan_error(error_msg, "Gagal mengganti file transaksi");
+        return -1;
+    }
+    return jumlah;
+}
+
+/**
+ * Menyegel satu tahun: transaksinya pindah dari file teks ke arsip
+ */
+int segel_tahun(int tahun, char *error_msg) {
+    INSTRUMEN_FUNGSI();
+    if (tahun < TAHUN_ARSIP_MIN || tahun >= dapatkan_tahun_saat_ini()) {
+        atur_pesan_error(error_msg, "Hanya tahun yang sudah lewat yang bisa disegel");
+        return -1;
+    }
+    if (cek_tahun_tersegel(tahun)) {
+        atur_pesan_error(error_msg, "Tahun sudah disegel");
+        return -1;
+    }
+
+    pastikan_direktori_data();
+    char filename[MAX_PATH], temp_name[MAX_PATH + 8], nama_arsip[MAX_PATH];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+    snprintf(temp_name, sizeof(temp_name), "%s.tmp", filename);
+    dapatkan_nama_file_arsip(tahun, nama_arsip, sizeof(nama_arsip));
+
+    if (!cek_file_ada(filename)) {
+        atur_pesan_error(error_msg, "Tidak ada transaksi pada tahun tersebut");
+        return -1;
+    }
+
+    ListTransaksi arsip;
+    if (!inisialisasi_list_transaksi(&arsip, 1024)) {
+        atur_pesan_error(error_msg, "Memori tidak cukup");
+        return -1;
+    }
+    if (!tulis_jurnal_segel(JURNAL_SEGEL, tahun)) {
+        bebaskan_list_transaksi(&arsip);
+        atur_pesan_error(error_msg, "Gagal menulis jurnal segel");
+        return -1;
+    }
+
+    int jumlah = tulis_teks_tanpa_tahun(tahun, NULL, &arsip, temp_name, error_msg);
+    if (jumlah == 0) {
+        remove(temp_name);
+        atur_pesan_error(error_msg, "Tidak ada transaksi pada tahun tersebut");
+        jumlah = -1;
+    } else if (jumlah > 0 && !arsip_tulis(nama_arsip, arsip.data, arsip.count)) {
+        remove(temp_name);
+        atur_pesan_error(error_msg, "Gagal menulis arsip");
+        jumlah = -1;
+    } else if (jumlah > 0 && !ganti_file(temp_name, filename)) {
+        /* Arsip sudah utuh di disk; jika baris teks gagal dibuang, arsip dibatalkan */
+        remove(temp_name);
+        remove(nama_arsip);
+        atur_pesan_error(error_msg, "Gagal mengganti file transaksi");
+        jumlah = -1;
+    }
+
+    hapus_jurnal_segel();
+    bebaskan_list_transaksi(&arsip);
+    batalkan_daftar_tahun();
+    return jumlah;
+}
+
+/**
+ * Membuka segel tahun: transaksi arsip kembali ke awal file teks
+ */
+int buka_segel_tahun(int tahun, char *error_msg) {
+    INSTRUMEN_FUNGSI();
+    if (!cek_tahun_tersegel(tahun)) {
+        atur_pesan_error(error_msg, "Tahun tidak disegel");
+        return -1;
+    }
+
+    pastikan_direktori_data();
+    char nama_arsip[MAX_PATH];
+    dapatkan_nama_file_arsip(tahun, nama_arsip, sizeof(nama_arsip));
+
+    if (!tulis_jurnal_segel(JURNAL_BUKA_SEGEL, tahun)) {
+        atur_pesan_error(error_msg, "Gagal menulis jurnal segel");
+        return -1;
+    }
+
+    int jumlah = ganti_teks_tanpa_tahun(tahun, nama_arsip, error_msg);
+    if (jumlah >= 0) remove(nama_arsip);
+
+    hapus_jurnal_segel();
+    batalkan_daftar_tahun();
+    return jumlah;
+}
+
+/**
+ * Menuntaskan segel/buka segel yang terhenti di tengah jalan
+ */
+int pulihkan_segel(char *error_msg) {
+    char nama[MAX_PATH];
+    dapatkan_nama_file_jurnal(nama, sizeof(nama));
+
+    FILE *in = buka_file_baca(nama);
+    if (!in) return 1;
+
+    char line[32], aksi[16];
+    int tahun = 0, dikenali = 0;
+    if (fgets(line, sizeof(line), in) && sscanf(line, "%15s %d", aksi, &tahun) == 2) {
+        dikenali = strcmp(aksi, JURNAL_SEGEL) == 0 || strcmp(aksi, JURNAL_BUKA_SEGEL) == 0;
+    }
+    tutup_baca(in);
+
+    /* Jurnal ditulis sebelum perubahan apa pun: jurnal tidak utuh berarti belum ada yang berubah */
+    char nama_arsip[MAX_PATH];
+    dapatkan_nama_file_arsip(tahun, nama_arsip, sizeof(nama_arsip));
+    if (dikenali && cek_file_ada(nama_arsip)) {
+        /* Arsip utuh adalah sumber kebenaran tahun itu. Segel: buang baris teks tahun itu.
+           Buka segel: tulis ulang isi arsip ke file teks (baris lama tahun itu dibuang
+           agar tidak ganda) lalu hapus arsip. */
+        int buka = strcmp(aksi, JURNAL_BUKA_SEGEL) == 0;
+        if (ganti_teks_tanpa_tahun(tahun, buka ? nama_arsip : NULL, error_msg) < 0) return 0;
+        if (buka) remove(nama_arsip);
+    }
+
+    hapus_jurnal_segel();
+    batalkan_daftar_tahun();
+    return 1;
+}
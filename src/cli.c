@@ -0,0 +1,579 @@
+/*
+ * =============================================================================
+ * File        : cli.c
+ * Deskripsi   : Implementasi mode perintah non-interaktif (batch CLI)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan perintah baris-perintah yang memanggil fungsi
+ * mesin (transaksi, pos, analisis) secara langsung tanpa ncurses.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h     : Untuk keluaran ke stdout/stderr dan membaca file
+ * - stdlib.h    : Untuk atoi
+ * - string.h    : Untuk manipulasi string
+ * - cli.h       : Header file modul ini
+ * - transaksi.h : Untuk tambah_transaksi_dengan_id
+ * - pos.h       : Untuk ambil_daftar_pos
+ * - analisis.h  : Untuk hitung_analisis_bulan
+ * - file.h      : Untuk muat_transaksi_ke_list dan kompaksi file transaksi
+ * - pekerja.h   : Untuk perhitungan ulang (langsung atau ditunda)
+ * - rekap.h     : Untuk perhitungan ulang seluruh bulan sekaligus
+ * - impor.h     : Untuk impor massal CSV/TSV
+ * - ekspor.h    : Untuk list dan export (TSV/CSV/JSON) secara streaming
+ * - arsip.h     : Untuk segel, buka segel, dan pemulihan segel yang terhenti
+ * - periode.h   : Untuk tutup, buka, dan verifikasi periode bulan
+ * - manifes.h   : Untuk sinkronisasi manifes data
+ * - utils.h     : Untuk validasi dan konversi
+ *
+ * CATATAN:
+ * Semua perintah mengembalikan kode keluar; tidak ada yang memanggil exit().
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cli.h"
+#include "transaksi.h"
+#include "pos.h"
+#include "analisis.h"
+#include "file.h"
+#include "pekerja.h"
+#include "rekap.h"
+#include "impor.h"
+#include "ekspor.h"
+#include "arsip.h"
+#include "periode.h"
+#include "manifes.h"
+#include "utils.h"
+
+/* ===== KONSTANTA LOKAL ===== */
+#define KOLOM_TRANSAKSI "id\ttanggal\tjenis\tpos\tnominal\tdeskripsi"
+#define KOLOM_POS       "no\tnama\tanggaran\trealisasi\tsisa\tjumlah_transaksi\tstatus"
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Menampilkan cara pakai ke stream
+ */
+static void tampilkan_bantuan_cli(FILE *out, const char *program) {
+    fprintf(out,
+        "Penggunaan: %s <perintah> [opsi]\n"
+        "\n"
+        "Tanpa perintah, aplikasi berjalan dalam mode TUI interaktif.\n"
+        "\n"
+        "Perintah:\n"
+        "  add     --tanggal dd-mm-YYYY --jenis pemasukan|pengeluaran --pos NAMA\n"
+        "          --nominal N [--deskripsi TEKS]\n"
+        "  list    [transaksi|pos] [--bulan 1-12]\n"
+        "  report  [--bulan 1-12]\n"
+        "  recalc  [--bulan 1-12]\n"
+        "  import  FILE|- [--format csv|tsv]\n"
+        "          (kolom: tanggal, jenis, pos, nominal, deskripsi)\n"
+        "  export  [transaksi|pos|analisis] [--bulan 1-12] [--format tsv|csv|json]\n"
+        "          [--keluar FILE]\n"
+        "  seal    --tahun YYYY   (arsipkan tahun yang sudah lewat, hanya baca)\n"
+        "  unseal  --tahun YYYY   (kembalikan arsip tahun ke file transaksi)\n"
+        "  close   --bulan 1-12   (bekukan bulan beserta analisis dan pos akhirnya)\n"
+        "  reopen  --bulan 1-12   (buka kembali bulan yang ditutup)\n"
+        "  verify  [--bulan 1-12] (periksa checksum snapshot bulan yang ditutup)\n"
+        "  sync    (periksa manifes data, bangun ulang bulan yang berubah saja)\n"
+        "  compact (pindahkan baris rusak transaksi ke data/transaksi.txt.rusak)\n"
+        "  help\n"
+        "\n"
+        "Keluaran dipisah TAB dengan baris nama kolom. Kode keluar: 0 sukses,\n"
+        "1 gagal, 2 salah pemakaian.\n",
+        program);
+}
+
+/**
+ * Helper: Mencetak pesan kesalahan ke stderr dan mengembalikan kode keluar
+ */
+static int gagal(int kode, const char *pesan, const char *detail) {
+    if (detail) {
+        fprintf(stderr, "error: %s: %s\n", pesan, detail);
+    } else {
+        fprintf(stderr, "error: %s\n", pesan);
+    }
+    return kode;
+}
+
+/**
+ * Helper: Memeriksa semua opsi "--x" termasuk daftar yang diizinkan (diakhiri NULL)
+ * dan setiap opsi memiliki nilai
+ */
+static int periksa_opsi(int argc, char *argv[], const char *const *diizinkan) {
+    for (int i = 2; i < argc; i++) {
+        if (strncmp(argv[i], "--", 2) != 0) continue;
+
+        const char *nama = argv[i] + 2;
+        size_t len = strcspn(nama, "=");
+        int dikenal = 0;
+        for (int k = 0; diizinkan[k]; k++) {
+            if (strlen(diizinkan[k]) == len && strncmp(diizinkan[k], nama, len) == 0) {
+                dikenal = 1;
+                break;
+            }
+        }
+        if (!dikenal) {
+            gagal(CLI_SALAH_PAKAI, "opsi tidak dikenal", argv[i]);
+            return 0;
+        }
+        if (nama[len] != '=') {
+            if (i + 1 >= argc) {
+                gagal(CLI_SALAH_PAKAI, "opsi membutuhkan nilai", argv[i]);
+                return 0;
+            }
+            i++;  /* Lewati nilai opsi */
+        }
+    }
+    return 1;
+}
+
+/**
+ * Helper: Mengambil nilai opsi "--nama NILAI" atau "--nama=NILAI", NULL jika tidak ada
+ */
+static const char *ambil_opsi(int argc, char *argv[], const char *nama) {
+    size_t len = strlen(nama);
+    for (int i = 2; i < argc; i++) {
+        if (strncmp(argv[i], "--", 2) != 0) continue;
+        const char *arg = argv[i] + 2;
+        if (strncmp(arg, nama, len) != 0) continue;
+        if (arg[len] == '=') return arg + len + 1;
+        if (arg[len] == '\0' && i + 1 < argc) return argv[i + 1];
+    }
+    return NULL;
+}
+
+/**
+ * Helper: Mengambil argumen posisi ke-n (bukan opsi), NULL jika tidak ada
+ */
+static const char *ambil_posisi(int argc, char *argv[], int n) {
+    for (int i = 2; i < argc; i++) {
+        if (strncmp(argv[i], "--", 2) == 0) {
+            if (!strchr(argv[i], '=')) i++;  /* Lewati nilai opsi */
+            continue;
+        }
+        if (n-- == 0) return argv[i];
+    }
+    return NULL;
+}
+
+/**
+ * Helper: Mengurai opsi --bulan. Mengembalikan bulan 1-12, nilai_default jika
+ * tidak ada, atau -1 jika tidak valid
+ */
+static int ambil_opsi_bulan(int argc, char *argv[], int nilai_default) {
+    const char *str = ambil_opsi(argc, argv, "bulan");
+    if (!str) return nilai_default;
+    if (!cek_string_numerik(str)) return -1;
+
+    int bulan = atoi(str);
+    return cek_valid_bulan(bulan) ? bulan : -1;
+}
+
+/**
+ * Helper: Mengurai opsi --tahun wajib. Mengembalikan tahun, atau -1 jika tidak ada/tidak valid
+ */
+static int ambil_opsi_tahun(int argc, char *argv[]) {
+    const char *str = ambil_opsi(argc, argv, "tahun");
+    if (!str || !cek_string_numerik(str) || strlen(str) != 4) return -1;
+    return atoi(str);
+}
+
+/**
+ * Helper: Menulis satu transaksi sebagai baris TAB
+ */
+static void tulis_baris_transaksi(FILE *out, const Transaksi *trx) {
+    fprintf(out, "%s\t%s\t%s\t%s\t%llu\t%s\n",
+            trx->id, trx->tanggal, dapatkan_label_jenis(trx->jenis),
+            trx->pos, trx->nominal, trx->deskripsi);
+}
+
+/**
+ * Helper: Menulis daftar transaksi (bulan 0 = semua) ke stream
+ */
+static int tulis_daftar_transaksi(FILE *out, int bulan) {
+    if (ekspor_ke_stream(out, EKSPOR_DATA_TRANSAKSI, EKSPOR_FORMAT_TSV, bulan) < 0) {
+        return gagal(CLI_GAGAL, "gagal menulis transaksi", NULL);
+    }
+    return CLI_SUKSES;
+}
+
+/* ===== IMPLEMENTASI PERINTAH ===== */
+
+/**
+ * Perintah add: menambah satu transaksi
+ */
+static int perintah_add(int argc, char *argv[]) {
+    static const char *const opsi[] = { "tanggal", "jenis", "pos", "nominal", "deskripsi", NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    const char *tanggal = ambil_opsi(argc, argv, "tanggal");
+    const char *jenis_str = ambil_opsi(argc, argv, "jenis");
+    const char *pos = ambil_opsi(argc, argv, "pos");
+    const char *nominal_str = ambil_opsi(argc, argv, "nominal");
+    const char *deskripsi = ambil_opsi(argc, argv, "deskripsi");
+
+    if (!tanggal || !jenis_str || !pos || !nominal_str) {
+        return gagal(CLI_SALAH_PAKAI, "add membutuhkan --tanggal, --jenis, --pos, dan --nominal", NULL);
+    }
+
+    int jenis = urai_jenis_transaksi(jenis_str);
+    if (jenis < 0) return gagal(CLI_SALAH_PAKAI, "jenis tidak valid", jenis_str);
+
+    unsigned long long nominal;
+    if (!urai_nominal(nominal_str, &nominal)) {
+        return gagal(CLI_SALAH_PAKAI, "nominal tidak valid", nominal_str);
+    }
+
+    char id[sizeof(((Transaksi *)0)->id)];
+    char error_msg[256] = "";
+    if (!tambah_transaksi_dengan_id(tanggal, jenis, pos, nominal, deskripsi, id, error_msg)) {
+        return gagal(CLI_GAGAL, "gagal menambah transaksi", error_msg);
+    }
+
+    Transaksi trx;
+    if (!cari_transaksi_berdasarkan_id(id, &trx)) {
+        return gagal(CLI_GAGAL, "transaksi tersimpan tetapi tidak terbaca", id);
+    }
+
+    printf("%s\n", KOLOM_TRANSAKSI);
+    tulis_baris_transaksi(stdout, &trx);
+    return CLI_SUKSES;
+}
+
+/**
+ * Perintah list: menampilkan transaksi atau pos anggaran
+ */
+static int perintah_list(int argc, char *argv[]) {
+    static const char *const opsi[] = { "bulan", NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    const char *objek = ambil_posisi(argc, argv, 0);
+    if (!objek) objek = "transaksi";
+
+    if (strcmp(objek, "transaksi") == 0) {
+        int bulan = ambil_opsi_bulan(argc, argv, 0);
+        if (bulan < 0) return gagal(CLI_SALAH_PAKAI, "bulan harus 1-12", NULL);
+        return tulis_daftar_transaksi(stdout, bulan);
+    }
+
+    if (strcmp(objek, "pos") == 0) {
+        int bulan = ambil_opsi_bulan(argc, argv, dapatkan_bulan_saat_ini());
+        if (bulan < 0) return gagal(CLI_SALAH_PAKAI, "bulan harus 1-12", NULL);
+
+        PosAnggaran list[MAX_POS];
+        int count = ambil_daftar_pos(list, MAX_POS, bulan);
+
+        printf("%s\n", KOLOM_POS);
+        for (int i = 0; i < count; i++) {
+            printf("%d\t%s\t%llu\t%llu\t%lld\t%d\t%s\n",
+                   list[i].no, list[i].nama, list[i].nominal, list[i].realisasi,
+                   list[i].sisa, list[i].jumlah_transaksi,
+                   (list[i].status == STATUS_AMAN) ? "Aman" : "Tidak Aman");
+        }
+        return CLI_SUKSES;
+    }
+
+    return gagal(CLI_SALAH_PAKAI, "objek list tidak dikenal", objek);
+}
+
+/**
+ * Perintah report: menampilkan analisis keuangan bulanan
+ */
+static int perintah_report(int argc, char *argv[]) {
+    static const char *const opsi[] = { "bulan", NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    int bulan = ambil_opsi_bulan(argc, argv, dapatkan_bulan_saat_ini());
+    if (bulan < 0) return gagal(CLI_SALAH_PAKAI, "bulan harus 1-12", NULL);
+
+    AnalisisKeuangan a;
+    if (!hitung_analisis_bulan(bulan, &a)) {
+        return gagal(CLI_GAGAL, "gagal menghitung analisis", NULL);
+    }
+
+    printf("kunci\tnilai\n");
+    printf("bulan\t%d\n", bulan);
+    printf("total_pemasukan\t%llu\n", a.total_pemasukan);
+    printf("total_pengeluaran\t%llu\n", a.total_pengeluaran);
+    printf("saldo_akhir\t%lld\n", a.saldo_akhir);
+    printf("rata_rata_pengeluaran\t%.2f\n", a.rata_rata_pengeluaran);
+    printf("persentase_sisa\t%.2f\n", a.persentase_sisa);
+    printf("kondisi\t%s\n", get_label_kondisi(a.kondisi_keuangan));
+    printf("kesimpulan\t%s\n", get_label_kesimpulan(a.kesimpulan));
+    printf("jumlah_pemasukan\t%d\n", a.total_trx_pemasukan);
+    printf("jumlah_pengeluaran\t%d\n", a.total_trx_pengeluaran);
+    return CLI_SUKSES;
+}
+
+/**
+ * Perintah recalc: menghitung ulang pos dan analisis untuk satu atau semua bulan
+ */
+static int perintah_recalc(int argc, char *argv[]) {
+    static const char *const opsi[] = { "bulan", NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    int bulan = ambil_opsi_bulan(argc, argv, 0);
+    if (bulan < 0) return gagal(CLI_SALAH_PAKAI, "bulan harus 1-12", NULL);
+
+    int hasil = CLI_SUKSES;
+
+    printf("bulan\tstatus\n");
+    if (bulan) {
+        pekerja_kirim(PEKERJA_HITUNG_POS, bulan);
+        pekerja_kirim(PEKERJA_REFRESH_ANALISIS, bulan);
+
+        int ok = (pekerja_ambil_jumlah_gagal() == 0);
+        printf("%d\t%s\n", bulan, ok ? "ok" : "gagal");
+        return ok ? CLI_SUKSES : CLI_GAGAL;
+    }
+
+    /* Tanpa --bulan: satu pemuatan transaksi, agregasi paralel, hanya bulan yang sudah berdata */
+    pekerja_tunggu_semua();
+    int status[13];
+    if (!refresh_rekap_tahunan(1, status)) hasil = CLI_GAGAL;
+
+    for (int b = BULAN_MIN; b <= BULAN_MAX; b++) {
+        if (status[b] == REKAP_DILEWATI) continue;
+        printf("%d\t%s\n", b, status[b] == REKAP_OK ? "ok" : "gagal");
+    }
+    return hasil;
+}
+
+/**
+ * Helper: Melaporkan baris impor yang ditolak ke stderr
+ */
+static void lapor_tolak_impor(int nomor_baris, const char *pesan, void *konteks) {
+    (void)konteks;
+    fprintf(stderr, "error: baris %d: %s\n", nomor_baris, pesan);
+}
+
+/**
+ * Perintah import: impor massal CSV/TSV, disimpan sekaligus di akhir
+ */
+static int perintah_import(int argc, char *argv[]) {
+    static const char *const opsi[] = { "format", NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    const char *sumber = ambil_posisi(argc, argv, 0);
+    if (!sumber) return gagal(CLI_SALAH_PAKAI, "import membutuhkan FILE atau -", NULL);
+
+    int format = IMPOR_FORMAT_OTOMATIS;
+    const char *nama_format = ambil_opsi(argc, argv, "format");
+    if (nama_format) {
+        format = urai_format_impor(nama_format);
+        if (format < 0) return gagal(CLI_SALAH_PAKAI, "format harus csv atau tsv", nama_format);
+    }
+
+    FILE *in = (strcmp(sumber, "-") == 0) ? stdin : fopen(sumber, "r");
+    if (!in) return gagal(CLI_GAGAL, "tidak dapat membuka file", sumber);
+
+    HasilImpor hasil;
+    int ok = impor_transaksi(in, format, lapor_tolak_impor, NULL, &hasil);
+    if (in != stdin) fclose(in);
+
+    if (!ok) return gagal(CLI_GAGAL, "gagal menyimpan hasil impor", NULL);
+    pekerja_tunggu_semua();
+
+    printf("diterima\tditolak\tid_pertama\tid_terakhir\n%d\t%d\t%s\t%s\n",
+           hasil.diterima, hasil.ditolak,
+           hasil.diterima > 0 ? hasil.id_pertama : "-",
+           hasil.diterima > 0 ? hasil.id_terakhir : "-");
+    return (hasil.ditolak > 0) ? CLI_GAGAL : CLI_SUKSES;
+}
+
+/**
+ * Perintah export: menulis transaksi, pos, atau analisis ke stdout atau file
+ */
+static int perintah_export(int argc, char *argv[]) {
+    static const char *const opsi[] = { "bulan", "format", "keluar", NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    const char *objek = ambil_posisi(argc, argv, 0);
+    int data = objek ? urai_data_ekspor(objek) : EKSPOR_DATA_TRANSAKSI;
+    if (data < 0) return gagal(CLI_SALAH_PAKAI, "objek export tidak dikenal", objek);
+
+    int bulan = ambil_opsi_bulan(argc, argv, 0);
+    if (bulan < 0) return gagal(CLI_SALAH_PAKAI, "bulan harus 1-12", NULL);
+
+    int format = EKSPOR_FORMAT_TSV;
+    const char *nama_format = ambil_opsi(argc, argv, "format");
+    if (nama_format) {
+        format = urai_format_ekspor(nama_format);
+        if (format < 0) return gagal(CLI_SALAH_PAKAI, "format harus tsv, csv, atau json", nama_format);
+    }
+
+    /* File tujuan ditulis ke .tmp lalu rename, tidak pernah setengah jadi */
+    const char *tujuan = ambil_opsi(argc, argv, "keluar");
+    long hasil = tujuan ? ekspor_ke_file(tujuan, data, format, bulan)
+                        : ekspor_ke_stream(stdout, data, format, bulan);
+
+    if (hasil < 0) return gagal(CLI_GAGAL, "gagal menulis ekspor", tujuan);
+    return CLI_SUKSES;
+}
+
+/**
+ * Perintah seal dan unseal: memindahkan transaksi satu tahun ke/dari arsip
+ */
+static int perintah_segel(int argc, char *argv[], int segel) {
+    static const char *const opsi[] = { "tahun", NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    int tahun = ambil_opsi_tahun(argc, argv);
+    if (tahun < 0) return gagal(CLI_SALAH_PAKAI, "--tahun YYYY wajib diisi", NULL);
+
+    /* Perhitungan latar belakang harus selesai sebelum file transaksi diganti */
+    pekerja_tunggu_semua();
+
+    char error_msg[100] = "";
+    int jumlah = segel ? segel_tahun(tahun, error_msg) : buka_segel_tahun(tahun, error_msg);
+    if (jumlah < 0) return gagal(CLI_GAGAL, segel ? "gagal menyegel" : "gagal membuka segel", error_msg);
+
+    printf("tahun\t%s\n%d\t%d\n", segel ? "diarsipkan" : "dikembalikan", tahun, jumlah);
+    return CLI_SUKSES;
+}
+
+/**
+ * Perintah close dan reopen: menutup atau membuka kembali satu bulan
+ */
+static int perintah_tutup(int argc, char *argv[], int tutup) {
+    static const char *const opsi[] = { "bulan", NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    int bulan = ambil_opsi_bulan(argc, argv, 0);
+    if (bulan <= 0) return gagal(CLI_SALAH_PAKAI, "--bulan 1-12 wajib diisi", NULL);
+
+    /* Perhitungan latar belakang bulan ini harus selesai sebelum dibekukan */
+    pekerja_tunggu_semua();
+
+    char error_msg[100] = "";
+    if (tutup) {
+        int jumlah = tutup_periode(bulan, error_msg);
+        if (jumlah < 0) return gagal(CLI_GAGAL, "gagal menutup bulan", error_msg);
+        printf("bulan\ttransaksi\n%d\t%d\n", bulan, jumlah);
+    } else {
+        if (!buka_periode(bulan, error_msg)) return gagal(CLI_GAGAL, "gagal membuka bulan", error_msg);
+        printf("bulan\tstatus\n%d\tterbuka\n", bulan);
+    }
+    return CLI_SUKSES;
+}
+
+/**
+ * Perintah verify: memeriksa snapshot satu atau semua bulan
+ */
+static int perintah_verify(int argc, char *argv[]) {
+    static const char *const opsi[] = { "bulan", NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    int bulan = ambil_opsi_bulan(argc, argv, 0);
+    if (bulan < 0) return gagal(CLI_SALAH_PAKAI, "bulan harus 1-12", NULL);
+
+    int hasil = CLI_SUKSES;
+    printf("bulan\tstatus\n");
+    for (int b = BULAN_MIN; b <= BULAN_MAX; b++) {
+        if (bulan && b != bulan) continue;
+
+        int status = verifikasi_periode(b);
+        const char *label = "terbuka";
+        if (status == PERIODE_TERTUTUP) label = "tertutup";
+        if (status == PERIODE_RUSAK) label = "rusak";
+        if (status == PERIODE_BERUBAH) label = "berubah";
+        if (status < 0) hasil = CLI_GAGAL;
+
+        printf("%d\t%s\n", b, label);
+    }
+    return hasil;
+}
+
+/**
+ * Perintah sync: memvalidasi manifes data dan membangun ulang bulan yang berubah
+ */
+static int perintah_sync(int argc, char *argv[]) {
+    static const char *const opsi[] = { NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    HasilManifes hasil;
+    if (!sinkronkan_manifes(&hasil)) return gagal(CLI_GAGAL, "sinkronisasi manifes gagal", NULL);
+
+    char dibangun[40] = "-";
+    int pos = 0;
+    for (int b = BULAN_MIN; b <= BULAN_MAX; b++) {
+        if (!hasil.bulan_dibangun[b]) continue;
+        pos += snprintf(dibangun + pos, sizeof(dibangun) - pos, "%s%d", pos ? "," : "", b);
+    }
+
+    printf("file\tdibaca\tberubah\tdipindai\tdibangun\n");
+    printf("%d\t%d\t%d\t%d\t%s\n", hasil.file_diperiksa, hasil.file_dibaca, hasil.file_berubah,
+           hasil.buku_dipindai, dibangun);
+    return CLI_SUKSES;
+}
+
+/**
+ * Perintah compact: memindahkan baris rusak file transaksi ke file .rusak
+ */
+static int perintah_compact(int argc, char *argv[]) {
+    static const char *const opsi[] = { NULL };
+    if (!periksa_opsi(argc, argv, opsi)) return CLI_SALAH_PAKAI;
+
+    int dipindah = kompaksi_file_transaksi();
+    if (dipindah < 0) return gagal(CLI_GAGAL, "kompaksi file transaksi gagal", NULL);
+
+    char filename[MAX_PATH], rusak[MAX_PATH + 8];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+    snprintf(rusak, sizeof(rusak), "%s%s", filename, FILE_RUSAK_SUFFIX);
+
+    printf("dipindah\tfile\n%d\t%s\n", dipindah, dipindah > 0 ? rusak : "-");
+    return CLI_SUKSES;
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+int cli_jalankan(int argc, char *argv[]) {
+    const char *program = (argc > 0) ? argv[0] : "keuangan";
+    if (argc < 2) {
+        tampilkan_bantuan_cli(stderr, program);
+        return CLI_SALAH_PAKAI;
+    }
+
+    const char *perintah = argv[1];
+
+    if (strcmp(perintah, "help") == 0 || strcmp(perintah, "--help") == 0 ||
+        strcmp(perintah, "-h") == 0) {
+        tampilkan_bantuan_cli(stdout, program);
+        return CLI_SUKSES;
+    }
+
+    if (!pastikan_direktori_data()) {
+        return gagal(CLI_GAGAL, "tidak dapat membuat direktori data", NULL);
+    }
+
+    /* Segel/buka segel yang terhenti dituntaskan dulu agar tidak ada transaksi ganda */
+    char error_msg[256] = "";
+    if (!pulihkan_segel(error_msg)) {
+        return gagal(CLI_GAGAL, "gagal memulihkan segel yang terhenti", error_msg);
+    }
+
+    if (strcmp(perintah, "add") == 0) return perintah_add(argc, argv);
+    if (strcmp(perintah, "list") == 0) return perintah_list(argc, argv);
+    if (strcmp(perintah, "report") == 0) return perintah_report(argc, argv);
+    if (strcmp(perintah, "recalc") == 0) return perintah_recalc(argc, argv);
+    if (strcmp(perintah, "import") == 0) return perintah_import(argc, argv);
+    if (strcmp(perintah, "export") == 0) return perintah_export(argc, argv);
+    if (strcmp(perintah, "seal") == 0) return perintah_segel(argc, argv, 1);
+    if (strcmp(perintah, "unseal") == 0) return perintah_segel(argc, argv, 0);
+    if (strcmp(perintah, "close") == 0) return perintah_tutup(argc, argv, 1);
+    if (strcmp(perintah, "reopen") == 0) return perintah_tutup(argc, argv, 0);
+    if (strcmp(perintah, "verify") == 0) return perintah_verify(argc, argv);
+    if (strcmp(perintah, "sync") == 0) return perintah_sync(argc, argv);
+    if (strcmp(perintah, "compact") == 0) return perintah_compact(argc, argv);
+
+    fprintf(stderr, "error: perintah tidak dikenal: %s\n", perintah);
+    tampilkan_bantuan_cli(stderr, program);
+    return CLI_SALAH_PAKAI;
+}
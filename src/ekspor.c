@@ -0,0 +1,463 @@
+/*
+ * =============================================================================
+ * File        : ekspor.c
+ * Deskripsi   : Implementasi modul ekspor data (TSV, CSV, JSON)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan penulis ekspor berbuffer dan tiga sumber
+ * data: transaksi (streaming dari file), pos anggaran per bulan, dan
+ * analisis per bulan (dihitung dari satu lintasan file transaksi).
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h     : Untuk fwrite dan snprintf
+ * - string.h    : Untuk memcpy dan strlen
+ * - ekspor.h    : Header file modul ini
+ * - transaksi.h : Untuk ringkasan transaksi per bulan
+ * - pos.h       : Untuk ambil_daftar_pos
+ * - analisis.h  : Untuk isi_analisis_dari_ringkasan dan label
+ * - file.h      : Untuk telusuri_transaksi, label jenis, dan PenulisBaris
+ * - utils.h     : Untuk perbandingan string
+ *
+ * CATATAN:
+ * Setiap rekaman ditulis sebagai urutan field (nama, nilai); format
+ * menentukan pemisah, kutip, dan escape. Header TSV/CSV berisi nama kolom
+ * yang sama dengan kunci objek JSON.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ekspor.h"
+#include "transaksi.h"
+#include "pos.h"
+#include "analisis.h"
+#include "file.h"
+#include "utils.h"
+
+/* ===== KONSTANTA LOKAL ===== */
+
+static const char *const KOLOM_EKSPOR_TRANSAKSI[] = {
+    "id", "tanggal", "jenis", "pos", "nominal", "deskripsi", NULL
+};
+static const char *const KOLOM_EKSPOR_POS[] = {
+    "bulan", "no", "nama", "anggaran", "realisasi", "sisa", "jumlah_transaksi", "status", NULL
+};
+static const char *const KOLOM_EKSPOR_ANALISIS[] = {
+    "bulan", "total_pemasukan", "total_pengeluaran", "saldo_akhir", "rata_rata_pengeluaran",
+    "persentase_sisa", "kondisi", "kesimpulan", "jumlah_pemasukan", "jumlah_pengeluaran", NULL
+};
+
+/* ===== FUNGSI HELPER PENULIS ===== */
+
+/**
+ * Helper: Mengirim isi buffer ke stream atau penulis file
+ */
+static void kuras_buffer(PenulisEkspor *w) {
+    if (w->terpakai > 0 && !w->gagal) {
+        if (w->file) {
+            penulis_tulis(w->file, w->buffer, w->terpakai);
+        } else if (fwrite(w->buffer, 1, w->terpakai, w->out) != (size_t)w->terpakai) {
+            w->gagal = 1;
+        }
+    }
+    w->terpakai = 0;
+}
+
+/**
+ * Helper: Menulis satu byte ke buffer
+ */
+static void tulis_byte(PenulisEkspor *w, char c) {
+    if (w->terpakai >= UKURAN_BUFFER_EKSPOR) kuras_buffer(w);
+    w->buffer[w->terpakai++] = c;
+}
+
+/**
+ * Helper: Menulis potongan byte ke buffer
+ */
+static void tulis_mentah(PenulisEkspor *w, const char *s, int len) {
+    while (len > 0) {
+        if (w->terpakai >= UKURAN_BUFFER_EKSPOR) kuras_buffer(w);
+        int muat = UKURAN_BUFFER_EKSPOR - w->terpakai;
+        if (muat > len) muat = len;
+        memcpy(w->buffer + w->terpakai, s, muat);
+        w->terpakai += muat;
+        s += muat;
+        len -= muat;
+    }
+}
+
+/**
+ * Helper: Menulis string C ke buffer
+ */
+static void tulis_teks_mentah(PenulisEkspor *w, const char *s) {
+    tulis_mentah(w, s, (int)strlen(s));
+}
+
+/**
+ * Helper: Menulis string JSON dengan escape
+ */
+static void tulis_string_json(PenulisEkspor *w, const char *s) {
+    tulis_byte(w, '"');
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            tulis_byte(w, '\\');
+            tulis_byte(w, (char)c);
+        } else if (c < 0x20) {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\u%04x", c);
+            tulis_teks_mentah(w, esc);
+        } else {
+            tulis_byte(w, (char)c);
+        }
+    }
+    tulis_byte(w, '"');
+}
+
+/**
+ * Helper: Menulis field CSV, dikutip hanya jika berisi pemisah/kutip/baris baru
+ */
+static void tulis_string_csv(PenulisEkspor *w, const char *s) {
+    if (!strpbrk(s, ",\"\r\n")) {
+        tulis_teks_mentah(w, s);
+        return;
+    }
+
+    tulis_byte(w, '"');
+    for (; *s; s++) {
+        if (*s == '"') tulis_byte(w, '"');
+        tulis_byte(w, *s);
+    }
+    tulis_byte(w, '"');
+}
+
+/**
+ * Helper: Menulis field TSV; TAB dan baris baru diganti spasi
+ */
+static void tulis_string_tsv(PenulisEkspor *w, const char *s) {
+    for (; *s; s++) {
+        tulis_byte(w, (*s == '\t' || *s == '\n' || *s == '\r') ? ' ' : *s);
+    }
+}
+
+/**
+ * Helper: Menulis pemisah dan nama field sebelum nilai
+ */
+static void awal_field(PenulisEkspor *w, const char *nama) {
+    if (w->format == EKSPOR_FORMAT_JSON) {
+        if (w->kolom > 0) tulis_byte(w, ',');
+        tulis_string_json(w, nama);
+        tulis_byte(w, ':');
+    } else if (w->kolom > 0) {
+        tulis_byte(w, (w->format == EKSPOR_FORMAT_CSV) ? ',' : '\t');
+    }
+    w->kolom++;
+}
+
+/**
+ * Helper: Menulis field teks
+ */
+static void field_teks(PenulisEkspor *w, const char *nama, const char *nilai) {
+    awal_field(w, nama);
+    if (!nilai) nilai = "";
+
+    switch (w->format) {
+        case EKSPOR_FORMAT_JSON: tulis_string_json(w, nilai); break;
+        case EKSPOR_FORMAT_CSV:  tulis_string_csv(w, nilai);  break;
+        default:                 tulis_string_tsv(w, nilai);  break;
+    }
+}
+
+/**
+ * Helper: Menulis field angka yang sudah diformat (tanpa kutip di semua format)
+ */
+static void field_angka(PenulisEkspor *w, const char *nama, const char *angka) {
+    awal_field(w, nama);
+    tulis_teks_mentah(w, angka);
+}
+
+/**
+ * Helper: Menulis field bilangan bulat tak bertanda
+ */
+static void field_ull(PenulisEkspor *w, const char *nama, unsigned long long nilai) {
+    char angka[24];
+    snprintf(angka, sizeof(angka), "%llu", nilai);
+    field_angka(w, nama, angka);
+}
+
+/**
+ * Helper: Menulis field bilangan bulat bertanda
+ */
+static void field_ll(PenulisEkspor *w, const char *nama, long long nilai) {
+    char angka[24];
+    snprintf(angka, sizeof(angka), "%lld", nilai);
+    field_angka(w, nama, angka);
+}
+
+/**
+ * Helper: Menulis field desimal dua angka di belakang koma
+ */
+static void field_desimal(PenulisEkspor *w, const char *nama, double nilai) {
+    char angka[48];
+    snprintf(angka, sizeof(angka), "%.2f", nilai);
+    field_angka(w, nama, angka);
+}
+
+/**
+ * Helper: Menulis pembuka dokumen (header kolom atau '[')
+ */
+static void mulai_dokumen(PenulisEkspor *w, const char *const *kolom) {
+    w->rekaman = 0;
+
+    if (w->format == EKSPOR_FORMAT_JSON) {
+        tulis_byte(w, '[');
+        return;
+    }
+
+    for (int i = 0; kolom[i]; i++) {
+        if (i > 0) tulis_byte(w, (w->format == EKSPOR_FORMAT_CSV) ? ',' : '\t');
+        tulis_teks_mentah(w, kolom[i]);
+    }
+    tulis_byte(w, '\n');
+}
+
+/**
+ * Helper: Menulis pembuka satu rekaman
+ */
+static void mulai_rekaman(PenulisEkspor *w) {
+    if (w->format == EKSPOR_FORMAT_JSON) {
+        tulis_teks_mentah(w, (w->rekaman > 0) ? ",\n  {" : "\n  {");
+    }
+    w->kolom = 0;
+}
+
+/**
+ * Helper: Menulis penutup satu rekaman
+ */
+static void selesai_rekaman(PenulisEkspor *w) {
+    tulis_byte(w, (w->format == EKSPOR_FORMAT_JSON) ? '}' : '\n');
+    w->rekaman++;
+}
+
+/**
+ * Helper: Menulis penutup dokumen
+ */
+static void selesai_dokumen(PenulisEkspor *w) {
+    if (w->format == EKSPOR_FORMAT_JSON) {
+        tulis_teks_mentah(w, (w->rekaman > 0) ? "\n]\n" : "]\n");
+    }
+}
+
+/* ===== FUNGSI HELPER SUMBER DATA ===== */
+
+/**
+ * Helper: Pengunjung yang menulis satu transaksi
+ */
+static int kunjungi_ekspor_transaksi(const Transaksi *trx, void *konteks) {
+    PenulisEkspor *w = (PenulisEkspor *)konteks;
+
+    mulai_rekaman(w);
+    field_teks(w, "id", trx->id);
+    field_teks(w, "tanggal", trx->tanggal);
+    field_teks(w, "jenis", dapatkan_label_jenis(trx->jenis));
+    field_teks(w, "pos", trx->pos);
+    field_ull(w, "nominal", trx->nominal);
+    field_teks(w, "deskripsi", trx->deskripsi);
+    selesai_rekaman(w);
+
+    /* Hentikan penelusuran begitu stream tujuan gagal */
+    return w->gagal ? -1 : 1;
+}
+
+/**
+ * Helper: Menulis semua pos satu bulan
+ */
+static void tulis_pos_bulan(PenulisEkspor *w, int bulan) {
+    PosAnggaran list[MAX_POS];
+    int count = ambil_daftar_pos(list, MAX_POS, bulan);
+
+    for (int i = 0; i < count; i++) {
+        mulai_rekaman(w);
+        field_ll(w, "bulan", bulan);
+        field_ll(w, "no", list[i].no);
+        field_teks(w, "nama", list[i].nama);
+        field_ull(w, "anggaran", list[i].nominal);
+        field_ull(w, "realisasi", list[i].realisasi);
+        field_ll(w, "sisa", list[i].sisa);
+        field_ll(w, "jumlah_transaksi", list[i].jumlah_transaksi);
+        field_teks(w, "status", (list[i].status == STATUS_AMAN) ? "Aman" : "Tidak Aman");
+        selesai_rekaman(w);
+    }
+}
+
+/**
+ * Helper: Menulis satu laporan analisis bulan
+ */
+static void tulis_analisis_bulan(PenulisEkspor *w, int bulan, const RingkasanTransaksi *ringkasan) {
+    AnalisisKeuangan a;
+    isi_analisis_dari_ringkasan(ringkasan, &a);
+
+    mulai_rekaman(w);
+    field_ll(w, "bulan", bulan);
+    field_ull(w, "total_pemasukan", a.total_pemasukan);
+    field_ull(w, "total_pengeluaran", a.total_pengeluaran);
+    field_ll(w, "saldo_akhir", a.saldo_akhir);
+    field_desimal(w, "rata_rata_pengeluaran", a.rata_rata_pengeluaran);
+    field_desimal(w, "persentase_sisa", a.persentase_sisa);
+    field_teks(w, "kondisi", get_label_kondisi(a.kondisi_keuangan));
+    field_teks(w, "kesimpulan", get_label_kesimpulan(a.kesimpulan));
+    field_ll(w, "jumlah_pemasukan", a.total_trx_pemasukan);
+    field_ll(w, "jumlah_pengeluaran", a.total_trx_pengeluaran);
+    selesai_rekaman(w);
+}
+
+/**
+ * Helper: Menjalankan ekspor satu jenis data lalu mengosongkan buffer penulis.
+ * Mengembalikan jumlah rekaman, atau -1 jika gagal.
+ */
+static long jalankan_ekspor(PenulisEkspor *w, int data, int bulan) {
+    long hasil;
+    switch (data) {
+        case EKSPOR_DATA_TRANSAKSI: hasil = ekspor_transaksi(w, bulan); break;
+        case EKSPOR_DATA_POS:       hasil = ekspor_pos(w, bulan);       break;
+        case EKSPOR_DATA_ANALISIS:  hasil = ekspor_analisis(w, bulan);  break;
+        default:                    hasil = -1;                         break;
+    }
+
+    if (!penulis_ekspor_selesai(w)) hasil = -1;
+    return hasil;
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+int urai_format_ekspor(const char *nama) {
+    if (!nama) return -1;
+
+    if (banding_string_tanpa_case(nama, "tsv") == 0) return EKSPOR_FORMAT_TSV;
+    if (banding_string_tanpa_case(nama, "csv") == 0) return EKSPOR_FORMAT_CSV;
+    if (banding_string_tanpa_case(nama, "json") == 0) return EKSPOR_FORMAT_JSON;
+
+    return -1;
+}
+
+int urai_data_ekspor(const char *nama) {
+    if (!nama) return -1;
+
+    if (banding_string_tanpa_case(nama, "transaksi") == 0) return EKSPOR_DATA_TRANSAKSI;
+    if (banding_string_tanpa_case(nama, "pos") == 0) return EKSPOR_DATA_POS;
+    if (banding_string_tanpa_case(nama, "analisis") == 0) return EKSPOR_DATA_ANALISIS;
+
+    return -1;
+}
+
+const char* dapatkan_ekstensi_ekspor(int format) {
+    switch (format) {
+        case EKSPOR_FORMAT_CSV:  return "csv";
+        case EKSPOR_FORMAT_JSON: return "json";
+        default:                 return "tsv";
+    }
+}
+
+void penulis_ekspor_mulai(PenulisEkspor *w, FILE *out, int format) {
+    if (!w) return;
+
+    w->out = out;
+    w->file = NULL;
+    w->format = format;
+    w->terpakai = 0;
+    w->kolom = 0;
+    w->rekaman = 0;
+    w->gagal = (out == NULL);
+}
+
+int penulis_ekspor_selesai(PenulisEkspor *w) {
+    if (!w) return 0;
+
+    kuras_buffer(w);
+    if (!w->gagal && !w->file && fflush(w->out) != 0) w->gagal = 1;
+
+    return !w->gagal;
+}
+
+long ekspor_transaksi(PenulisEkspor *w, int bulan) {
+    if (!w || bulan < 0 || bulan > 12) return -1;
+
+    mulai_dokumen(w, KOLOM_EKSPOR_TRANSAKSI);
+    if (telusuri_transaksi(bulan, kunjungi_ekspor_transaksi, w) < 0) return -1;
+    selesai_dokumen(w);
+
+    return w->gagal ? -1 : w->rekaman;
+}
+
+long ekspor_pos(PenulisEkspor *w, int bulan) {
+    if (!w || bulan < 0 || bulan > 12) return -1;
+
+    mulai_dokumen(w, KOLOM_EKSPOR_POS);
+    if (bulan > 0) {
+        tulis_pos_bulan(w, bulan);
+    } else {
+        for (int b = BULAN_MIN; b <= BULAN_MAX; b++) {
+            if (cek_file_pos_ada(b)) tulis_pos_bulan(w, b);
+        }
+    }
+    selesai_dokumen(w);
+
+    return w->gagal ? -1 : w->rekaman;
+}
+
+long ekspor_analisis(PenulisEkspor *w, int bulan) {
+    if (!w || bulan < 0 || bulan > 12) return -1;
+
+    /* Satu lintasan file untuk semua bulan */
+    RingkasanTransaksi ringkasan[13];
+    hitung_ringkasan_semua_bulan(ringkasan);
+
+    mulai_dokumen(w, KOLOM_EKSPOR_ANALISIS);
+    if (bulan > 0) {
+        tulis_analisis_bulan(w, bulan, &ringkasan[bulan]);
+    } else {
+        for (int b = BULAN_MIN; b <= BULAN_MAX; b++) {
+            if (ringkasan[b].jumlah_pemasukan + ringkasan[b].jumlah_pengeluaran == 0) continue;
+            tulis_analisis_bulan(w, b, &ringkasan[b]);
+        }
+    }
+    selesai_dokumen(w);
+
+    return w->gagal ? -1 : w->rekaman;
+}
+
+long ekspor_ke_stream(FILE *out, int data, int format, int bulan) {
+    if (!out) return -1;
+
+    PenulisEkspor w;
+    penulis_ekspor_mulai(&w, out, format);
+    return jalankan_ekspor(&w, data, bulan);
+}
+
+long ekspor_ke_file(const char *path, int data, int format, int bulan) {
+    if (!path) return -1;
+
+    char temp_name[MAX_PATH + 8];
+    if (strlen(path) >= MAX_PATH) return -1;
+    snprintf(temp_name, sizeof(temp_name), "%s.tmp", path);
+
+    PenulisBaris out;
+    if (!penulis_buka(&out, temp_name)) return -1;
+
+    /* Lewat PenulisBaris agar penghitung I/O dan KEUANGAN_FDATASYNC berlaku */
+    PenulisEkspor w;
+    penulis_ekspor_mulai(&w, NULL, format);
+    w.file = &out;
+    w.gagal = 0;
+    long hasil = jalankan_ekspor(&w, data, bulan);
+
+    if (!penulis_tutup(&out)) hasil = -1;
+    if (hasil >= 0 && !ganti_file(temp_name, path)) hasil = -1;
+    if (hasil < 0) remove(temp_name);
+
+    return hasil;
+}
@@ -19,18 +19,34 @@
  * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
  * - stdio.h      : Untuk operasi file standar (fopen, fclose, fprintf, fgets)
  * - stdlib.h     : Untuk alokasi memori dan konversi (atoi, strtoull)
- * - string.h     : Untuk manipulasi string (strcpy, strtok)
+ * - string.h     : Untuk manipulasi string (strcpy, memset)
  * - ctype.h      : Untuk pengecekan karakter
  * - sys/stat.h   : Untuk operasi direktori (mkdir, stat)
  * - sys/types.h  : Untuk tipe data sistem
  * - errno.h      : Untuk penanganan error
+ * - fcntl.h, unistd.h, sys/uio.h : Untuk open/write/writev/fdatasync pada PenulisBaris
+ * - pthread.h    : Untuk mutex cache hangat transaksi bulan
  * - file.h       : Header file modul ini
  * - utils.h      : Untuk fungsi utilitas string
+ * - instrumen.h  : Untuk timer dan penghitung I/O per fungsi
+ * - muat_paralel.h : Untuk pemuatan file transaksi besar dengan beberapa thread
+ * - arsip.h      : Untuk menelusuri arsip tahun yang disegel sebelum file teks
+ * - periode.h    : Untuk menolak salin pos ke bulan yang ditutup
  *
  * CATATAN:
  * Semua data disimpan dalam direktori 'data/' dengan format file teks.
  * File dibuat per bulan untuk memudahkan pengelolaan dan filtering.
  * Format baris: field1|field2|field3|... (delimiter: pipe)
+ * Parser baris memakai pisah_rentang: tidak menyalin baris, tidak memakai
+ * strtok, dan field kosong tetap pada kolomnya, sehingga urai_baris_* aman
+ * dipanggil dari beberapa thread sekaligus.
+ * Penulisan ulang penuh (simpan_*, tulis ulang, kompaksi) memakai PenulisBaris:
+ * baris diformat langsung ke buffer besar dan dikirim dengan write/writev
+ * per blok, lalu fdatasync bila kebijakan SINKRON_DATA dipasang.
+ * Satu bulan dapat dijaga hangat (hangatkan_transaksi_bulan): transaksinya
+ * disimpan sudah terurai dan dipakai telusuri/muat bulan itu selama stat file
+ * transaksi tidak berubah. Penulisan selalu lewat rename atau menambah baris,
+ * sehingga inode, ukuran, atau mtime pasti berbeda setelah file berubah.
  * =============================================================================
  */
 
@@ -41,43 +57,60 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <pthread.h>
 #include "file.h"
+#include "muat_paralel.h"
+#include "arsip.h"
+#include "periode.h"
+#include "instrumen.h"
 #include "utils.h"
 
 /* ===== FUNGSI HELPER INTERNAL ===== */
 
 /**
- * Helper: Konversi string ke int yang aman (menangani NULL)
+ * Helper: Menambahkan teks ke buffer baris dengan aturan potong snprintf
+ * Mengembalikan posisi logis berikutnya (boleh melewati ukuran buffer)
  */
-static int aman_atoi(const char *str) {
-    if (str == NULL) return 0;
-    return atoi(str);
+static int tambah_teks(char *result, int result_size, int pos, const char *teks, int len) {
+    int sisa = result_size - 1 - pos;
+    if (sisa > 0) memcpy(result + pos, teks, len < sisa ? len : sisa);
+    return pos + len;
 }
 
 /**
- * Helper: Konversi string ke unsigned long long yang aman
+ * Helper: Menambahkan string null-terminated ke buffer baris
  */
-static unsigned long long aman_atoull(const char *str) {
-    if (str == NULL) return 0;
-    return strtoull(str, NULL, 10);
+static int tambah_string(char *result, int result_size, int pos, const char *teks) {
+    return tambah_teks(result, result_size, pos, teks, strlen(teks));
 }
 
 /**
- * Helper: Konversi string ke double yang aman
+ * Helper: Menambahkan angka tanpa tanda ke buffer baris
  */
-static double aman_atof(const char *str) {
-    if (str == NULL) return 0.0;
-    return atof(str);
+static int tambah_ull(char *result, int result_size, int pos, unsigned long long nilai) {
+    char angka[24];
+    return tambah_teks(result, result_size, pos, angka, tulis_desimal_ull(nilai, angka));
 }
 
 /**
- * Helper: Konversi string ke long long yang aman
+ * Helper: Menambahkan angka bertanda ke buffer baris
  */
-static long long aman_atoll(const char *str) {
-    if (str == NULL) return 0;
-    return strtoll(str, NULL, 10);
+static int tambah_ll(char *result, int result_size, int pos, long long nilai) {
+    char angka[24];
+    return tambah_teks(result, result_size, pos, angka, tulis_desimal_ll(nilai, angka));
 }
 
+/**
+ * Helper: Menutup baris (null-terminator di posisi akhir atau batas buffer)
+ */
+static void akhiri_baris(char *result, int result_size, int pos) {
+    result[pos < result_size - 1 ? pos : result_size - 1] = '\0';
+}
+
+
 /* ===== IMPLEMENTASI FILE CORE (Operasi Dasar) ===== */
 
 /**
@@ -86,6 +119,7 @@ static long long aman_atoll(const char *str) {
 int cek_file_ada(const char *filename) {
     if (filename == NULL) return 0;
 
+    INSTRUMEN_TAMBAH(INS_FOPEN, 1);
     FILE *f = fopen(filename, "r");
     if (f != NULL) {
         fclose(f);
@@ -100,6 +134,7 @@ int cek_file_ada(const char *filename) {
 int buat_file(const char *filename) {
     if (filename == NULL) return 0;
 
+    INSTRUMEN_TAMBAH(INS_FOPEN, 1);
     FILE *f = fopen(filename, "w");
     if (f == NULL) {
         return 0;
@@ -114,6 +149,7 @@ int buat_file(const char *filename) {
 FILE* buka_file_baca(const char *filename) {
     if (filename == NULL) return NULL;
 
+    INSTRUMEN_TAMBAH(INS_FOPEN, 1);
     return fopen(filename, "r");
 }
 
@@ -123,6 +159,7 @@ FILE* buka_file_baca(const char *filename) {
 FILE* buka_file_tulis(const char *filename) {
     if (filename == NULL) return NULL;
 
+    INSTRUMEN_TAMBAH(INS_FOPEN, 1);
     return fopen(filename, "w");
 }
 
@@ -132,6 +169,7 @@ FILE* buka_file_tulis(const char *filename) {
 FILE* buka_file_tambah(const char *filename) {
     if (filename == NULL) return NULL;
 
+    INSTRUMEN_TAMBAH(INS_FOPEN, 1);
     return fopen(filename, "a");
 }
 
@@ -139,6 +177,7 @@ FILE* buka_file_tambah(const char *filename) {
  * Membaca seluruh isi file ke buffer
  */
 int baca_semua_file(const char *filename, char *buffer, int buffer_size) {
+    INSTRUMEN_FUNGSI();
     if (filename == NULL || buffer == NULL || buffer_size <= 0) {
         return 0;
     }
@@ -152,7 +191,7 @@ int baca_semua_file(const char *filename, char *buffer, int buffer_size) {
     int total = fread(buffer, 1, buffer_size - 1, f);
     buffer[total] = '\0';
 
-    fclose(f);
+    tutup_file(f, INS_BYTE_BACA);
     return total;
 }
 
@@ -160,6 +199,7 @@ int baca_semua_file(const char *filename, char *buffer, int buffer_size) {
  * Menulis string ke file (overwrite)
  */
 int tulis_semua_file(const char *filename, const char *content) {
+    INSTRUMEN_FUNGSI();
     if (filename == NULL) return 0;
 
     FILE *f = buka_file_tulis(filename);
@@ -171,7 +211,7 @@ int tulis_semua_file(const char *filename, const char *content) {
         fputs(content, f);
     }
 
-    fclose(f);
+    tutup_file(f, INS_BYTE_TULIS);
     return 1;
 }
 
@@ -179,6 +219,7 @@ int tulis_semua_file(const char *filename, const char *content) {
  * Menambahkan baris ke akhir file
  */
 int tambah_baris_file(const char *filename, const char *line) {
+    INSTRUMEN_FUNGSI();
     if (filename == NULL || line == NULL) return 0;
 
     /* Jika file belum ada, buat dulu */
@@ -193,7 +234,9 @@ int tambah_baris_file(const char *filename, const char *line) {
         return 0;
     }
 
-    fprintf(f, "%s\n", line);
+    /* Posisi stream append bukan jumlah byte yang ditulis, jadi dihitung langsung */
+    int ditulis = fprintf(f, "%s\n", line);
+    if (ditulis > 0) INSTRUMEN_TAMBAH(INS_BYTE_TULIS, ditulis);
     fclose(f);
 
     return 1;
@@ -279,47 +322,45 @@ int urai_jenis_transaksi(const char *jenis_str) {
  */
 int urai_baris_transaksi(const char *line, Transaksi *trx) {
     if (line == NULL || trx == NULL) return 0;
+    INSTRUMEN_TAMBAH(INS_BARIS_URAI, 1);
 
-    /* Buat salinan line karena strtok memodifikasi string */
-    char buffer[MAX_LINE_LENGTH];
-    salin_string_aman(buffer, line, MAX_LINE_LENGTH);
-    hapus_newline_string(buffer);
+    /* Field opsional (deskripsi) tidak boleh mewarisi isi sebelumnya */
+    memset(trx, 0, sizeof(Transaksi));
 
-    /* Parse field dengan delimiter | */
-    char *token;
-    int field = 0;
+    /* Pisah field dengan delimiter | (tanpa salinan, field kosong dipertahankan) */
+    RentangTeks kolom[6];
+    char jenis[16];
+    int jumlah = pisah_rentang(line, '|', kolom, 6);
+    int field;
 
-    token = strtok(buffer, "|");
-    while (token != NULL && field < 6) {
-        pangkas_string(token);
+    for (field = 0; field < jumlah; field++) {
+        RentangTeks token = kolom[field];
 
         switch (field) {
             case 0:  /* id */
-                salin_string_aman(trx->id, token, sizeof(trx->id));
+                salin_rentang(trx->id, token, sizeof(trx->id));
                 break;
             case 1:  /* tanggal */
-                salin_string_aman(trx->tanggal, token, sizeof(trx->tanggal));
+                salin_rentang(trx->tanggal, token, sizeof(trx->tanggal));
                 break;
             case 2:  /* jenis */
-                trx->jenis = urai_jenis_transaksi(token);
+                salin_rentang(jenis, token, sizeof(jenis));
+                trx->jenis = urai_jenis_transaksi(jenis);
                 break;
             case 3:  /* pos */
-                salin_string_aman(trx->pos, token, sizeof(trx->pos));
+                salin_rentang(trx->pos, token, sizeof(trx->pos));
                 break;
             case 4:  /* nominal */
-                trx->nominal = aman_atoull(token);
+                trx->nominal = rentang_ke_ull(token);
                 break;
             case 5:  /* deskripsi */
-                salin_string_aman(trx->deskripsi, token, sizeof(trx->deskripsi));
+                salin_rentang(trx->deskripsi, token, sizeof(trx->deskripsi));
                 break;
         }
-
-        field++;
-        token = strtok(NULL, "|");
     }
 
     /* Minimal harus ada 5 field (deskripsi bisa kosong) */
-    return (field >= 5);
+    return (jumlah >= 5);
 }
 
 /**
@@ -328,47 +369,41 @@ int urai_baris_transaksi(const char *line, Transaksi *trx) {
  */
 int urai_baris_pos(const char *line, PosAnggaran *pos) {
     if (line == NULL || pos == NULL) return 0;
+    INSTRUMEN_TAMBAH(INS_BARIS_URAI, 1);
 
-    char buffer[MAX_LINE_LENGTH];
-    salin_string_aman(buffer, line, MAX_LINE_LENGTH);
-    hapus_newline_string(buffer);
+    RentangTeks kolom[7];
+    int jumlah = pisah_rentang(line, '|', kolom, 7);
+    int field;
 
-    char *token;
-    int field = 0;
-
-    token = strtok(buffer, "|");
-    while (token != NULL && field < 7) {
-        pangkas_string(token);
+    for (field = 0; field < jumlah; field++) {
+        RentangTeks token = kolom[field];
 
         switch (field) {
             case 0:  /* no */
-                pos->no = aman_atoi(token);
+                pos->no = rentang_ke_int(token);
                 break;
             case 1:  /* nama */
-                salin_string_aman(pos->nama, token, sizeof(pos->nama));
+                salin_rentang(pos->nama, token, sizeof(pos->nama));
                 break;
             case 2:  /* nominal */
-                pos->nominal = aman_atoull(token);
+                pos->nominal = rentang_ke_ull(token);
                 break;
             case 3:  /* realisasi */
-                pos->realisasi = aman_atoull(token);
+                pos->realisasi = rentang_ke_ull(token);
                 break;
             case 4:  /* sisa */
-                pos->sisa = aman_atoll(token);
+                pos->sisa = rentang_ke_ll(token);
                 break;
             case 5:  /* jumlah_transaksi */
-                pos->jumlah_transaksi = aman_atoi(token);
+                pos->jumlah_transaksi = rentang_ke_int(token);
                 break;
             case 6:  /* status */
-                pos->status = aman_atoi(token);
+                pos->status = rentang_ke_int(token);
                 break;
         }
-
-        field++;
-        token = strtok(NULL, "|");
     }
 
-    return (field >= 7);
+    return (jumlah >= 7);
 }
 
 /**
@@ -377,53 +412,71 @@ int urai_baris_pos(const char *line, PosAnggaran *pos) {
  */
 int urai_baris_analisis(const char *line, AnalisisKeuangan *data) {
     if (line == NULL || data == NULL) return 0;
+    INSTRUMEN_TAMBAH(INS_BARIS_URAI, 1);
 
-    char buffer[MAX_LINE_LENGTH];
-    salin_string_aman(buffer, line, MAX_LINE_LENGTH);
-    hapus_newline_string(buffer);
+    RentangTeks kolom[9];
+    int jumlah = pisah_rentang(line, '|', kolom, 9);
+    int field;
 
-    char *token;
-    int field = 0;
-
-    token = strtok(buffer, "|");
-    while (token != NULL && field < 9) {
-        pangkas_string(token);
+    for (field = 0; field < jumlah; field++) {
+        RentangTeks token = kolom[field];
 
         switch (field) {
             case 0:  /* total_pemasukan */
-                data->total_pemasukan = aman_atoull(token);
+                data->total_pemasukan = rentang_ke_ull(token);
                 break;
             case 1:  /* total_pengeluaran */
-                data->total_pengeluaran = aman_atoull(token);
+                data->total_pengeluaran = rentang_ke_ull(token);
                 break;
             case 2:  /* rata_rata_pengeluaran */
-                data->rata_rata_pengeluaran = aman_atof(token);
+                data->rata_rata_pengeluaran = rentang_ke_double(token);
                 break;
             case 3:  /* persentase_sisa */
-                data->persentase_sisa = aman_atof(token);
+                data->persentase_sisa = rentang_ke_double(token);
                 break;
             case 4:  /* saldo_akhir */
-                data->saldo_akhir = aman_atoll(token);
+                data->saldo_akhir = rentang_ke_ll(token);
                 break;
             case 5:  /* kondisi_keuangan */
-                data->kondisi_keuangan = aman_atoi(token);
+                data->kondisi_keuangan = rentang_ke_int(token);
                 break;
             case 6:  /* kesimpulan */
-                data->kesimpulan = aman_atoi(token);
+                data->kesimpulan = rentang_ke_int(token);
                 break;
             case 7:  /* total_trx_pengeluaran */
-                data->total_trx_pengeluaran = aman_atoi(token);
+                data->total_trx_pengeluaran = rentang_ke_int(token);
                 break;
             case 8:  /* total_trx_pemasukan */
-                data->total_trx_pemasukan = aman_atoi(token);
+                data->total_trx_pemasukan = rentang_ke_int(token);
                 break;
         }
-
-        field++;
-        token = strtok(NULL, "|");
     }
 
-    return (field >= 9);
+    return (jumlah >= 9);
+}
+
+/**
+ * Helper: Format transaksi ke buffer, mengembalikan panjang baris utuh
+ * (seperti nilai kembali snprintf, boleh melebihi result_size - 1)
+ */
+static int format_transaksi_ke_buffer(const Transaksi *trx, char *result, int result_size) {
+    INSTRUMEN_TAMBAH(INS_BARIS_FORMAT, 1);
+
+    /* Sama dengan "%s|%s|%s|%s|%llu|%s", tanpa parsing format */
+    int pos = 0;
+    pos = tambah_string(result, result_size, pos, trx->id);
+    pos = tambah_teks(result, result_size, pos, "|", 1);
+    pos = tambah_string(result, result_size, pos, trx->tanggal);
+    pos = tambah_teks(result, result_size, pos, "|", 1);
+    pos = tambah_string(result, result_size, pos, dapatkan_label_jenis(trx->jenis));
+    pos = tambah_teks(result, result_size, pos, "|", 1);
+    pos = tambah_string(result, result_size, pos, trx->pos);
+    pos = tambah_teks(result, result_size, pos, "|", 1);
+    pos = tambah_ull(result, result_size, pos, trx->nominal);
+    pos = tambah_teks(result, result_size, pos, "|", 1);
+    pos = tambah_string(result, result_size, pos, trx->deskripsi);
+    akhiri_baris(result, result_size, pos);
+    return pos;
 }
 
 /**
@@ -432,13 +485,32 @@ int urai_baris_analisis(const char *line, AnalisisKeuangan *data) {
 void format_transaksi_ke_string(const Transaksi *trx, char *result, int result_size) {
     if (trx == NULL || result == NULL || result_size <= 0) return;
 
-    snprintf(result, result_size, "%s|%s|%s|%s|%llu|%s",
-            trx->id,
-            trx->tanggal,
-            dapatkan_label_jenis(trx->jenis),
-            trx->pos,
-            trx->nominal,
-            trx->deskripsi);
+    format_transaksi_ke_buffer(trx, result, result_size);
+}
+
+/**
+ * Helper: Format pos ke buffer, mengembalikan panjang baris utuh
+ */
+static int format_pos_ke_buffer(const PosAnggaran *pos, char *result, int result_size) {
+    INSTRUMEN_TAMBAH(INS_BARIS_FORMAT, 1);
+
+    /* Sama dengan "%d|%s|%llu|%llu|%lld|%d|%d", tanpa parsing format */
+    int n = 0;
+    n = tambah_ll(result, result_size, n, pos->no);
+    n = tambah_teks(result, result_size, n, "|", 1);
+    n = tambah_string(result, result_size, n, pos->nama);
+    n = tambah_teks(result, result_size, n, "|", 1);
+    n = tambah_ull(result, result_size, n, pos->nominal);
+    n = tambah_teks(result, result_size, n, "|", 1);
+    n = tambah_ull(result, result_size, n, pos->realisasi);
+    n = tambah_teks(result, result_size, n, "|", 1);
+    n = tambah_ll(result, result_size, n, pos->sisa);
+    n = tambah_teks(result, result_size, n, "|", 1);
+    n = tambah_ll(result, result_size, n, pos->jumlah_transaksi);
+    n = tambah_teks(result, result_size, n, "|", 1);
+    n = tambah_ll(result, result_size, n, pos->status);
+    akhiri_baris(result, result_size, n);
+    return n;
 }
 
 /**
@@ -447,14 +519,29 @@ void format_transaksi_ke_string(const Transaksi *trx, char *result, int result_s
 void format_pos_ke_string(const PosAnggaran *pos, char *result, int result_size) {
     if (pos == NULL || result == NULL || result_size <= 0) return;
 
-    snprintf(result, result_size, "%d|%s|%llu|%llu|%lld|%d|%d",
-            pos->no,
-            pos->nama,
-            pos->nominal,
-            pos->realisasi,
-            pos->sisa,
-            pos->jumlah_transaksi,
-            pos->status);
+    format_pos_ke_buffer(pos, result, result_size);
+}
+
+/**
+ * Ukuran baris transaksi di file, tanpa memformat ke buffer
+ */
+int ukuran_baris_transaksi(const Transaksi *trx) {
+    if (trx == NULL) return 0;
+
+    return snprintf(NULL, 0, "%s|%s|%s|%s|%llu|%s",
+                    trx->id, trx->tanggal, dapatkan_label_jenis(trx->jenis),
+                    trx->pos, trx->nominal, trx->deskripsi) + 1;
+}
+
+/**
+ * Ukuran baris pos di file, tanpa memformat ke buffer
+ */
+int ukuran_baris_pos(const PosAnggaran *pos) {
+    if (pos == NULL) return 0;
+
+    return snprintf(NULL, 0, "%d|%s|%llu|%llu|%lld|%d|%d",
+                    pos->no, pos->nama, pos->nominal, pos->realisasi,
+                    pos->sisa, pos->jumlah_transaksi, pos->status) + 1;
 }
 
 /**
@@ -462,6 +549,7 @@ void format_pos_ke_string(const PosAnggaran *pos, char *result, int result_size)
  */
 void format_analisis_ke_string(const AnalisisKeuangan *data, char *result, int result_size) {
     if (data == NULL || result == NULL || result_size <= 0) return;
+    INSTRUMEN_TAMBAH(INS_BARIS_FORMAT, 1);
 
     snprintf(result, result_size, "%llu|%llu|%.2f|%.2f|%lld|%d|%d|%d|%d",
             data->total_pemasukan,
@@ -475,9 +563,188 @@ void format_analisis_ke_string(const AnalisisKeuangan *data, char *result, int r
             data->total_trx_pemasukan);
 }
 
+/* ===== IMPLEMENTASI PENULIS BARIS ===== */
+
+/* Kebijakan sinkron untuk penulis yang ditutup (SINKRON_*) */
+static int kebijakan_sinkron = SINKRON_TIDAK;
+
+/**
+ * Helper: Menulis seluruh potongan iovec, mengulang bila write terpotong
+ */
+static int tulis_semua_iovec(int fd, struct iovec *iov, int jumlah) {
+    while (jumlah > 0) {
+        ssize_t n = writev(fd, iov, jumlah);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return 0;
+        }
+        /* Lewati potongan yang sudah terkirim utuh, geser yang terpotong */
+        while (jumlah > 0 && (size_t)n >= iov->iov_len) {
+            n -= iov->iov_len;
+            iov++;
+            jumlah--;
+        }
+        if (jumlah > 0) {
+            iov->iov_base = (char *)iov->iov_base + n;
+            iov->iov_len -= n;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Helper: Mengirim isi buffer penulis ke file, opsional bersama data tambahan
+ */
+static void kuras_penulis(PenulisBaris *w, const char *ekstra, int ekstra_len) {
+    struct iovec iov[2];
+    int jumlah = 0;
+
+    if (w->terpakai > 0) {
+        iov[jumlah].iov_base = w->buffer;
+        iov[jumlah].iov_len = w->terpakai;
+        jumlah++;
+    }
+    if (ekstra_len > 0) {
+        iov[jumlah].iov_base = (void *)ekstra;
+        iov[jumlah].iov_len = ekstra_len;
+        jumlah++;
+    }
+
+    if (jumlah > 0 && !w->gagal) {
+        if (tulis_semua_iovec(w->fd, iov, jumlah)) {
+            w->total += w->terpakai + ekstra_len;
+        } else {
+            w->gagal = 1;
+        }
+    }
+    w->terpakai = 0;
+}
+
+/**
+ * Memasang kebijakan sinkron untuk penulisan ulang penuh
+ */
+void atur_sinkron_file(int kebijakan) {
+    kebijakan_sinkron = (kebijakan == SINKRON_DATA) ? SINKRON_DATA : SINKRON_TIDAK;
+}
+
+/**
+ * Menutup file dan mencatat posisi akhirnya sebagai byte dibaca/ditulis
+ */
+int tutup_file(FILE *f, int penghitung) {
+    if (f == NULL) return EOF;
+
+    long posisi = ftell(f);
+    if (posisi > 0) INSTRUMEN_TAMBAH(penghitung, posisi);
+    return fclose(f);
+}
+
+/**
+ * Mengganti file lewat rename dan mencatatnya
+ */
+int ganti_file(const char *dari, const char *ke) {
+    if (dari == NULL || ke == NULL) return 0;
+
+    INSTRUMEN_TAMBAH(INS_RENAME, 1);
+    return rename(dari, ke) == 0;
+}
+
+/**
+ * Membuka penulis baris ke file (overwrite)
+ */
+int penulis_buka(PenulisBaris *w, const char *filename) {
+    if (w == NULL || filename == NULL) return 0;
+
+    w->terpakai = 0;
+    w->total = 0;
+    w->gagal = 0;
+
+    INSTRUMEN_TAMBAH(INS_FOPEN, 1);
+    do {
+        w->fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    } while (w->fd < 0 && errno == EINTR);
+
+    return w->fd >= 0;
+}
+
+/**
+ * Menulis potongan byte ke penulis
+ */
+void penulis_tulis(PenulisBaris *w, const char *data, int len) {
+    if (w == NULL || data == NULL || len <= 0) return;
+
+    if (len <= UKURAN_BUFFER_PENULIS - w->terpakai) {
+        memcpy(w->buffer + w->terpakai, data, len);
+        w->terpakai += len;
+        return;
+    }
+
+    /* Data besar tidak disalin: buffer dan data dikirim dalam satu writev */
+    kuras_penulis(w, data, len);
+}
+
+/**
+ * Menulis satu baris (ditambah newline) ke penulis
+ */
+void penulis_tulis_baris(PenulisBaris *w, const char *line) {
+    if (w == NULL || line == NULL) return;
+
+    int len = strlen(line);
+    if (len + 1 > UKURAN_BUFFER_PENULIS - w->terpakai) kuras_penulis(w, NULL, 0);
+    penulis_tulis(w, line, len);
+    penulis_tulis(w, "\n", 1);
+}
+
+/**
+ * Memformat transaksi langsung ke buffer penulis
+ */
+void penulis_tulis_transaksi(PenulisBaris *w, const Transaksi *trx) {
+    if (w == NULL || trx == NULL) return;
+
+    /* Sisakan satu baris penuh agar format tidak perlu buffer perantara */
+    if (UKURAN_BUFFER_PENULIS - w->terpakai < MAX_LINE_LENGTH) kuras_penulis(w, NULL, 0);
+
+    int len = format_transaksi_ke_buffer(trx, w->buffer + w->terpakai, MAX_LINE_LENGTH);
+    if (len > MAX_LINE_LENGTH - 1) len = MAX_LINE_LENGTH - 1;
+    w->terpakai += len;
+    w->buffer[w->terpakai++] = '\n';
+}
+
+/**
+ * Memformat pos langsung ke buffer penulis
+ */
+void penulis_tulis_pos(PenulisBaris *w, const PosAnggaran *pos) {
+    if (w == NULL || pos == NULL) return;
+
+    if (UKURAN_BUFFER_PENULIS - w->terpakai < MAX_LINE_LENGTH) kuras_penulis(w, NULL, 0);
+
+    int len = format_pos_ke_buffer(pos, w->buffer + w->terpakai, MAX_LINE_LENGTH);
+    if (len > MAX_LINE_LENGTH - 1) len = MAX_LINE_LENGTH - 1;
+    w->terpakai += len;
+    w->buffer[w->terpakai++] = '\n';
+}
+
+/**
+ * Menutup penulis: kirim sisa buffer, sinkron sesuai kebijakan, tutup file
+ */
+int penulis_tutup(PenulisBaris *w) {
+    if (w == NULL || w->fd < 0) return 0;
+
+    kuras_penulis(w, NULL, 0);
+
+    if (!w->gagal && kebijakan_sinkron == SINKRON_DATA && fdatasync(w->fd) != 0) {
+        w->gagal = 1;
+    }
+    if (close(w->fd) != 0) w->gagal = 1;
+    w->fd = -1;
+
+    if (w->total > 0) INSTRUMEN_TAMBAH(INS_BYTE_TULIS, w->total);
+    return !w->gagal;
+}
+
 /* ===== IMPLEMENTASI FILE ANALISIS ===== */
 
 int muat_analisis_bulan(int bulan, AnalisisKeuangan *result) {
+    INSTRUMEN_FUNGSI();
     if (!result || bulan < 1 || bulan > 12) return 0;
 
     pastikan_direktori_data();
@@ -497,11 +764,12 @@ int muat_analisis_bulan(int bulan, AnalisisKeuangan *result) {
         }
     }
 
-    fclose(fp);
+    tutup_file(fp, INS_BYTE_BACA);
     return success;
 }
 
 int simpan_analisis_bulan(int bulan, AnalisisKeuangan *analisis) {
+    INSTRUMEN_FUNGSI();
     if (!analisis || bulan < 1 || bulan > 12) return 0;
 
     pastikan_direktori_data();
@@ -515,7 +783,7 @@ int simpan_analisis_bulan(int bulan, AnalisisKeuangan *analisis) {
     format_analisis_ke_string(analisis, line, sizeof(line));
     fprintf(fp, "%s\n", line);
 
-    fclose(fp);
+    tutup_file(fp, INS_BYTE_TULIS);
     return 1;
 }
 
@@ -546,6 +814,7 @@ int inisialisasi_analisis_bulan(int bulan) {
 /* ===== IMPLEMENTASI FILE POS ANGGARAN ===== */
 
 int muat_pos_bulan(PosAnggaran *list, int max_count, int bulan) {
+    INSTRUMEN_FUNGSI();
     if (!list || max_count <= 0 || bulan < 1 || bulan > 12) return 0;
 
     pastikan_direktori_data();
@@ -567,11 +836,12 @@ int muat_pos_bulan(PosAnggaran *list, int max_count, int bulan) {
         }
     }
 
-    fclose(fp);
+    tutup_file(fp, INS_BYTE_BACA);
     return count;
 }
 
 int simpan_pos_bulan(PosAnggaran *list, int count, int bulan) {
+    INSTRUMEN_FUNGSI();
     if (!list && count > 0) return 0;
     if (bulan < 1 || bulan > 12) return 0;
 
@@ -579,20 +849,18 @@ int simpan_pos_bulan(PosAnggaran *list, int count, int bulan) {
     char filename[MAX_PATH];
     dapatkan_nama_file_bulan(FILE_POS_PREFIX, bulan, filename, sizeof(filename));
 
-    FILE *fp = buka_file_tulis(filename);
-    if (!fp) return 0;
+    PenulisBaris w;
+    if (!penulis_buka(&w, filename)) return 0;
 
-    char line[512];
     for (int i = 0; i < count; i++) {
-        format_pos_ke_string(&list[i], line, sizeof(line));
-        fprintf(fp, "%s\n", line);
+        penulis_tulis_pos(&w, &list[i]);
     }
 
-    fclose(fp);
-    return 1;
+    return penulis_tutup(&w);
 }
 
 int tambah_pos_ke_file(PosAnggaran *pos, int bulan) {
+    INSTRUMEN_FUNGSI();
     if (!pos || bulan < 1 || bulan > 12) return 0;
 
     PosAnggaran list[MAX_POS];
@@ -620,6 +888,7 @@ int tambah_pos_ke_file(PosAnggaran *pos, int bulan) {
 }
 
 int ubah_pos_di_file(int no, PosAnggaran *pos, int bulan) {
+    INSTRUMEN_FUNGSI();
     if (!pos || no <= 0 || bulan < 1 || bulan > 12) return 0;
 
     PosAnggaran list[MAX_POS];
@@ -638,6 +907,7 @@ int ubah_pos_di_file(int no, PosAnggaran *pos, int bulan) {
 }
 
 int hapus_pos_dari_file(int no, int bulan) {
+    INSTRUMEN_FUNGSI();
     if (no <= 0 || bulan < 1 || bulan > 12) return 0;
 
     PosAnggaran list[MAX_POS];
@@ -662,6 +932,7 @@ int hapus_pos_dari_file(int no, int bulan) {
 }
 
 int cari_pos_berdasarkan_nama(const char *nama, int bulan, PosAnggaran *result) {
+    INSTRUMEN_FUNGSI();
     if (!nama || !result || bulan < 1 || bulan > 12) return 0;
 
     PosAnggaran list[MAX_POS];
@@ -678,6 +949,7 @@ int cari_pos_berdasarkan_nama(const char *nama, int bulan, PosAnggaran *result)
 }
 
 int cari_pos_berdasarkan_nomor(int no, int bulan, PosAnggaran *result) {
+    INSTRUMEN_FUNGSI();
     if (no <= 0 || !result || bulan < 1 || bulan > 12) return 0;
 
     PosAnggaran list[MAX_POS];
@@ -713,9 +985,11 @@ int inisialisasi_pos_bulan(int bulan) {
 }
 
 int salin_pos_dari_bulan(int bulan_tujuan, int bulan_sumber) {
+    INSTRUMEN_FUNGSI();
     if (bulan_tujuan < 1 || bulan_tujuan > 12) return 0;
     if (bulan_sumber < 1 || bulan_sumber > 12) return 0;
     if (bulan_tujuan == bulan_sumber) return 0;
+    if (cek_periode_tertutup(bulan_tujuan)) return 0;
 
     PosAnggaran list[MAX_POS];
     int count = muat_pos_bulan(list, MAX_POS, bulan_sumber);
@@ -735,172 +1009,572 @@ int salin_pos_dari_bulan(int bulan_tujuan, int bulan_sumber) {
 
 /* ===== IMPLEMENTASI FILE TRANSAKSI ===== */
 
-int muat_transaksi(Transaksi *list, int max_count) {
-    if (!list || max_count <= 0) return 0;
+/**
+ * Helper: Konteks untuk memuat transaksi ke array berkapasitas tetap
+ */
+typedef struct {
+    Transaksi *list;
+    int max_count;
+    int count;
+} KonteksMuatArray;
+
+/**
+ * Helper: Pengunjung yang menyalin transaksi ke array sampai penuh
+ */
+static int kunjungi_muat_array(const Transaksi *trx, void *konteks) {
+    KonteksMuatArray *k = (KonteksMuatArray *)konteks;
+    k->list[k->count++] = *trx;
+    return k->count < k->max_count;
+}
+
+/**
+ * Helper: Pengunjung yang menambahkan transaksi ke list dinamis
+ */
+static int kunjungi_muat_list(const Transaksi *trx, void *konteks) {
+    return tambah_ke_list_transaksi((ListTransaksi *)konteks, trx) ? 1 : -1;
+}
+
+/* ===== CACHE HANGAT TRANSAKSI BULAN ===== */
+
+/**
+ * Struct salinan transaksi satu bulan yang sudah diurai
+ */
+typedef struct {
+    int bulan;                  /* Bulan yang dijaga hangat, 0 = tidak ada */
+    int valid;                  /* 1 jika list berisi data untuk stat st */
+    struct stat st;             /* Stat file transaksi saat list dimuat */
+    ListTransaksi list;         /* Transaksi bulan, urutan sama dengan telusuri_transaksi */
+} CacheHangat;
+
+static pthread_mutex_t kunci_hangat = PTHREAD_MUTEX_INITIALIZER;
+static CacheHangat cache_hangat;
+
+/**
+ * Helper: Mengambil stat file transaksi jika bulan adalah bulan hangat.
+ * Mengembalikan 1 jika bulan dijaga hangat dan file transaksi ada.
+ */
+static int stat_bulan_hangat(int bulan, struct stat *st) {
+    pthread_mutex_lock(&kunci_hangat);
+    int hangat = (bulan > 0 && bulan == cache_hangat.bulan);
+    pthread_mutex_unlock(&kunci_hangat);
+    if (!hangat) return 0;
+
+    char filename[MAX_PATH];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+    return stat(filename, st) == 0;
+}
+
+/**
+ * Helper: Memeriksa cache cocok dengan bulan dan stat (kunci_hangat dipegang)
+ */
+static int cache_hangat_cocok(int bulan, const struct stat *st) {
+    const CacheHangat *c = &cache_hangat;
+    return c->valid && c->bulan == bulan && stat_sama(st, &c->st);
+}
+
+/**
+ * Helper: Menelusuri transaksi dari cache hangat dengan aturan sama seperti
+ * telusuri_transaksi. *dilayani = 0 jika cache tidak berlaku (pemanggil membaca file).
+ * Callback dipanggil selama kunci cache dipegang dan tidak boleh menelusuri lagi.
+ */
+static int telusuri_cache_hangat(int bulan, PengunjungTransaksi kunjungi, void *konteks, int *dilayani) {
+    struct stat st;
+    *dilayani = 0;
+    if (!stat_bulan_hangat(bulan, &st)) return 0;
+
+    pthread_mutex_lock(&kunci_hangat);
+    if (!cache_hangat_cocok(bulan, &st)) {
+        pthread_mutex_unlock(&kunci_hangat);
+        return 0;
+    }
+
+    *dilayani = 1;
+    int dikunjungi = 0;
+    for (int i = 0; i < cache_hangat.list.count; i++) {
+        dikunjungi++;
+        int lanjut = kunjungi(&cache_hangat.list.data[i], konteks);
+        if (lanjut < 0) {
+            dikunjungi = -1;
+            break;
+        }
+        if (lanjut == 0) break;
+    }
+    pthread_mutex_unlock(&kunci_hangat);
+
+    return dikunjungi;
+}
+
+/**
+ * Helper: Menyalin cache hangat ke list, mengembalikan 1 jika cache berlaku untuk stat st
+ */
+static int salin_cache_hangat(ListTransaksi *list, int bulan, const struct stat *st) {
+    pthread_mutex_lock(&kunci_hangat);
+    int ok = cache_hangat_cocok(bulan, st);
+    if (ok) {
+        int n = cache_hangat.list.count;
+        if (n > list->capacity) {
+            Transaksi *baru = (Transaksi *)realloc(list->data, (size_t)n * sizeof(Transaksi));
+            if (baru == NULL) {
+                ok = 0;
+            } else {
+                list->data = baru;
+                list->capacity = n;
+            }
+        }
+        if (ok) {
+            if (n > 0) memcpy(list->data, cache_hangat.list.data, (size_t)n * sizeof(Transaksi));
+            list->count = n;
+        }
+    }
+    pthread_mutex_unlock(&kunci_hangat);
+    return ok;
+}
+
+/**
+ * Helper: Menyimpan hasil muat bulan hangat ke cache dengan stat sebelum dimuat,
+ * sehingga perubahan file selama pemuatan membuat cache langsung tidak berlaku
+ */
+static void simpan_cache_hangat(const ListTransaksi *list, int bulan, const struct stat *st) {
+    pthread_mutex_lock(&kunci_hangat);
+    if (cache_hangat.bulan == bulan) {
+        CacheHangat *c = &cache_hangat;
+        int n = list->count;
+        if (n > c->list.capacity) {
+            Transaksi *baru = (Transaksi *)realloc(c->list.data, (size_t)n * sizeof(Transaksi));
+            if (baru != NULL) {
+                c->list.data = baru;
+                c->list.capacity = n;
+            }
+        }
+        c->valid = (n <= c->list.capacity);
+        if (c->valid) {
+            if (n > 0) memcpy(c->list.data, list->data, (size_t)n * sizeof(Transaksi));
+            c->list.count = n;
+            c->st = *st;
+        }
+    }
+    pthread_mutex_unlock(&kunci_hangat);
+}
+
+int telusuri_transaksi(int bulan, PengunjungTransaksi kunjungi, void *konteks) {
+    INSTRUMEN_FUNGSI();
+    if (!kunjungi || bulan < 0 || bulan > 12) return -1;
+
+    int dilayani;
+    int dari_cache = telusuri_cache_hangat(bulan, kunjungi, konteks, &dilayani);
+    if (dilayani) return dari_cache;
 
     pastikan_direktori_data();
+
+    /* Arsip tahun yang disegel ditelusuri lebih dulu, urut tahun */
+    int berhenti = 0;
+    int dikunjungi = telusuri_arsip(bulan, kunjungi, konteks, &berhenti);
+    if (dikunjungi < 0) return -1;
+    if (berhenti) return dikunjungi;
+
     char filename[MAX_PATH];
     dapatkan_nama_file_transaksi(filename, sizeof(filename));
 
     FILE *fp = buka_file_baca(filename);
-    if (!fp) return 0;
+    if (!fp) return dikunjungi;
 
-    char line[512];
-    int count = 0;
+    char line[MAX_LINE_LENGTH];
+    Transaksi trx;
 
-    while (fgets(line, sizeof(line), fp) && count < max_count) {
+    /* Satu lintasan: parse dan filter langsung, tanpa array perantara */
+    while (fgets(line, sizeof(line), fp)) {
         hapus_newline_string(line);
         if (strlen(line) == 0) continue;
+        if (!urai_baris_transaksi(line, &trx)) continue;
 
-        if (urai_baris_transaksi(line, &list[count])) {
-            count++;
+        if (bulan > 0) {
+            Tanggal tgl;
+            if (!urai_tanggal_struct(trx.tanggal, &tgl) || tgl.bulan != bulan) continue;
         }
+
+        dikunjungi++;
+        int lanjut = kunjungi(&trx, konteks);
+        if (lanjut < 0) {
+            tutup_file(fp, INS_BYTE_BACA);
+            return -1;
+        }
+        if (lanjut == 0) break;
     }
 
-    fclose(fp);
+    tutup_file(fp, INS_BYTE_BACA);
+    return dikunjungi;
+}
+
+/**
+ * Helper: Memuat transaksi paralel ke array berkapasitas tetap.
+ * Mengembalikan jumlah transaksi, atau -1 jika pemuatan paralel tidak dipakai/gagal.
+ */
+static int muat_array_paralel(Transaksi *list, int max_count, int bulan) {
+    char filename[MAX_PATH];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+    if (!muat_paralel_dianjurkan(filename)) return -1;
+
+    ListTransaksi semua;
+    if (!inisialisasi_list_transaksi(&semua, 1024)) return -1;
+
+    int count = muat_transaksi_paralel(&semua, bulan);
+    if (count > max_count) count = max_count;
+    if (count > 0) memcpy(list, semua.data, (size_t)count * sizeof(Transaksi));
+
+    bebaskan_list_transaksi(&semua);
     return count;
 }
 
+int muat_transaksi(Transaksi *list, int max_count) {
+    INSTRUMEN_FUNGSI();
+    if (!list || max_count <= 0) return 0;
+
+    int paralel = muat_array_paralel(list, max_count, 0);
+    if (paralel >= 0) return paralel;
+
+    KonteksMuatArray k = { list, max_count, 0 };
+    telusuri_transaksi(0, kunjungi_muat_array, &k);
+    return k.count;
+}
+
 int muat_transaksi_bulan(Transaksi *list, int max_count, int bulan) {
+    INSTRUMEN_FUNGSI();
     if (!list || max_count <= 0 || bulan < 1 || bulan > 12) return 0;
 
-    Transaksi all[MAX_TRANSAKSI];
-    int total = muat_transaksi(all, MAX_TRANSAKSI);
+    KonteksMuatArray k = { list, max_count, 0 };
+    int dilayani;
+    telusuri_cache_hangat(bulan, kunjungi_muat_array, &k, &dilayani);
+    if (dilayani) return k.count;
 
-    int count = 0;
-    for (int i = 0; i < total && count < max_count; i++) {
-        Tanggal tgl;
-        /* Filter berdasarkan bulan */
-        if (urai_tanggal_struct(all[i].tanggal, &tgl) && tgl.bulan == bulan) {
-            list[count++] = all[i];
-        }
+    int paralel = muat_array_paralel(list, max_count, bulan);
+    if (paralel >= 0) return paralel;
+
+    telusuri_transaksi(bulan, kunjungi_muat_array, &k);
+    return k.count;
+}
+
+int muat_transaksi_ke_list(ListTransaksi *list, int bulan) {
+    INSTRUMEN_FUNGSI();
+    if (!list || !list->data || bulan < 0 || bulan > 12) return -1;
+
+    /* Bulan hangat: salin dari cache, atau muat lalu perbarui cache */
+    struct stat st;
+    int hangat = stat_bulan_hangat(bulan, &st);
+    if (hangat && salin_cache_hangat(list, bulan, &st)) return list->count;
+
+    char filename[MAX_PATH];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+
+    int count;
+    if (muat_paralel_dianjurkan(filename)) {
+        count = muat_transaksi_paralel(list, bulan);
+    } else {
+        list->count = 0;
+        count = (telusuri_transaksi(bulan, kunjungi_muat_list, list) < 0) ? -1 : list->count;
+    }
+
+    if (hangat && count >= 0) simpan_cache_hangat(list, bulan, &st);
+    return count;
+}
+
+/**
+ * Menjaga transaksi satu bulan tetap terurai di memori
+ */
+int hangatkan_transaksi_bulan(int bulan) {
+    INSTRUMEN_FUNGSI();
+    if (bulan < 1 || bulan > 12) return -1;
+
+    /* Ganti bulan hangat: data bulan lama tidak berlaku lagi */
+    pthread_mutex_lock(&kunci_hangat);
+    if (cache_hangat.bulan != bulan) {
+        cache_hangat.bulan = bulan;
+        cache_hangat.valid = 0;
+        cache_hangat.list.count = 0;
     }
+    pthread_mutex_unlock(&kunci_hangat);
+
+    ListTransaksi list;
+    if (!inisialisasi_list_transaksi(&list, 64)) return -1;
+    int count = muat_transaksi_ke_list(&list, bulan);
+    bebaskan_list_transaksi(&list);
 
     return count;
 }
 
+/**
+ * Melepas cache hangat transaksi
+ */
+void lepaskan_cache_hangat(void) {
+    pthread_mutex_lock(&kunci_hangat);
+    free(cache_hangat.list.data);
+    memset(&cache_hangat, 0, sizeof(cache_hangat));
+    pthread_mutex_unlock(&kunci_hangat);
+}
+
 int simpan_transaksi(Transaksi *list, int count) {
+    INSTRUMEN_FUNGSI();
     if (!list && count > 0) return 0;
 
     pastikan_direktori_data();
     char filename[MAX_PATH];
     dapatkan_nama_file_transaksi(filename, sizeof(filename));
 
-    FILE *fp = buka_file_tulis(filename);
-    if (!fp) return 0;
+    PenulisBaris w;
+    if (!penulis_buka(&w, filename)) return 0;
 
-    char line[512];
     for (int i = 0; i < count; i++) {
-        format_transaksi_ke_string(&list[i], line, sizeof(line));
-        fprintf(fp, "%s\n", line);
+        penulis_tulis_transaksi(&w, &list[i]);
     }
 
-    fclose(fp);
-    return 1;
+    return penulis_tutup(&w);
 }
 
 int tambah_transaksi_ke_file(Transaksi *trx) {
+    INSTRUMEN_FUNGSI();
     if (!trx) return 0;
 
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi(list, MAX_TRANSAKSI);
-
-    if (count >= MAX_TRANSAKSI) return 0;
+    pastikan_direktori_data();
+    char filename[MAX_PATH];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
 
-    list[count] = *trx;
-    count++;
+    /* Transaksi baru cukup ditambahkan di akhir file */
+    char line[MAX_LINE_LENGTH];
+    format_transaksi_ke_string(trx, line, sizeof(line));
 
-    return simpan_transaksi(list, count);
+    return tambah_baris_file(filename, line);
 }
 
-int ubah_transaksi_di_file(const char *id, Transaksi *trx) {
-    if (!id || !trx) return 0;
+/**
+ * Helper: Menulis ulang file transaksi baris demi baris lewat file sementara.
+ * Baris dengan ID yang cocok diganti pengganti, atau dibuang jika pengganti NULL.
+ * Mengembalikan 1 jika ID ditemukan dan file diganti, 0 jika tidak.
+ */
+static int tulis_ulang_transaksi(const char *id, const Transaksi *pengganti) {
+    INSTRUMEN_FUNGSI();
+    pastikan_direktori_data();
+    char filename[MAX_PATH], temp_name[MAX_PATH + 8];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+    snprintf(temp_name, sizeof(temp_name), "%s.tmp", filename);
 
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi(list, MAX_TRANSAKSI);
+    FILE *in = buka_file_baca(filename);
+    if (!in) return 0;
 
-    for (int i = 0; i < count; i++) {
-        if (strcmp(list[i].id, id) == 0) {
-            list[i] = *trx;
-            return simpan_transaksi(list, count);
+    PenulisBaris out;
+    if (!penulis_buka(&out, temp_name)) {
+        tutup_file(in, INS_BYTE_BACA);
+        return 0;
+    }
+
+    char line[MAX_LINE_LENGTH];
+    Transaksi trx;
+    int ditemukan = 0;
+
+    while (fgets(line, sizeof(line), in)) {
+        hapus_newline_string(line);
+        if (strlen(line) == 0) continue;
+
+        if (!ditemukan && urai_baris_transaksi(line, &trx) && strcmp(trx.id, id) == 0) {
+            ditemukan = 1;
+            if (pengganti) penulis_tulis_transaksi(&out, pengganti);
+            continue;
         }
+        penulis_tulis_baris(&out, line);
     }
 
-    return 0;
+    tutup_file(in, INS_BYTE_BACA);
+    if (!penulis_tutup(&out) || !ditemukan) {
+        remove(temp_name);
+        return 0;
+    }
+    if (!ganti_file(temp_name, filename)) {
+        remove(temp_name);
+        return 0;
+    }
+
+    return 1;
+}
+
+int ubah_transaksi_di_file(const char *id, Transaksi *trx) {
+    if (!id || !trx) return 0;
+
+    return tulis_ulang_transaksi(id, trx);
 }
 
 int hapus_transaksi_dari_file(const char *id) {
     if (!id) return 0;
 
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi(list, MAX_TRANSAKSI);
+    return tulis_ulang_transaksi(id, NULL);
+}
 
-    int found = -1;
-    for (int i = 0; i < count; i++) {
-        if (strcmp(list[i].id, id) == 0) {
-            found = i;
+int kompaksi_file_transaksi(void) {
+    INSTRUMEN_FUNGSI();
+    pastikan_direktori_data();
+    char filename[MAX_PATH], temp_name[MAX_PATH + 8];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+    snprintf(temp_name, sizeof(temp_name), "%s.tmp", filename);
+
+    FILE *in = buka_file_baca(filename);
+    if (!in) return 0;  /* Belum ada file, tidak ada yang dikompaksi */
+
+    PenulisBaris out;
+    if (!penulis_buka(&out, temp_name)) {
+        tutup_file(in, INS_BYTE_BACA);
+        return -1;
+    }
+
+    char rusak_name[MAX_PATH + 8];
+    snprintf(rusak_name, sizeof(rusak_name), "%s%s", filename, FILE_RUSAK_SUFFIX);
+
+    char line[MAX_LINE_LENGTH];
+    Transaksi trx;
+    FILE *rusak = NULL;
+    int dipindah = 0, kosong = 0, ok = 1;
+
+    /* Baris valid disalin, baris kosong dibuang, baris rusak dipindah utuh ke file .rusak */
+    while (ok && fgets(line, sizeof(line), in)) {
+        size_t len = strlen(line);
+        int terpotong = (len > 0 && line[len - 1] != '\n' && !feof(in));
+        hapus_newline_string(line);
+
+        if (!terpotong) {
+            if (line[0] == '\0') {
+                kosong++;
+                continue;
+            }
+            if (urai_baris_transaksi(line, &trx)) {
+                penulis_tulis_baris(&out, line);
+                continue;
+            }
+        }
+
+        if (!rusak && !(rusak = buka_file_tambah(rusak_name))) {
+            ok = 0;
             break;
         }
+        fputs(line, rusak);
+        if (terpotong) {
+            /* Sisa baris yang melebihi buffer ikut disalin apa adanya */
+            int c;
+            while ((c = fgetc(in)) != EOF && c != '\n') fputc(c, rusak);
+        }
+        fputc('\n', rusak);
+        dipindah++;
     }
 
-    if (found < 0) return 0;
+    tutup_file(in, INS_BYTE_BACA);
+    if (rusak && (ferror(rusak) || fclose(rusak) != 0)) ok = 0;
+    if (!penulis_tutup(&out) || !ok) {
+        remove(temp_name);
+        return -1;
+    }
 
-    /* Shift array */
-    for (int i = found; i < count - 1; i++) {
-        list[i] = list[i + 1];
+    /* File asli hanya diganti jika memang ada baris yang dibuang */
+    if (dipindah == 0 && kosong == 0) {
+        remove(temp_name);
+        return 0;
+    }
+    if (!ganti_file(temp_name, filename)) {
+        remove(temp_name);
+        return -1;
     }
 
-    return simpan_transaksi(list, count - 1);
+    return dipindah;
+}
+
+/**
+ * Helper: Konteks pencarian transaksi berdasarkan ID
+ */
+typedef struct {
+    const char *id;
+    Transaksi *result;
+    int ditemukan;
+} KonteksCariId;
+
+/**
+ * Helper: Pengunjung yang berhenti pada transaksi dengan ID yang dicari
+ */
+static int kunjungi_cari_id(const Transaksi *trx, void *konteks) {
+    KonteksCariId *k = (KonteksCariId *)konteks;
+    if (strcmp(trx->id, k->id) != 0) return 1;
+
+    *k->result = *trx;
+    k->ditemukan = 1;
+    return 0;
 }
 
 int cari_transaksi_berdasarkan_id(const char *id, Transaksi *result) {
+    INSTRUMEN_FUNGSI();
     if (!id || !result) return 0;
 
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi(list, MAX_TRANSAKSI);
+    KonteksCariId k = { id, result, 0 };
+    telusuri_transaksi(0, kunjungi_cari_id, &k);
+    return k.ditemukan;
+}
 
-    for (int i = 0; i < count; i++) {
-        if (strcmp(list[i].id, id) == 0) {
-            *result = list[i];
-            return 1;
-        }
+/**
+ * Helper: Pengunjung yang mencatat nomor ID terbesar
+ */
+static int kunjungi_nomor_id(const Transaksi *trx, void *konteks) {
+    int *max_num = (int *)konteks;
+    if (validasi_format_id(trx->id)) {
+        int num = atoi(trx->id + 1);
+        if (num > *max_num) *max_num = num;
     }
+    return 1;
+}
 
-    return 0;
+int ambil_nomor_id_terbesar(void) {
+    INSTRUMEN_FUNGSI();
+    int max_num = 0;
+    telusuri_transaksi(0, kunjungi_nomor_id, &max_num);
+    return max_num;
+}
+
+int format_id_transaksi(int nomor, char *buffer, int buffer_size) {
+    if (!buffer || buffer_size <= 0) return 0;
+
+    buffer[0] = '\0';
+    if (nomor < 1 || nomor > MAX_NOMOR_ID) return 0;
+
+    int n = snprintf(buffer, buffer_size, "T%04d", nomor);
+    if (n < 0 || n >= buffer_size) {
+        buffer[0] = '\0';
+        return 0;
+    }
+    return 1;
 }
 
 /**
  * Generate ID transaksi baru (format Txxxx)
  */
-void buat_id_transaksi(char *buffer) {
-    if (!buffer) return;
+int buat_id_transaksi(char *buffer, int buffer_size) {
+    if (!buffer) return 0;
 
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi(list, MAX_TRANSAKSI);
+    return format_id_transaksi(ambil_nomor_id_terbesar() + 1, buffer, buffer_size);
+}
 
-    int max_num = 0;
-    for (int i = 0; i < count; i++) {
-        if (list[i].id[0] == 'T' && strlen(list[i].id) == 5) {
-            int num = atoi(list[i].id + 1);
-            if (num > max_num) max_num = num;
-        }
-    }
+/**
+ * Helper: Konteks penghitung transaksi per pos
+ */
+typedef struct {
+    const char *nama_pos;
+    int hasil;
+} KonteksHitungPos;
 
-    sprintf(buffer, "T%04d", max_num + 1);
+/**
+ * Helper: Pengunjung yang menghitung transaksi dengan pos tertentu
+ */
+static int kunjungi_hitung_pos(const Transaksi *trx, void *konteks) {
+    KonteksHitungPos *k = (KonteksHitungPos *)konteks;
+    if (banding_string_tanpa_case(trx->pos, k->nama_pos) == 0) k->hasil++;
+    return 1;
 }
 
 int hitung_transaksi_berdasarkan_pos(const char *nama_pos) {
+    INSTRUMEN_FUNGSI();
     if (!nama_pos) return 0;
 
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi(list, MAX_TRANSAKSI);
-
-    int hasil = 0;
-    for (int i = 0; i < count; i++) {
-        if (banding_string_tanpa_case(list[i].pos, nama_pos) == 0) {
-            hasil++;
-        }
-    }
-
-    return hasil;
+    KonteksHitungPos k = { nama_pos, 0 };
+    telusuri_transaksi(0, kunjungi_hitung_pos, &k);
+    return k.hasil;
 }
@@ -0,0 +1,358 @@
+/*
+ * =============================================================================
+ * File        : impor.c
+ * Deskripsi   : Implementasi modul impor massal transaksi (CSV/TSV)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan impor transaksi dari stream CSV/TSV dengan
+ * memori konstan: setiap baris dibaca, dipecah di tempat, divalidasi, lalu
+ * baris yang diterima langsung ditulis ke file sementara. Setelah input
+ * habis, file transaksi lama dan baris baru disalin ke file .tmp yang
+ * kemudian menggantikan file transaksi dalam satu kali rename.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h     : Untuk operasi stream dan tmpfile
+ * - string.h    : Untuk manipulasi string
+ * - impor.h     : Header file modul ini
+ * - transaksi.h : Untuk validasi jenis, deskripsi, dan format transaksi
+ * - pos.h       : Untuk batas panjang nama pos
+ * - file.h      : Untuk nama file transaksi, pemberian ID, dan penulisan ulang file
+ * - pekerja.h   : Untuk perhitungan ulang bulan terdampak
+ * - arsip.h     : Untuk menolak baris pada tahun yang disegel
+ * - periode.h   : Untuk menolak baris pada bulan yang ditutup
+ * - utils.h     : Untuk validasi tanggal, nominal, dan string
+ * - instrumen.h : Untuk penghitung byte dibaca
+ *
+ * CATATAN:
+ * Field CSV yang dikutip boleh berisi koma dan kutip ganda ("" menjadi "),
+ * tetapi tidak boleh melewati batas baris. ID diberikan berurutan mulai dari
+ * nomor terbesar yang sudah ada, cukup satu kali penelusuran file transaksi.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "impor.h"
+#include "transaksi.h"
+#include "pos.h"
+#include "file.h"
+#include "pekerja.h"
+#include "arsip.h"
+#include "periode.h"
+#include "utils.h"
+#include "instrumen.h"
+
+/* ===== KONSTANTA LOKAL ===== */
+
+#define UKURAN_BLOK_SALIN   8192    /* Ukuran blok saat menyalin file */
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Memecah baris TSV di tempat.
+ * Mengembalikan jumlah kolom, atau max_kolom + 1 jika kolom berlebih.
+ */
+static int pecah_tsv(char *line, char **kolom, int max_kolom) {
+    int n = 0;
+    char *p = line;
+
+    while (1) {
+        if (n >= max_kolom) return max_kolom + 1;
+        kolom[n++] = p;
+
+        char *tab = strchr(p, '\t');
+        if (!tab) break;
+        *tab = '\0';
+        p = tab + 1;
+    }
+
+    return n;
+}
+
+/**
+ * Helper: Memecah baris CSV di tempat (kutip ganda ala RFC 4180).
+ * Mengembalikan jumlah kolom, max_kolom + 1 jika kolom berlebih,
+ * atau -1 jika tanda kutip tidak valid.
+ */
+static int pecah_csv(char *line, char **kolom, int max_kolom) {
+    int n = 0;
+    char *baca = line;
+
+    while (1) {
+        if (n >= max_kolom) return max_kolom + 1;
+
+        /* Penulisan selalu di belakang pembacaan, aman dilakukan di tempat */
+        char *tulis = baca;
+        kolom[n++] = tulis;
+
+        char *p = baca;
+        while (*p == ' ') p++;
+
+        if (*p == '"') {
+            baca = p + 1;
+            while (1) {
+                if (*baca == '\0') return -1;
+                if (*baca == '"') {
+                    if (baca[1] == '"') {
+                        *tulis++ = '"';
+                        baca += 2;
+                        continue;
+                    }
+                    baca++;
+                    break;
+                }
+                *tulis++ = *baca++;
+            }
+            while (*baca == ' ') baca++;
+            if (*baca != ',' && *baca != '\0') return -1;
+        } else {
+            while (*baca && *baca != ',') *tulis++ = *baca++;
+        }
+
+        char akhir = *baca;
+        *tulis = '\0';
+        if (akhir == '\0') break;
+        baca++;
+    }
+
+    return n;
+}
+
+/**
+ * Helper: Memvalidasi kolom satu baris dan mengisi transaksi (tanpa ID).
+ * Mengembalikan 1 jika valid, 0 jika tidak (pesan diisi alasan).
+ */
+static int validasi_baris_impor(char **kolom, int n, Transaksi *trx, const char **pesan) {
+    if (n < 4) {
+        *pesan = "Kolom kurang dari 4 (tanggal, jenis, pos, nominal)";
+        return 0;
+    }
+    if (n > MAX_KOLOM_IMPOR) {
+        *pesan = "Kolom lebih dari 5";
+        return 0;
+    }
+
+    for (int i = 0; i < n; i++) pangkas_string(kolom[i]);
+    const char *deskripsi = (n == MAX_KOLOM_IMPOR) ? kolom[4] : "";
+
+    if (!validasi_tanggal_lengkap(kolom[0])) {
+        *pesan = "Tanggal tidak valid";
+        return 0;
+    }
+    if (cek_tanggal_tersegel(kolom[0])) {
+        *pesan = "Tahun transaksi sudah disegel";
+        return 0;
+    }
+    if (cek_tanggal_tertutup(kolom[0])) {
+        *pesan = "Bulan transaksi sudah ditutup";
+        return 0;
+    }
+
+    int jenis = urai_jenis_transaksi(kolom[1]);
+    if (!validasi_jenis_transaksi(jenis)) {
+        *pesan = "Jenis transaksi tidak valid";
+        return 0;
+    }
+
+    if (!validasi_tidak_kosong(kolom[2])) {
+        *pesan = "Pos anggaran harus diisi";
+        return 0;
+    }
+    if (!validasi_panjang_pos(kolom[2])) {
+        *pesan = "Nama pos terlalu panjang (max 20 karakter)";
+        return 0;
+    }
+    if (!validasi_tidak_ada_pipe(kolom[2])) {
+        *pesan = "Pos tidak boleh mengandung karakter |";
+        return 0;
+    }
+
+    unsigned long long nominal = 0;
+    if (!urai_nominal(kolom[3], &nominal)) {
+        *pesan = "Nominal tidak valid";
+        return 0;
+    }
+    if (!validasi_nominal_positif(nominal)) {
+        *pesan = "Nominal harus lebih dari 0";
+        return 0;
+    }
+
+    if (!validasi_panjang_deskripsi(deskripsi)) {
+        *pesan = "Deskripsi terlalu panjang (max 50 karakter)";
+        return 0;
+    }
+    if (!validasi_tidak_ada_pipe(deskripsi)) {
+        *pesan = "Deskripsi tidak boleh mengandung karakter |";
+        return 0;
+    }
+
+    memset(trx, 0, sizeof(Transaksi));
+    salin_string_aman(trx->tanggal, kolom[0], sizeof(trx->tanggal));
+    trx->jenis = jenis;
+    salin_string_aman(trx->pos, kolom[2], sizeof(trx->pos));
+    trx->nominal = nominal;
+    salin_string_aman(trx->deskripsi, deskripsi, sizeof(trx->deskripsi));
+
+    return 1;
+}
+
+/**
+ * Helper: Menyalin seluruh isi stream per blok ke penulis.
+ * Mengembalikan byte terakhir yang disalin, atau -1 jika kosong.
+ */
+static int salin_stream(FILE *dari, PenulisBaris *ke) {
+    char blok[UKURAN_BLOK_SALIN];
+    size_t n;
+    int terakhir = -1;
+
+    while ((n = fread(blok, 1, sizeof(blok), dari)) > 0) {
+        penulis_tulis(ke, blok, (int)n);
+        terakhir = (unsigned char)blok[n - 1];
+    }
+
+    return terakhir;
+}
+
+/**
+ * Helper: Menggabungkan file transaksi lama dan baris staging ke file .tmp,
+ * lalu menggantikan file transaksi. Mengembalikan 1 jika berhasil.
+ */
+static int commit_impor(FILE *staging) {
+    pastikan_direktori_data();
+    char filename[MAX_PATH], temp_name[MAX_PATH + 8];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+    snprintf(temp_name, sizeof(temp_name), "%s.tmp", filename);
+
+    PenulisBaris out;
+    if (!penulis_buka(&out, temp_name)) return 0;
+
+    FILE *lama = buka_file_baca(filename);
+    if (lama) {
+        int terakhir = salin_stream(lama, &out);
+        tutup_file(lama, INS_BYTE_BACA);
+        /* Baris terakhir file lama tanpa newline tidak boleh tersambung */
+        if (terakhir >= 0 && terakhir != '\n') penulis_tulis(&out, "\n", 1);
+    }
+
+    rewind(staging);
+    salin_stream(staging, &out);
+
+    /* Gagal tulis tercatat di penulis; fdatasync mengikuti KEUANGAN_FDATASYNC */
+    int ok = penulis_tutup(&out);
+    if (ok && !ganti_file(temp_name, filename)) ok = 0;
+    if (!ok) remove(temp_name);
+
+    return ok;
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+int urai_format_impor(const char *nama) {
+    if (!nama) return -1;
+
+    if (banding_string_tanpa_case(nama, "csv") == 0) return IMPOR_FORMAT_CSV;
+    if (banding_string_tanpa_case(nama, "tsv") == 0) return IMPOR_FORMAT_TSV;
+
+    return -1;
+}
+
+int impor_transaksi(FILE *in, int format, PelaporTolakImpor lapor, void *konteks, HasilImpor *hasil) {
+    if (!in || !hasil) return 0;
+
+    memset(hasil, 0, sizeof(HasilImpor));
+
+    FILE *staging = tmpfile();
+    if (!staging) return 0;
+
+    char line[MAX_BARIS_IMPOR];
+    char *kolom[MAX_KOLOM_IMPOR + 1];
+    char baris_file[MAX_LINE_LENGTH];
+    int nomor_id = ambil_nomor_id_terbesar();
+    int sudah_ada_data = 0;     /* Header hanya dikenali sebelum baris data pertama */
+    int ok = 1;
+
+    while (fgets(line, sizeof(line), in)) {
+        hasil->baris_dibaca++;
+        const char *pesan = NULL;
+
+        /* Baris kepanjangan: buang sisanya agar nomor baris tetap benar */
+        size_t len = strlen(line);
+        if (len > 0 && line[len - 1] != '\n' && !feof(in)) {
+            int c;
+            while ((c = fgetc(in)) != EOF && c != '\n') {}
+            pesan = "Baris terlalu panjang";
+        } else {
+            hapus_newline_string(line);
+            if (line[0] == '\0' || line[0] == '#') continue;
+
+            if (format == IMPOR_FORMAT_OTOMATIS) {
+                format = strchr(line, '\t') ? IMPOR_FORMAT_TSV : IMPOR_FORMAT_CSV;
+            }
+
+            int n = (format == IMPOR_FORMAT_TSV)
+                  ? pecah_tsv(line, kolom, MAX_KOLOM_IMPOR)
+                  : pecah_csv(line, kolom, MAX_KOLOM_IMPOR);
+
+            if (n < 0) {
+                pesan = "Tanda kutip tidak valid";
+            } else {
+                pangkas_string(kolom[0]);
+                if (!sudah_ada_data && banding_string_tanpa_case(kolom[0], "tanggal") == 0) {
+                    sudah_ada_data = 1;
+                    continue;
+                }
+                sudah_ada_data = 1;
+
+                Transaksi trx;
+                if (validasi_baris_impor(kolom, n, &trx, &pesan)) {
+                    if (!format_id_transaksi(++nomor_id, trx.id, sizeof(trx.id))) {
+                        /* Seluruh impor dibatalkan, bukan hanya baris ini */
+                        hasil->ditolak++;
+                        if (lapor) lapor(hasil->baris_dibaca, "Nomor ID transaksi sudah habis", konteks);
+                        ok = 0;
+                        break;
+                    }
+                    format_transaksi_ke_string(&trx, baris_file, sizeof(baris_file));
+                    if (fprintf(staging, "%s\n", baris_file) < 0) {
+                        ok = 0;
+                        break;
+                    }
+
+                    if (hasil->diterima == 0) {
+                        salin_string_aman(hasil->id_pertama, trx.id, sizeof(hasil->id_pertama));
+                    }
+                    salin_string_aman(hasil->id_terakhir, trx.id, sizeof(hasil->id_terakhir));
+                    hasil->bulan_terdampak[ekstrak_bulan(trx.tanggal)] = 1;
+                    hasil->diterima++;
+                    continue;
+                }
+            }
+        }
+
+        hasil->ditolak++;
+        if (lapor) lapor(hasil->baris_dibaca, pesan, konteks);
+    }
+
+    /* Satu commit di akhir: tidak ada perubahan jika staging atau penulisan gagal */
+    if (ok && hasil->diterima > 0) ok = commit_impor(staging);
+    fclose(staging);
+
+    if (!ok) {
+        hasil->diterima = 0;
+        memset(hasil->bulan_terdampak, 0, sizeof(hasil->bulan_terdampak));
+        return 0;
+    }
+
+    /* Pos dan analisis tiap bulan terdampak dihitung ulang sekali */
+    for (int bulan = 1; bulan <= 12; bulan++) {
+        if (!hasil->bulan_terdampak[bulan]) continue;
+        pekerja_kirim(PEKERJA_HITUNG_POS, bulan);
+        pekerja_kirim(PEKERJA_REFRESH_ANALISIS, bulan);
+    }
+
+    return 1;
+}
@@ -0,0 +1,316 @@
+/*
+ * =============================================================================
+ * File        : instrumen.c
+ * Deskripsi   : Implementasi modul instrumentasi (timer dan penghitung I/O)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan penyimpanan penghitung global dan daftar
+ * titik ukur. Titik ukur didaftarkan sekali saat pertama kali dipakai
+ * sehingga hanya fungsi yang pernah dipanggil yang muncul di laporan.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, stdlib.h, string.h : Untuk log, getenv, atexit, dan qsort
+ * - time.h      : Untuk clock_gettime dan cap waktu log
+ * - pthread.h   : Untuk mutex pendaftaran titik ukur
+ * - instrumen.h : Header file modul ini
+ *
+ * CATATAN:
+ * Semua pembaruan nilai memakai operasi atomik relaxed; thread UI dan thread
+ * pekerja dapat mencatat bersamaan tanpa mengunci. Mutex hanya dipakai saat
+ * titik ukur pertama kali didaftarkan.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "instrumen.h"
+
+/* ===== VARIABEL GLOBAL ===== */
+
+unsigned long long instrumen_penghitung[INS_JUMLAH_PENGHITUNG];
+unsigned long long instrumen_penghitung_aksi[INS_JUMLAH_AKSI][INS_JUMLAH_PENGHITUNG];
+__thread int instrumen_aksi_aktif = AKSI_TIDAK_ADA;
+
+/* ===== VARIABEL GLOBAL LOKAL ===== */
+
+static pthread_mutex_t kunci_daftar = PTHREAD_MUTEX_INITIALIZER;
+static TitikInstrumen *daftar_titik = NULL;
+static char path_log_keluar[256];
+
+static unsigned long long jumlah_aksi[INS_JUMLAH_AKSI];
+static unsigned long long byte_logis_aksi[INS_JUMLAH_AKSI];
+
+static const char *const NAMA_PENGHITUNG[INS_JUMLAH_PENGHITUNG] = {
+    "fopen", "rename", "byte_baca", "byte_tulis", "baris_diurai", "baris_diformat"
+};
+
+static const char *const NAMA_AKSI[INS_JUMLAH_AKSI] = {
+    "-", "tambah_transaksi", "ubah_transaksi", "hapus_transaksi",
+    "tambah_pos", "ubah_pos", "hapus_pos", "buka_layar"
+};
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Waktu monotonic dalam nanodetik
+ */
+static unsigned long long waktu_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+/**
+ * Helper: Memasukkan titik ke daftar global (sekali per titik)
+ */
+static void daftarkan_titik(TitikInstrumen *titik) {
+    pthread_mutex_lock(&kunci_daftar);
+    if (!titik->terdaftar) {
+        titik->berikut = daftar_titik;
+        daftar_titik = titik;
+        __atomic_store_n(&titik->terdaftar, 1, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&kunci_daftar);
+}
+
+/**
+ * Helper: Pembanding statistik untuk qsort (total waktu terbesar dulu)
+ */
+static int banding_total(const void *a, const void *b) {
+    const StatistikInstrumen *x = (const StatistikInstrumen *)a;
+    const StatistikInstrumen *y = (const StatistikInstrumen *)b;
+    return (x->total_ns < y->total_ns) - (x->total_ns > y->total_ns);
+}
+
+/**
+ * Helper: Dipanggil atexit untuk menulis log
+ */
+static void tulis_log_saat_keluar(void) {
+    if (path_log_keluar[0]) instrumen_tulis_log(path_log_keluar);
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+/**
+ * Memulai timer pada titik ukur
+ */
+PengukurInstrumen instrumen_mulai(TitikInstrumen *titik) {
+    if (!__atomic_load_n(&titik->terdaftar, __ATOMIC_ACQUIRE)) daftarkan_titik(titik);
+
+    PengukurInstrumen p = { titik, waktu_ns() };
+    return p;
+}
+
+/**
+ * Mencatat waktu pengukur yang selesai
+ */
+void instrumen_selesai(PengukurInstrumen *p) {
+    unsigned long long durasi = waktu_ns() - p->mulai_ns;
+    TitikInstrumen *t = p->titik;
+
+    __atomic_fetch_add(&t->panggilan, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&t->total_ns, durasi, __ATOMIC_RELAXED);
+
+    unsigned long long maks = __atomic_load_n(&t->maks_ns, __ATOMIC_RELAXED);
+    while (durasi > maks &&
+           !__atomic_compare_exchange_n(&t->maks_ns, &maks, durasi, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+}
+
+/**
+ * Memasang aksi pengguna pada thread saat ini
+ */
+int instrumen_aksi_masuk(int aksi) {
+    int sebelumnya = instrumen_aksi_aktif;
+    instrumen_aksi_aktif = (aksi > 0 && aksi < INS_JUMLAH_AKSI) ? aksi : AKSI_TIDAK_ADA;
+    return sebelumnya;
+}
+
+/**
+ * Memulihkan aksi sebelumnya saat keluar lingkup
+ */
+void instrumen_aksi_pulihkan(int *sebelumnya) {
+    instrumen_aksi_aktif = *sebelumnya;
+}
+
+/**
+ * Mengambil aksi yang terpasang pada thread saat ini
+ */
+int instrumen_aksi_sekarang(void) {
+    return instrumen_aksi_aktif;
+}
+
+/**
+ * Mencatat satu aksi berhasil
+ */
+void instrumen_aksi_selesai(int aksi, unsigned long long byte_logis) {
+    if (aksi <= 0 || aksi >= INS_JUMLAH_AKSI) return;
+    __atomic_fetch_add(&jumlah_aksi[aksi], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&byte_logis_aksi[aksi], byte_logis, __ATOMIC_RELAXED);
+}
+
+/**
+ * Mendapatkan nama aksi
+ */
+const char* instrumen_nama_aksi(int aksi) {
+    if (aksi < 0 || aksi >= INS_JUMLAH_AKSI) return "?";
+    return NAMA_AKSI[aksi];
+}
+
+/**
+ * Menyalin statistik aksi yang pernah terjadi
+ */
+int instrumen_ambil_statistik_aksi(StatistikAksi *hasil) {
+    if (!hasil) return 0;
+
+    int n = 0;
+    for (int a = 1; a < INS_JUMLAH_AKSI; a++) {
+        StatistikAksi *s = &hasil[n];
+        s->nama = NAMA_AKSI[a];
+        s->jumlah = __atomic_load_n(&jumlah_aksi[a], __ATOMIC_RELAXED);
+        s->byte_logis = __atomic_load_n(&byte_logis_aksi[a], __ATOMIC_RELAXED);
+
+        int ada_kerja = 0;
+        for (int i = 0; i < INS_JUMLAH_PENGHITUNG; i++) {
+            s->penghitung[i] = __atomic_load_n(&instrumen_penghitung_aksi[a][i], __ATOMIC_RELAXED);
+            if (s->penghitung[i]) ada_kerja = 1;
+        }
+        if (s->jumlah > 0 || ada_kerja) n++;
+    }
+    return n;
+}
+
+/**
+ * Menghitung byte fisik per byte logis
+ */
+double instrumen_amplifikasi_aksi(const StatistikAksi *stat, int hanya_tulis) {
+    if (!stat || stat->byte_logis == 0) return 0.0;
+
+    unsigned long long fisik = stat->penghitung[INS_BYTE_TULIS];
+    if (!hanya_tulis) fisik += stat->penghitung[INS_BYTE_BACA];
+    return (double)fisik / (double)stat->byte_logis;
+}
+
+/**
+ * Membaca nilai penghitung
+ */
+unsigned long long instrumen_ambil_penghitung(int penghitung) {
+    if (penghitung < 0 || penghitung >= INS_JUMLAH_PENGHITUNG) return 0;
+    return __atomic_load_n(&instrumen_penghitung[penghitung], __ATOMIC_RELAXED);
+}
+
+/**
+ * Mendapatkan nama penghitung
+ */
+const char* instrumen_nama_penghitung(int penghitung) {
+    if (penghitung < 0 || penghitung >= INS_JUMLAH_PENGHITUNG) return "?";
+    return NAMA_PENGHITUNG[penghitung];
+}
+
+/**
+ * Menyalin statistik semua titik ukur, urut total waktu terbesar
+ */
+int instrumen_ambil_statistik(StatistikInstrumen *hasil, int maks) {
+    if (!hasil || maks <= 0) return 0;
+
+    int n = 0;
+    pthread_mutex_lock(&kunci_daftar);
+    for (TitikInstrumen *t = daftar_titik; t && n < maks; t = t->berikut) {
+        hasil[n].nama = t->nama;
+        hasil[n].panggilan = __atomic_load_n(&t->panggilan, __ATOMIC_RELAXED);
+        hasil[n].total_ns = __atomic_load_n(&t->total_ns, __ATOMIC_RELAXED);
+        hasil[n].maks_ns = __atomic_load_n(&t->maks_ns, __ATOMIC_RELAXED);
+        if (hasil[n].panggilan > 0) n++;
+    }
+    pthread_mutex_unlock(&kunci_daftar);
+
+    qsort(hasil, n, sizeof(StatistikInstrumen), banding_total);
+    return n;
+}
+
+/**
+ * Mengosongkan semua penghitung dan timer
+ */
+void instrumen_reset(void) {
+    for (int i = 0; i < INS_JUMLAH_PENGHITUNG; i++) {
+        __atomic_store_n(&instrumen_penghitung[i], 0, __ATOMIC_RELAXED);
+    }
+    for (int a = 0; a < INS_JUMLAH_AKSI; a++) {
+        __atomic_store_n(&jumlah_aksi[a], 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&byte_logis_aksi[a], 0, __ATOMIC_RELAXED);
+        for (int i = 0; i < INS_JUMLAH_PENGHITUNG; i++) {
+            __atomic_store_n(&instrumen_penghitung_aksi[a][i], 0, __ATOMIC_RELAXED);
+        }
+    }
+
+    pthread_mutex_lock(&kunci_daftar);
+    for (TitikInstrumen *t = daftar_titik; t; t = t->berikut) {
+        __atomic_store_n(&t->panggilan, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&t->total_ns, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&t->maks_ns, 0, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&kunci_daftar);
+}
+
+/**
+ * Menambahkan dump statistik ke file log
+ */
+int instrumen_tulis_log(const char *path) {
+    if (!path) return 0;
+
+    FILE *fp = fopen(path, "a");
+    if (!fp) return 0;
+
+    char waktu[32];
+    time_t sekarang = time(NULL);
+    strftime(waktu, sizeof(waktu), "%Y-%m-%d %H:%M:%S", localtime(&sekarang));
+    fprintf(fp, "# keuangan diagnostik %s\n", waktu);
+
+    for (int i = 0; i < INS_JUMLAH_PENGHITUNG; i++) {
+        fprintf(fp, "%-32s %14llu\n", NAMA_PENGHITUNG[i], instrumen_ambil_penghitung(i));
+    }
+
+    StatistikInstrumen stat[128];
+    int n = instrumen_ambil_statistik(stat, 128);
+    fprintf(fp, "%-32s %10s %12s %12s %12s\n", "# fungsi", "panggilan", "total_ms", "rata_us", "maks_us");
+    for (int i = 0; i < n; i++) {
+        fprintf(fp, "%-32s %10llu %12.3f %12.1f %12.1f\n",
+                stat[i].nama, stat[i].panggilan,
+                stat[i].total_ns / 1e6,
+                stat[i].total_ns / 1e3 / stat[i].panggilan,
+                stat[i].maks_ns / 1e3);
+    }
+
+    StatistikAksi aksi[INS_JUMLAH_AKSI];
+    int n_aksi = instrumen_ambil_statistik_aksi(aksi);
+    fprintf(fp, "%-32s %10s %12s %12s %12s %10s %10s\n", "# aksi", "jumlah",
+            "byte_logis", "byte_baca", "byte_tulis", "amp_tulis", "amp_total");
+    for (int i = 0; i < n_aksi; i++) {
+        fprintf(fp, "%-32s %10llu %12llu %12llu %12llu %10.1f %10.1f\n",
+                aksi[i].nama, aksi[i].jumlah, aksi[i].byte_logis,
+                aksi[i].penghitung[INS_BYTE_BACA], aksi[i].penghitung[INS_BYTE_TULIS],
+                instrumen_amplifikasi_aksi(&aksi[i], 1),
+                instrumen_amplifikasi_aksi(&aksi[i], 0));
+    }
+    fputc('\n', fp);
+
+    return fclose(fp) == 0;
+}
+
+/**
+ * Memasang dump otomatis saat program keluar
+ */
+void instrumen_pasang_log_keluar(void) {
+    const char *path = getenv(ENV_LOG_INSTRUMEN);
+    if (!path || !path[0] || path_log_keluar[0]) return;
+
+    snprintf(path_log_keluar, sizeof(path_log_keluar), "%s", path);
+    atexit(tulis_log_saat_keluar);
+}
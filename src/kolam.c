@@ -0,0 +1,286 @@
+/*
+ * =============================================================================
+ * File        : kolam.c
+ * Deskripsi   : Implementasi modul kolam thread (thread pool) mesin
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan kolam thread fork-join dengan pencurian
+ * kerja. Setiap peserta (thread pemanggil = slot 0, thread kolam = slot
+ * 1..n-1) memegang rentang indeks tugas [awal, akhir). Pemilik mengambil
+ * dari depan; peserta yang kehabisan mencuri separuh belakang rentang
+ * peserta lain.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - pthread.h   : Untuk thread, mutex, dan condition variable
+ * - unistd.h    : Untuk sysconf (jumlah core)
+ * - kolam.h     : Header file modul ini
+ * - instrumen.h : Untuk atribusi aksi di thread kolam
+ *
+ * CATATAN:
+ * Semua tugas sudah dibagikan sebelum batch dimulai dan tidak ada tugas baru
+ * selama batch, sehingga peserta yang tidak menemukan tugas di mana pun boleh
+ * langsung berhenti. Urutan eksekusi tidak deterministik; pemanggil yang
+ * membutuhkan hasil deterministik menulis hasil per indeks lalu menggabung
+ * sesuai urutan indeks.
+ * =============================================================================
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+#include "kolam.h"
+#include "instrumen.h"
+
+/* ===== STRUKTUR DATA LOKAL ===== */
+
+/**
+ * Struct rentang tugas milik satu peserta.
+ * Dirata ke 64 byte agar kunci peserta berbeda tidak berbagi cache line.
+ */
+typedef struct {
+    pthread_mutex_t kunci;
+    int awal;                   /* Indeks tugas berikutnya untuk pemilik */
+    int akhir;                  /* Satu setelah indeks terakhir */
+} __attribute__((aligned(64))) AntrianTugas;
+
+/* ===== VARIABEL GLOBAL LOKAL ===== */
+
+static int thread_diminta = 0;                  /* 0 = otomatis */
+
+static pthread_mutex_t kunci_batch = PTHREAD_MUTEX_INITIALIZER;  /* Satu batch per waktu */
+static pthread_mutex_t kunci = PTHREAD_MUTEX_INITIALIZER;        /* State kolam di bawah */
+static pthread_cond_t cond_mulai = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t cond_selesai = PTHREAD_COND_INITIALIZER;
+
+static pthread_t thread_kolam[MAKS_THREAD_KOLAM];
+static int jumlah_peserta = 1;                  /* Thread kolam + pemanggil */
+static int diminta_berhenti = 0;
+static unsigned long generasi = 0;              /* Bertambah setiap batch */
+static unsigned long generasi_dibuat = 0;       /* Generasi saat thread kolam dibuat */
+static int peserta_berjalan = 0;                /* Thread kolam yang belum selesai batch */
+
+static AntrianTugas antrian[MAKS_THREAD_KOLAM];
+static int antrian_siap = 0;
+
+/* Batch yang sedang berjalan */
+static FungsiTugas fungsi_batch = NULL;
+static void *konteks_batch = NULL;
+static int aksi_batch = 0;
+
+static __thread int di_dalam_kolam = 0;         /* 1 selama thread mengerjakan tugas */
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Mengambil satu tugas dari depan rentang sendiri, -1 jika kosong
+ */
+static int ambil_tugas_sendiri(int slot) {
+    AntrianTugas *a = &antrian[slot];
+    int indeks = -1;
+
+    pthread_mutex_lock(&a->kunci);
+    if (a->awal < a->akhir) indeks = a->awal++;
+    pthread_mutex_unlock(&a->kunci);
+
+    return indeks;
+}
+
+/**
+ * Helper: Mencuri separuh belakang rentang peserta lain ke rentang sendiri.
+ * Mengembalikan 1 jika ada yang dicuri.
+ */
+static int curi_tugas(int slot) {
+    for (int langkah = 1; langkah < jumlah_peserta; langkah++) {
+        AntrianTugas *korban = &antrian[(slot + langkah) % jumlah_peserta];
+
+        pthread_mutex_lock(&korban->kunci);
+        int sisa = korban->akhir - korban->awal;
+        if (sisa <= 0) {
+            pthread_mutex_unlock(&korban->kunci);
+            continue;
+        }
+        int ambil = (sisa + 1) / 2;
+        int mulai = korban->akhir - ambil;
+        korban->akhir = mulai;
+        pthread_mutex_unlock(&korban->kunci);
+
+        AntrianTugas *a = &antrian[slot];
+        pthread_mutex_lock(&a->kunci);
+        a->awal = mulai;
+        a->akhir = mulai + ambil;
+        pthread_mutex_unlock(&a->kunci);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Helper: Mengerjakan tugas batch sampai tidak ada lagi tugas di semua peserta
+ */
+static void kerjakan_batch(int slot) {
+    INSTRUMEN_AKSI(aksi_batch);
+    di_dalam_kolam = 1;
+
+    while (1) {
+        int indeks = ambil_tugas_sendiri(slot);
+        if (indeks < 0) {
+            if (!curi_tugas(slot)) break;
+            continue;
+        }
+        fungsi_batch(konteks_batch, indeks);
+    }
+
+    di_dalam_kolam = 0;
+}
+
+/**
+ * Helper: Loop utama thread kolam
+ */
+static void *loop_kolam(void *arg) {
+    int slot = (int)(long)arg;
+    unsigned long terakhir = 0;
+
+    /* Bukan generasi saat ini: batch pertama bisa dimulai sebelum thread ini jalan */
+    pthread_mutex_lock(&kunci);
+    terakhir = generasi_dibuat;
+    while (1) {
+        while (generasi == terakhir && !diminta_berhenti) {
+            pthread_cond_wait(&cond_mulai, &kunci);
+        }
+        if (diminta_berhenti) break;
+        terakhir = generasi;
+        pthread_mutex_unlock(&kunci);
+
+        kerjakan_batch(slot);
+
+        pthread_mutex_lock(&kunci);
+        if (--peserta_berjalan == 0) pthread_cond_signal(&cond_selesai);
+    }
+    pthread_mutex_unlock(&kunci);
+
+    return NULL;
+}
+
+/**
+ * Helper: Menghentikan thread kolam (kunci_batch sudah dipegang)
+ */
+static void hentikan_thread(void) {
+    pthread_mutex_lock(&kunci);
+    diminta_berhenti = 1;
+    pthread_cond_broadcast(&cond_mulai);
+    pthread_mutex_unlock(&kunci);
+
+    for (int i = 1; i < jumlah_peserta; i++) {
+        pthread_join(thread_kolam[i], NULL);
+    }
+
+    jumlah_peserta = 1;
+    diminta_berhenti = 0;
+}
+
+/**
+ * Helper: Menyesuaikan jumlah thread kolam dengan pengaturan (kunci_batch sudah dipegang)
+ */
+static void siapkan_thread(int diinginkan) {
+    if (!antrian_siap) {
+        for (int i = 0; i < MAKS_THREAD_KOLAM; i++) {
+            pthread_mutex_init(&antrian[i].kunci, NULL);
+        }
+        antrian_siap = 1;
+    }
+    if (diinginkan == jumlah_peserta) return;
+    if (jumlah_peserta > 1) hentikan_thread();
+
+    /* Thread baru menunggu generasi setelah generasi saat ini */
+    pthread_mutex_lock(&kunci);
+    generasi_dibuat = generasi;
+    pthread_mutex_unlock(&kunci);
+    for (int i = 1; i < diinginkan; i++) {
+        if (pthread_create(&thread_kolam[i], NULL, loop_kolam, (void *)(long)i) != 0) break;
+        jumlah_peserta = i + 1;
+    }
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+/**
+ * Mengatur jumlah thread kerja paralel
+ */
+void kolam_atur_thread(int jumlah) {
+    if (jumlah < 0) jumlah = 0;
+    if (jumlah > MAKS_THREAD_KOLAM) jumlah = MAKS_THREAD_KOLAM;
+    thread_diminta = jumlah;
+}
+
+/**
+ * Jumlah thread kerja paralel yang berlaku
+ */
+int kolam_ambil_thread(void) {
+    if (thread_diminta > 0) return thread_diminta;
+
+    long core = sysconf(_SC_NPROCESSORS_ONLN);
+    if (core < 1) core = 1;
+    if (core > MAKS_THREAD_KOLAM) core = MAKS_THREAD_KOLAM;
+    return (int)core;
+}
+
+/**
+ * Menjalankan tugas 0..jumlah_tugas-1 di kolam dan menunggu semuanya
+ */
+int kolam_jalankan(FungsiTugas fungsi, void *konteks, int jumlah_tugas) {
+    if (fungsi == NULL || jumlah_tugas <= 0) return 0;
+
+    int diinginkan = kolam_ambil_thread();
+
+    /* Berurutan: satu thread, satu tugas, atau dipanggil dari dalam tugas kolam */
+    if (diinginkan < 2 || jumlah_tugas < 2 || di_dalam_kolam) {
+        for (int i = 0; i < jumlah_tugas; i++) fungsi(konteks, i);
+        return 1;
+    }
+
+    pthread_mutex_lock(&kunci_batch);
+    siapkan_thread(diinginkan);
+    int peserta = jumlah_peserta;
+
+    fungsi_batch = fungsi;
+    konteks_batch = konteks;
+    aksi_batch = instrumen_aksi_sekarang();
+
+    /* Bagikan rentang berurutan; pencurian meratakan beban yang timpang */
+    for (int i = 0; i < peserta; i++) {
+        antrian[i].awal = (int)((long long)jumlah_tugas * i / peserta);
+        antrian[i].akhir = (int)((long long)jumlah_tugas * (i + 1) / peserta);
+    }
+
+    pthread_mutex_lock(&kunci);
+    peserta_berjalan = peserta - 1;
+    generasi++;
+    pthread_cond_broadcast(&cond_mulai);
+    pthread_mutex_unlock(&kunci);
+
+    kerjakan_batch(0);
+
+    pthread_mutex_lock(&kunci);
+    while (peserta_berjalan > 0) {
+        pthread_cond_wait(&cond_selesai, &kunci);
+    }
+    pthread_mutex_unlock(&kunci);
+
+    fungsi_batch = NULL;
+    konteks_batch = NULL;
+    pthread_mutex_unlock(&kunci_batch);
+
+    return peserta;
+}
+
+/**
+ * Menghentikan thread kolam
+ */
+void kolam_hentikan(void) {
+    pthread_mutex_lock(&kunci_batch);
+    if (jumlah_peserta > 1) hentikan_thread();
+    pthread_mutex_unlock(&kunci_batch);
+}
@@ -0,0 +1,653 @@
+/*
+ * =============================================================================
+ * File        : layar_analisis.c
+ * Deskripsi   : Implementasi layar TUI analisis keuangan
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini berisi layar interaktif untuk analisis keuangan, termasuk:
+ * - Laporan keuangan bulanan, grafik sederhana, dan saran
+ * - Daftar transaksi terfilter per jenis
+ * - Menu ekspor data
+ * - Menu dan handler modul analisis
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, string.h : Untuk snprintf dan manipulasi string
+ * - layar_analisis.h : Header file modul ini
+ * - analisis.h  : Untuk perhitungan analisis
+ * - transaksi.h : Untuk data transaksi terfilter
+ * - file.h      : Untuk operasi file analisis
+ * - pos.h       : Untuk data pos anggaran
+ * - tui.h       : Untuk tampilan antarmuka pengguna
+ * - utils.h     : Untuk fungsi utilitas formatting
+ * - pekerja.h   : Untuk penyegaran analisis di latar belakang
+ * - ekspor.h    : Untuk ekspor transaksi, pos, dan analisis ke CSV/JSON
+ * - instrumen.h : Untuk akuntansi aksi buka layar
+ *
+ * CATATAN:
+ * Fungsi di modul ini dipindahkan dari analisis.c tanpa perubahan perilaku;
+ * analisis.c kini hanya berisi logika mesin yang ikut libkeuangan.a.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "layar_analisis.h"
+#include "analisis.h"
+#include "transaksi.h"
+#include "file.h"
+#include "pos.h"
+#include "tui.h"
+#include "utils.h"
+#include "pekerja.h"
+#include "ekspor.h"
+#include "instrumen.h"
+
+/* ===== KONSTANTA LOKAL ===== */
+/* Aksi Menu */
+#define ACT_LIHAT       1
+#define ACT_REFRESH     2
+#define ACT_GANTI_BULAN 3
+#define ACT_EKSPOR      4
+#define ACT_KEMBALI     0
+
+/* Pilihan Data Ekspor */
+#define EKSPOR_TRANSAKSI_BULAN  1
+#define EKSPOR_TRANSAKSI_SEMUA  2
+#define EKSPOR_POS_BULAN        3
+#define EKSPOR_ANALISIS_BULAN   4
+#define EKSPOR_ANALISIS_SEMUA   5
+
+/* ===== DEKLARASI FUNGSI LOKAL ===== */
+static void tampilkan_transaksi_filter(int filter_jenis);
+static int display_laporan_keuangan(int bulan, AnalisisKeuangan *analisis);
+static void tampilkan_menu_ekspor(int bulan);
+
+/* ===== IMPLEMENTASI TAMPILAN ANALISIS ===== */
+
+/**
+ * Tampilkan analisis keuangan lengkap untuk bulan
+ * I.S.: bulan valid
+ * F.S.: analisis ditampilkan di layar
+ */
+void tampilkan_analisis_bulan(int bulan) {
+    INSTRUMEN_AKSI(AKSI_BUKA_LAYAR);
+    AnalisisKeuangan analisis;
+
+    /* Hitung analisis */
+    if (!hitung_analisis_bulan(bulan, &analisis)) {
+        return;
+    }
+    INSTRUMEN_AKSI_SELESAI(AKSI_BUKA_LAYAR, 0);
+
+    while (1) {
+        int next_y = display_laporan_keuangan(bulan, &analisis);
+        (void)next_y; /* unused */
+
+        /* Menu Navigasi */
+        tui_gambar_garis_horizontal(tui_ambil_tinggi() - 7, 2, 60, '-');
+        tui_aktifkan_tebal();
+        tui_cetak(tui_ambil_tinggi() - 6, 2, "MENU NAVIGASI:");
+        tui_nonaktifkan_tebal();
+        tui_cetak(tui_ambil_tinggi() - 5, 4, "1. Tampilkan Semua Transaksi");
+        tui_cetak(tui_ambil_tinggi() - 4, 4, "2. Tampilkan Transaksi Pengeluaran");
+        tui_cetak(tui_ambil_tinggi() - 3, 4, "3. Tampilkan Transaksi Pemasukan");
+
+        tampilkan_footer("1-3: Pilih Menu | ESC: Kembali");
+        tui_segarkan();
+
+        int ch = tui_ambil_karakter();
+        switch (ch) {
+            case '1':
+                tampilkan_transaksi_filter(-1); /* Semua transaksi */
+                break;
+            case '2':
+                tampilkan_transaksi_filter(JENIS_PENGELUARAN);
+                break;
+            case '3':
+                tampilkan_transaksi_filter(JENIS_PEMASUKAN);
+                break;
+            case 27: /* ESC */
+                return;
+        }
+    }
+}
+
+/**
+ * Helper: Menampilkan laporan keuangan di layar
+ */
+static int display_laporan_keuangan(int bulan, AnalisisKeuangan *analisis) {
+    tui_hapus_layar();
+
+    int y = 1;
+    char title[64];
+
+    /* HEADER */
+    tui_aktifkan_tebal();
+    tui_aktifkan_warna(COLOR_PAIR_CYAN);
+    snprintf(title, sizeof(title), "# LAPORAN KEUANGAN BULAN %s", dapatkan_nama_bulan(bulan));
+    tui_cetak_tengah(y++, title);
+    tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
+    tui_nonaktifkan_tebal();
+
+    tui_gambar_garis_horizontal(y++, 2, 76, '=');
+    y++;
+
+    /* BAGIAN RINGKASAN */
+    tui_aktifkan_tebal();
+    tui_cetak(y++, 2, "RINGKASAN KEUANGAN:");
+    tui_nonaktifkan_tebal();
+
+    char buffer[64];
+
+    /* Total Pemasukan */
+    format_rupiah(analisis->total_pemasukan, buffer);
+    tui_cetakf(y, 4, "Total Pemasukan (%d Transaksi)  : ", analisis->total_trx_pemasukan);
+    tui_aktifkan_warna(COLOR_PAIR_GREEN);
+    tui_cetak(y++, 42, buffer);
+    tui_nonaktifkan_warna(COLOR_PAIR_GREEN);
+
+    /* Total Pengeluaran */
+    format_rupiah(analisis->total_pengeluaran, buffer);
+    tui_cetakf(y, 4, "Total Pengeluaran (%d Transaksi): ", analisis->total_trx_pengeluaran);
+    tui_aktifkan_warna(COLOR_PAIR_RED);
+    tui_cetak(y++, 42, buffer);
+    tui_nonaktifkan_warna(COLOR_PAIR_RED);
+
+    /* Saldo Akhir */
+    format_saldo(analisis->saldo_akhir, buffer);
+    tui_cetak(y, 4, "Saldo Akhir                     : ");
+    if (analisis->saldo_akhir < 0) {
+        tui_aktifkan_warna(COLOR_PAIR_RED);
+    } else {
+        tui_aktifkan_warna(COLOR_PAIR_GREEN);
+    }
+    tui_aktifkan_tebal();
+    tui_cetak(y++, 42, buffer);
+    tui_nonaktifkan_tebal();
+    tui_reset_atribut();
+
+    /* Rata-rata Pengeluaran */
+    format_rupiah((unsigned long long)analisis->rata_rata_pengeluaran, buffer);
+    tui_cetakf(y++, 4, "Rata-rata Pengeluaran           : %s", buffer);
+
+    y++;
+    tui_gambar_garis_horizontal(y++, 2, 76, '-');
+
+    /* TABEL POS ANGGARAN */
+    tui_aktifkan_tebal();
+    tui_cetak(y++, 2, "TABEL POS ANGGARAN:");
+    tui_nonaktifkan_tebal();
+
+    PosAnggaran pos_list[MAX_POS];
+    int pos_count = muat_pos_bulan(pos_list, MAX_POS, bulan);
+
+    if (pos_count > 0) {
+        /* Header tabel */
+        tui_aktifkan_tebal();
+        tui_aktifkan_warna(COLOR_PAIR_CYAN);
+        tui_cetakf(y++, 4, "%-15s %12s %12s %12s %5s %8s",
+                   "Kategori", "Anggaran", "Realisasi", "Sisa", "Trx", "Status");
+        tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
+        tui_nonaktifkan_tebal();
+        tui_gambar_garis_horizontal(y++, 4, 70, '-');
+
+        char anggaran_str[20], realisasi_str[20], sisa_str[20];
+        for (int i = 0; i < pos_count && y < tui_ambil_tinggi() - 10; i++) {
+            format_rupiah(pos_list[i].nominal, anggaran_str);
+            format_rupiah(pos_list[i].realisasi, realisasi_str);
+            format_saldo(pos_list[i].sisa, sisa_str);
+
+            const char *status_str = (pos_list[i].status == STATUS_AMAN) ? "AMAN" : "TIDAK AMAN";
+            int status_color = (pos_list[i].status == STATUS_AMAN) ? COLOR_PAIR_GREEN : COLOR_PAIR_RED;
+
+            tui_cetakf(y, 4, "%-15s %12s %12s %12s %5d ",
+                       pos_list[i].nama, anggaran_str, realisasi_str, sisa_str,
+                       pos_list[i].jumlah_transaksi);
+            tui_aktifkan_warna(status_color);
+            tui_cetak(y++, 68, status_str);
+            tui_nonaktifkan_warna(status_color);
+        }
+    } else {
+        tui_cetak(y++, 4, "(Tidak ada pos anggaran)");
+    }
+
+    y++;
+    tui_gambar_garis_horizontal(y++, 2, 76, '-');
+
+    /* KONDISI KEUANGAN */
+    tui_aktifkan_tebal();
+    tui_cetak(y, 2, "KONDISI KEUANGAN: ");
+    tui_nonaktifkan_tebal();
+
+    const char *kondisi_str;
+    int kondisi_color;
+    switch (analisis->kondisi_keuangan) {
+        case KONDISI_DEFISIT:
+            kondisi_str = "DEFISIT";
+            kondisi_color = COLOR_PAIR_RED;
+            break;
+        case KONDISI_SEIMBANG:
+            kondisi_str = "SEIMBANG";
+            kondisi_color = COLOR_PAIR_YELLOW;
+            break;
+        case KONDISI_SURPLUS:
+            kondisi_str = "SURPLUS";
+            kondisi_color = COLOR_PAIR_GREEN;
+            break;
+        default:
+            kondisi_str = "TIDAK DIKETAHUI";
+            kondisi_color = COLOR_PAIR_CYAN;
+    }
+
+    tui_aktifkan_warna(kondisi_color);
+    tui_aktifkan_tebal();
+    tui_cetakf(y, 20, "[%s]", kondisi_str);
+    tui_nonaktifkan_tebal();
+    tui_nonaktifkan_warna(kondisi_color);
+    tui_cetakf(y++, 32, " (%.2f%% sisa dari total pemasukan)", analisis->persentase_sisa);
+
+    y++;
+
+    /* KESIMPULAN */
+    tui_aktifkan_tebal();
+    tui_cetak(y, 2, "KESIMPULAN: ");
+    tui_nonaktifkan_tebal();
+
+    const char *kesimpulan_str;
+    int kesimpulan_color;
+    switch (analisis->kesimpulan) {
+        case KESIMPULAN_HEMAT:
+            kesimpulan_str = "Anda adalah mahasiswa yang hemat dan produktif.";
+            kesimpulan_color = COLOR_PAIR_GREEN;
+            break;
+        case KESIMPULAN_SEIMBANG:
+            kesimpulan_str = "Keuangan Anda seimbang, tetap waspada terhadap pengeluaran tidak perlu.";
+            kesimpulan_color = COLOR_PAIR_YELLOW;
+            break;
+        case KESIMPULAN_BOROS:
+            kesimpulan_str = "Anda mulai boros, perhatikan pengeluaran harian Anda.";
+            kesimpulan_color = COLOR_PAIR_YELLOW;
+            break;
+        case KESIMPULAN_TIDAK_SEHAT:
+            kesimpulan_str = "Kondisi keuangan tidak sehat. Kurangi pengeluaran dan cari pemasukan tambahan.";
+            kesimpulan_color = COLOR_PAIR_RED;
+            break;
+        default:
+            kesimpulan_str = "Status tidak diketahui.";
+            kesimpulan_color = COLOR_PAIR_CYAN;
+    }
+
+    tui_aktifkan_warna(kesimpulan_color);
+    tui_cetak(y++, 14, kesimpulan_str);
+    tui_nonaktifkan_warna(kesimpulan_color);
+
+    return y;
+}
+
+/**
+ * Helper: Tampilkan transaksi dari semua bulan dengan filter opsional
+ */
+static void tampilkan_transaksi_filter(int filter_jenis) {
+    tui_hapus_layar();
+
+    const char *title;
+    if (filter_jenis == JENIS_PENGELUARAN) {
+        title = "SEMUA TRANSAKSI PENGELUARAN (SEMUA BULAN)";
+    } else if (filter_jenis == JENIS_PEMASUKAN) {
+        title = "SEMUA TRANSAKSI PEMASUKAN (SEMUA BULAN)";
+    } else {
+        title = "SEMUA TRANSAKSI (SEMUA BULAN)";
+    }
+
+    tampilkan_header(title);
+
+    /* Muat semua transaksi tanpa batas jumlah */
+    ListTransaksi semua = {0};
+    if (!inisialisasi_list_transaksi(&semua, 64) || muat_transaksi_ke_list(&semua, 0) < 0) {
+        bebaskan_list_transaksi(&semua);
+        tampilkan_error("Gagal memuat transaksi");
+        return;
+    }
+
+    /* Filter di tempat jika diperlukan */
+    Transaksi *filtered = semua.data;
+    int count = 0;
+
+    for (int i = 0; i < semua.count; i++) {
+        if (filter_jenis < 0 || semua.data[i].jenis == filter_jenis) {
+            filtered[count++] = semua.data[i];
+        }
+    }
+
+    /* Tampilkan tabel */
+    int y = 4;
+    if (count == 0) {
+        tui_cetak(y, 4, "(Tidak ada transaksi)");
+        tampilkan_footer("Tekan sembarang tombol untuk kembali");
+        tui_segarkan();
+        tui_ambil_karakter();
+        bebaskan_list_transaksi(&semua);
+        return;
+    }
+
+    /* Gulir dengan tombol navigasi, tombol lain untuk kembali */
+    int selected = 0;
+    TableViewport view;
+    tabel_viewport_inisialisasi(&view, tabel_hitung_baris_muat(y, 4));
+
+    int gambar_penuh = 1;
+
+    while (1) {
+        if (gambar_penuh) {
+            tui_hapus_layar();
+            tampilkan_header(title);
+            tampilkan_footer("ATAS/BAWAH/PGUP/PGDN/HOME/END: Gulir | Tombol lain: Kembali");
+            tabel_viewport_invalidasi(&view);
+            gambar_penuh = 0;
+        }
+        tampilkan_tabel_transaksi(filtered, count, y, selected, &view);
+        tui_segarkan();
+
+        int ch = tui_ambil_karakter();
+        if (ch == KEY_RESIZE) {
+            tabel_viewport_inisialisasi(&view, tabel_hitung_baris_muat(y, 4));
+            gambar_penuh = 1;
+            continue;
+        }
+        if (!tabel_navigasi(ch, &selected, count, view.max_rows)) break;
+    }
+
+    bebaskan_list_transaksi(&semua);
+}
+
+/**
+ * Tampilkan ringkasan kondisi keuangan
+ */
+int tampilkan_ringkasan_kondisi(AnalisisKeuangan *analisis, int start_y) {
+    if (!analisis) return start_y;
+
+    int y = start_y;
+    char buffer[64];
+
+    /* Total Pemasukan */
+    format_rupiah(analisis->total_pemasukan, buffer);
+    tui_cetak(y, 2, "Total Pemasukan   : ");
+    tui_aktifkan_warna(COLOR_PAIR_GREEN);
+    tui_cetak(y++, 22, buffer);
+    tui_nonaktifkan_warna(COLOR_PAIR_GREEN);
+    tui_cetakf(y++, 4, "(%d transaksi)", analisis->total_trx_pemasukan);
+
+    /* Total Pengeluaran */
+    format_rupiah(analisis->total_pengeluaran, buffer);
+    tui_cetak(y, 2, "Total Pengeluaran : ");
+    tui_aktifkan_warna(COLOR_PAIR_RED);
+    tui_cetak(y++, 22, buffer);
+    tui_nonaktifkan_warna(COLOR_PAIR_RED);
+    tui_cetakf(y++, 4, "(%d transaksi)", analisis->total_trx_pengeluaran);
+
+    /* Rata-rata Pengeluaran */
+    if (analisis->total_trx_pengeluaran > 0) {
+        format_rupiah((unsigned long long)analisis->rata_rata_pengeluaran, buffer);
+        tui_cetakf(y++, 2, "Rata-rata/Transaksi: %s", buffer);
+    }
+
+    y++;
+    tui_gambar_garis_horizontal(y++, 2, 60, '-');
+
+    /* Saldo Akhir */
+    format_saldo(analisis->saldo_akhir, buffer);
+    tui_aktifkan_tebal();
+    tui_cetak(y, 2, "SALDO AKHIR       : ");
+    if (analisis->saldo_akhir < 0) {
+        tui_aktifkan_warna(COLOR_PAIR_RED);
+    } else {
+        tui_aktifkan_warna(COLOR_PAIR_GREEN);
+    }
+    tui_cetak(y++, 22, buffer);
+    tui_reset_atribut();
+
+    /* Persentase Sisa */
+    tui_cetakf(y++, 2, "Persentase Sisa   : %.2f%%", analisis->persentase_sisa);
+
+    y++;
+
+    /* Kondisi Keuangan */
+    tui_aktifkan_tebal();
+    tui_cetak(y, 2, "Kondisi Keuangan  : ");
+    int kondisi_color = (analisis->kondisi_keuangan == KONDISI_SURPLUS) ?
+                         COLOR_PAIR_GREEN :
+                         (analisis->kondisi_keuangan == KONDISI_DEFISIT) ?
+                         COLOR_PAIR_RED : COLOR_PAIR_YELLOW;
+    tui_aktifkan_warna(kondisi_color);
+    tui_cetak(y++, 22, get_label_kondisi(analisis->kondisi_keuangan));
+    tui_reset_atribut();
+
+    /* Kesimpulan */
+    tui_aktifkan_tebal();
+    tui_cetak(y, 2, "Kesimpulan        : ");
+    int kesimpulan_color = (analisis->kesimpulan == KESIMPULAN_HEMAT) ?
+                            COLOR_PAIR_GREEN :
+                            (analisis->kesimpulan == KESIMPULAN_TIDAK_SEHAT) ?
+                            COLOR_PAIR_RED : COLOR_PAIR_YELLOW;
+    tui_aktifkan_warna(kesimpulan_color);
+    tui_cetak(y++, 22, get_label_kesimpulan(analisis->kesimpulan));
+    tui_reset_atribut();
+
+    return y + 1;
+}
+
+/**
+ * Tampilkan grafik sederhana perbandingan pemasukan/pengeluaran
+ */
+int tampilkan_grafik_sederhana(AnalisisKeuangan *analisis, int start_y) {
+    if (!analisis) return start_y;
+
+    int y = start_y;
+
+    tui_gambar_garis_horizontal(y++, 2, 60, '-');
+    tui_aktifkan_tebal();
+    tui_cetak(y++, 2, "GRAFIK PERBANDINGAN:");
+    tui_nonaktifkan_tebal();
+    y++;
+
+    /* Hitung skala */
+    unsigned long long max_val = analisis->total_pemasukan;
+    if (analisis->total_pengeluaran > max_val) {
+        max_val = analisis->total_pengeluaran;
+    }
+
+    int max_bar = 40;  /* Panjang maksimal bar */
+
+    /* Bar Pemasukan */
+    int bar_masuk = 0;
+    if (max_val > 0) {
+        bar_masuk = (int)((double)analisis->total_pemasukan / max_val * max_bar);
+    }
+    tui_cetak(y, 2, "Pemasukan   [");
+    tui_isi_rentang_berwarna(y, 15, bar_masuk, '#', COLOR_PAIR_GREEN);
+    tui_cetak(y++, 15 + max_bar, "]");
+
+    /* Bar Pengeluaran */
+    int bar_keluar = 0;
+    if (max_val > 0) {
+        bar_keluar = (int)((double)analisis->total_pengeluaran / max_val * max_bar);
+    }
+    tui_cetak(y, 2, "Pengeluaran [");
+    tui_isi_rentang_berwarna(y, 15, bar_keluar, '#', COLOR_PAIR_RED);
+    tui_cetak(y++, 15 + max_bar, "]");
+
+    return y + 1;
+}
+
+/**
+ * Tampilkan saran berdasarkan kesimpulan
+ */
+int tampilkan_saran(int kesimpulan, int start_y) {
+    int y = start_y;
+
+    tui_gambar_garis_horizontal(y++, 2, 60, '-');
+    tui_aktifkan_tebal();
+    tui_cetak(y++, 2, "SARAN:");
+    tui_nonaktifkan_tebal();
+
+    const char *deskripsi = get_deskripsi_kesimpulan(kesimpulan);
+    tui_cetak(y++, 2, deskripsi);
+
+    y++;
+
+    /* Saran spesifik */
+    switch (kesimpulan) {
+        case KESIMPULAN_HEMAT:
+            tui_aktifkan_warna(COLOR_PAIR_GREEN);
+            tui_cetak(y++, 2, "* Pertahankan pola keuangan Anda!");
+            tui_cetak(y++, 2, "* Pertimbangkan untuk menabung atau investasi.");
+            tui_nonaktifkan_warna(COLOR_PAIR_GREEN);
+            break;
+
+        case KESIMPULAN_SEIMBANG:
+            tui_aktifkan_warna(COLOR_PAIR_YELLOW);
+            tui_cetak(y++, 2, "* Coba tingkatkan tabungan bulanan.");
+            tui_cetak(y++, 2, "* Tinjau kembali pengeluaran yang bisa dikurangi.");
+            tui_nonaktifkan_warna(COLOR_PAIR_YELLOW);
+            break;
+
+        case KESIMPULAN_BOROS:
+            tui_aktifkan_warna(COLOR_PAIR_YELLOW);
+            tui_cetak(y++, 2, "* Kurangi pengeluaran tidak penting.");
+            tui_cetak(y++, 2, "* Buat prioritas kebutuhan vs keinginan.");
+            tui_cetak(y++, 2, "* Evaluasi pos anggaran yang melebihi batas.");
+            tui_nonaktifkan_warna(COLOR_PAIR_YELLOW);
+            break;
+
+        case KESIMPULAN_TIDAK_SEHAT:
+            tui_aktifkan_warna(COLOR_PAIR_RED);
+            tui_cetak(y++, 2, "* PERINGATAN: Keuangan perlu perhatian serius!");
+            tui_cetak(y++, 2, "* Segera kurangi pengeluaran tidak penting.");
+            tui_cetak(y++, 2, "* Cari sumber pemasukan tambahan jika memungkinkan.");
+            tui_cetak(y++, 2, "* Hindari utang untuk pengeluaran konsumtif.");
+            tui_nonaktifkan_warna(COLOR_PAIR_RED);
+            break;
+    }
+
+    return y + 1;
+}
+
+/* ===== IMPLEMENTASI HANDLER ANALISIS ===== */
+
+/**
+ * Helper: Memilih data dan format ekspor, lalu menulis file ke direktori data
+ */
+static void tampilkan_menu_ekspor(int bulan) {
+    char title[64];
+    snprintf(title, sizeof(title), "Ekspor Data - %s", dapatkan_nama_bulan(bulan));
+
+    Menu menu;
+    menu_inisialisasi(&menu, title);
+    menu_tambah_item(&menu, "Transaksi Bulan Ini", EKSPOR_TRANSAKSI_BULAN);
+    menu_tambah_item(&menu, "Semua Transaksi", EKSPOR_TRANSAKSI_SEMUA);
+    menu_tambah_item(&menu, "Pos Anggaran Bulan Ini", EKSPOR_POS_BULAN);
+    menu_tambah_item(&menu, "Analisis Bulan Ini", EKSPOR_ANALISIS_BULAN);
+    menu_tambah_item(&menu, "Analisis Semua Bulan", EKSPOR_ANALISIS_SEMUA);
+
+    int pilihan = menu_navigasi(&menu);
+    if (pilihan == CANCEL || pilihan <= 0) return;
+
+    Menu menu_format;
+    menu_inisialisasi(&menu_format, "Format Ekspor");
+    menu_tambah_item(&menu_format, "CSV", EKSPOR_FORMAT_CSV);
+    menu_tambah_item(&menu_format, "JSON", EKSPOR_FORMAT_JSON);
+
+    int format = menu_navigasi(&menu_format);
+    if (format == CANCEL || format < 0) return;
+
+    /* Pilihan menu menentukan jenis data dan cakupan bulan */
+    int data = EKSPOR_DATA_TRANSAKSI;
+    int bulan_ekspor = bulan;
+    const char *nama_data = "transaksi";
+
+    if (pilihan == EKSPOR_TRANSAKSI_SEMUA || pilihan == EKSPOR_ANALISIS_SEMUA) {
+        bulan_ekspor = 0;
+    }
+    if (pilihan == EKSPOR_POS_BULAN) {
+        data = EKSPOR_DATA_POS;
+        nama_data = "pos";
+    } else if (pilihan == EKSPOR_ANALISIS_BULAN || pilihan == EKSPOR_ANALISIS_SEMUA) {
+        data = EKSPOR_DATA_ANALISIS;
+        nama_data = "analisis";
+    }
+
+    /* Nama file: data/ekspor_<data>_<MM|semua>.<ext> */
+    char path[MAX_PATH];
+    if (bulan_ekspor > 0) {
+        snprintf(path, sizeof(path), "%sekspor_%s_%02d.%s",
+                 DATA_DIR, nama_data, bulan_ekspor, dapatkan_ekstensi_ekspor(format));
+    } else {
+        snprintf(path, sizeof(path), "%sekspor_%s_semua.%s",
+                 DATA_DIR, nama_data, dapatkan_ekstensi_ekspor(format));
+    }
+
+    tampilkan_memuat("Mengekspor data...");
+    long jumlah = ekspor_ke_file(path, data, format, bulan_ekspor);
+
+    if (jumlah < 0) {
+        tampilkan_error("Gagal menulis %s", path);
+    } else {
+        tampilkan_sukses("%ld baris diekspor ke %s", jumlah, path);
+    }
+}
+
+/**
+ * Menampilkan menu analisis keuangan
+ */
+int menu_analisis_utama(int bulan) {
+    char title[64];
+    snprintf(title, sizeof(title), "Menu Analisis - %s", dapatkan_nama_bulan(bulan));
+
+    Menu menu;
+    menu_inisialisasi(&menu, title);
+
+    menu_tambah_item(&menu, "Lihat Analisis Keuangan", ACT_LIHAT);
+    menu_tambah_item(&menu, "Refresh Analisis", ACT_REFRESH);
+    menu_tambah_item(&menu, "Ekspor Data (CSV/JSON)", ACT_EKSPOR);
+
+    return menu_navigasi(&menu);
+}
+
+/**
+ * Jalankan modul analisis keuangan
+ */
+void jalankan_modul_analisis(int bulan_awal) {
+    int bulan = bulan_awal;
+
+    while (1) {
+        int action = menu_analisis_utama(bulan);
+
+        /* Analisis dihitung dari file; tunggu perhitungan latar belakang selesai */
+        tui_tunggu_pekerja(NULL);
+
+        switch (action) {
+            case ACT_LIHAT:
+                tampilkan_analisis_bulan(bulan);
+                break;
+
+            case ACT_REFRESH:
+                pekerja_kirim(PEKERJA_REFRESH_ANALISIS, bulan);
+                if (tui_tunggu_pekerja("Memperbarui analisis...")) {
+                    tampilkan_sukses("Analisis berhasil diperbarui");
+                }
+                break;
+
+            case ACT_EKSPOR:
+                tampilkan_menu_ekspor(bulan);
+                break;
+
+            case ACT_KEMBALI:
+            case CANCEL:
+                return;
+        }
+    }
+}
@@ -0,0 +1,618 @@
+/*
+ * =============================================================================
+ * File        : layar_pos.c
+ * Deskripsi   : Implementasi layar TUI pos anggaran
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini berisi layar interaktif untuk pos anggaran, termasuk:
+ * - Daftar pos dengan snapshot dan viewport tabel
+ * - Form tambah, edit, dan konfirmasi hapus pos
+ * - Pemilihan pos dan pemilihan bulan
+ * - Inisialisasi pos bulan baru (dengan konfirmasi salin dari bulan lalu)
+ * - Menu dan handler modul pos
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, string.h : Untuk snprintf dan manipulasi string
+ * - layar_pos.h : Header file modul ini
+ * - pos.h       : Untuk CRUD dan snapshot pos
+ * - file.h      : Untuk operasi file pos
+ * - tui.h       : Untuk tampilan antarmuka pengguna
+ * - utils.h     : Untuk fungsi utilitas string dan formatting
+ * - pekerja.h   : Untuk menunggu perhitungan latar belakang
+ * - instrumen.h : Untuk akuntansi aksi buka layar
+ *
+ * CATATAN:
+ * Fungsi di modul ini dipindahkan dari pos.c tanpa perubahan perilaku;
+ * pos.c kini hanya berisi logika mesin yang ikut libkeuangan.a.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "layar_pos.h"
+#include "pos.h"
+#include "file.h"
+#include "tui.h"
+#include "utils.h"
+#include "pekerja.h"
+#include "instrumen.h"
+
+/* ===== KONSTANTA LOKAL ===== */
+/* Aksi Menu */
+#define ACT_VIEW    1
+#define ACT_TAMBAH  2
+#define ACT_EDIT    3
+#define ACT_HAPUS   4
+#define ACT_BULAN   5
+#define ACT_KEMBALI 0
+
+/* Baris bawah yang dicadangkan di layar daftar (ringkasan + pesan + footer) */
+#define BARIS_CADANGAN_LIHAT 10
+
+/* ===== IMPLEMENTASI TAMPILAN POS ===== */
+
+int tampilkan_daftar_pos(int bulan, int selected, TableViewport *view) {
+    SnapshotPos snap;
+    if (!ambil_snapshot_pos(&snap, bulan)) return 6;
+    return tampilkan_daftar_snapshot_pos(&snap, selected, view);
+}
+
+int tampilkan_daftar_snapshot_pos(const SnapshotPos *snap, int selected, TableViewport *view) {
+    if (!snap) return 6;
+
+    /* Tampilkan header bulan; statis, hanya saat tabel digambar penuh */
+    if (!tabel_viewport_sudah_digambar(view)) {
+        char title[64];
+        snprintf(title, sizeof(title), "Pos Anggaran - %s", dapatkan_nama_bulan(snap->bulan));
+
+        tui_aktifkan_warna(COLOR_PAIR_CYAN);
+        tui_aktifkan_tebal();
+        tui_cetak(4, 2, title);
+        tui_nonaktifkan_tebal();
+        tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
+    }
+
+    return tampilkan_tabel_pos(snap->list, snap->count, 6, selected, view);
+}
+
+int tampilkan_detail_pos(PosAnggaran *pos, int start_y) {
+    if (!pos) return start_y;
+
+    int y = start_y;
+    char buffer[64];
+
+    tui_aktifkan_tebal();
+    tui_aktifkan_warna(COLOR_PAIR_CYAN);
+    tui_cetak(y++, 2, "Detail Pos Anggaran");
+    tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
+    tui_nonaktifkan_tebal();
+
+    tui_gambar_garis_horizontal(y++, 2, 50, '-');
+
+    tui_cetakf(y++, 2, "Nomor       : %d", pos->no);
+    tui_cetakf(y++, 2, "Nama        : %s", pos->nama);
+
+    format_rupiah(pos->nominal, buffer);
+    tui_cetakf(y++, 2, "Anggaran    : %s", buffer);
+
+    format_rupiah(pos->realisasi, buffer);
+    tui_cetakf(y++, 2, "Realisasi   : %s", buffer);
+
+    format_saldo(pos->sisa, buffer);
+    tui_cetak(y, 2, "Sisa        : ");
+    if (pos->sisa < 0) {
+        tui_aktifkan_warna(COLOR_PAIR_RED);
+    } else {
+        tui_aktifkan_warna(COLOR_PAIR_GREEN);
+    }
+    tui_cetak(y++, 16, buffer);
+    tui_nonaktifkan_warna(pos->sisa < 0 ? COLOR_PAIR_RED : COLOR_PAIR_GREEN);
+
+    tui_cetakf(y++, 2, "Transaksi   : %d", pos->jumlah_transaksi);
+
+    tui_cetak(y, 2, "Status      : ");
+    if (pos->status == STATUS_AMAN) {
+        tui_aktifkan_warna(COLOR_PAIR_GREEN);
+        tui_cetak(y++, 16, "AMAN");
+    } else {
+        tui_aktifkan_warna(COLOR_PAIR_RED);
+        tui_cetak(y++, 16, "TIDAK AMAN");
+    }
+    tui_reset_atribut();
+
+    return y + 1;
+}
+
+int tampilkan_ringkasan_pos(int bulan, int start_y) {
+    SnapshotPos snap;
+    if (!ambil_snapshot_pos(&snap, bulan)) return start_y;
+    return tampilkan_ringkasan_snapshot_pos(&snap, start_y);
+}
+
+int tampilkan_ringkasan_snapshot_pos(const SnapshotPos *snap, int start_y) {
+    if (!snap) return start_y;
+
+    int y = start_y;
+    char buffer[64];
+
+    unsigned long long total_anggaran = snap->total_anggaran;
+    unsigned long long total_realisasi = snap->total_realisasi;
+    long long total_sisa = (long long)total_anggaran - (long long)total_realisasi;
+
+    tui_gambar_garis_horizontal(y++, 2, 60, '=');
+
+    tui_aktifkan_tebal();
+    tui_cetak(y++, 2, "RINGKASAN:");
+    tui_nonaktifkan_tebal();
+
+    format_rupiah(total_anggaran, buffer);
+    tui_cetakf(y++, 2, "Total Anggaran  : %s", buffer);
+
+    format_rupiah(total_realisasi, buffer);
+    tui_cetakf(y++, 2, "Total Realisasi : %s", buffer);
+
+    format_saldo(total_sisa, buffer);
+    tui_cetak(y, 2, "Total Sisa      : ");
+    if (total_sisa < 0) {
+        tui_aktifkan_warna(COLOR_PAIR_RED);
+    } else {
+        tui_aktifkan_warna(COLOR_PAIR_GREEN);
+    }
+    tui_cetak(y++, 20, buffer);
+    tui_reset_atribut();
+
+    return y + 1;
+}
+
+int tampilkan_form_tambah_pos(int bulan) {
+    tui_hapus_layar();
+    tampilkan_header("TAMBAH POS ANGGARAN");
+
+    char nama[MAX_POS_LENGTH + 1];
+    unsigned long long nominal;
+
+    int y = 5;
+
+    char bulan_info[64];
+    snprintf(bulan_info, sizeof(bulan_info), "Bulan: %s", dapatkan_nama_bulan(bulan));
+    tui_cetak(y++, 2, bulan_info);
+    y++;
+
+    /* Input nama */
+    if (!masukan_string_wajib(y++, 2, "Nama Pos: ", nama, sizeof(nama))) {
+        return 0;
+    }
+
+    /* Input nominal */
+    if (!masukan_angka_min(y++, 2, "Anggaran: Rp ", &nominal, 1)) {
+        return 0;
+    }
+
+    /* Konfirmasi */
+    y++;
+    if (!masukan_konfirmasi(y, 2, "Simpan pos anggaran?")) {
+        tampilkan_info("Dibatalkan");
+        return 0;
+    }
+
+    /* Simpan */
+    char error_msg[100];
+    if (tambah_pos(nama, nominal, bulan, error_msg)) {
+        tampilkan_sukses("Pos anggaran berhasil ditambahkan");
+        return 1;
+    } else {
+        tampilkan_error("%s", error_msg);
+        return 0;
+    }
+}
+
+int tampilkan_form_edit_pos(int no, int bulan) {
+    PosAnggaran pos;
+    if (!ambil_pos_berdasarkan_nomor(no, bulan, &pos)) {
+        tampilkan_error("Pos tidak ditemukan");
+        return 0;
+    }
+
+    tui_hapus_layar();
+    tampilkan_header("EDIT POS ANGGARAN");
+
+    int y = 5;
+
+    /* Tampilkan data saat ini */
+    tui_cetak(y++, 2, "Data saat ini:");
+    tui_cetakf(y++, 2, "  Nama    : %s", pos.nama);
+    char nominal_str[30];
+    format_rupiah(pos.nominal, nominal_str);
+    tui_cetakf(y++, 2, "  Anggaran: %s", nominal_str);
+    y++;
+
+    tui_cetak(y++, 2, "Masukkan data baru (kosongkan jika tidak diubah):");
+    y++;
+
+    char nama_baru[MAX_POS_LENGTH + 1];
+    unsigned long long nominal_baru = 0;
+
+    /* Input nama baru */
+    if (!masukan_string(y++, 2, "Nama baru: ", nama_baru, sizeof(nama_baru))) {
+        return 0;
+    }
+
+    /* Input nominal baru */
+    char nominal_input[32];
+    if (!masukan_string(y++, 2, "Anggaran baru: Rp ", nominal_input, sizeof(nominal_input))) {
+        return 0;
+    }
+    if (strlen(nominal_input) > 0) {
+        urai_nominal(nominal_input, &nominal_baru);
+    }
+
+    /* Cek apakah ada perubahan */
+    if (strlen(nama_baru) == 0 && nominal_baru == 0) {
+        tampilkan_info("Tidak ada perubahan");
+        return 0;
+    }
+
+    /* Konfirmasi */
+    y++;
+    if (!masukan_konfirmasi(y, 2, "Simpan perubahan?")) {
+        tampilkan_info("Dibatalkan");
+        return 0;
+    }
+
+    /* Simpan */
+    char error_msg[100];
+    const char *nama_param = strlen(nama_baru) > 0 ? nama_baru : NULL;
+
+    if (ubah_pos(no, nama_param, nominal_baru, bulan, error_msg)) {
+        tampilkan_sukses("Pos anggaran berhasil diupdate");
+        return 1;
+    } else {
+        tampilkan_error("%s", error_msg);
+        return 0;
+    }
+}
+
+int tampilkan_konfirmasi_hapus_pos(int no, int bulan) {
+    PosAnggaran pos;
+    if (!ambil_pos_berdasarkan_nomor(no, bulan, &pos)) {
+        tampilkan_error("Pos tidak ditemukan");
+        return 0;
+    }
+
+    /* Cek apakah bisa dihapus */
+    if (pos.jumlah_transaksi > 0) {
+        tampilkan_error("Pos tidak bisa dihapus karena masih ada %d transaksi", pos.jumlah_transaksi);
+        return 0;
+    }
+
+    char msg[100];
+    snprintf(msg, sizeof(msg), "Hapus pos '%s'?", pos.nama);
+
+    if (!tampilkan_konfirmasi(msg)) {
+        tampilkan_info("Dibatalkan");
+        return 0;
+    }
+
+    char error_msg[100];
+    if (hapus_pos(no, bulan, error_msg)) {
+        tampilkan_sukses("Pos anggaran berhasil dihapus");
+        return 1;
+    } else {
+        tampilkan_error("%s", error_msg);
+        return 0;
+    }
+}
+
+int tampilkan_pilih_pos(int bulan, char *result) {
+    if (!result) return 0;
+
+    PosAnggaran list[MAX_POS];
+    int count = ambil_daftar_pos(list, MAX_POS, bulan);
+
+    if (count == 0) {
+        tampilkan_peringatan("Belum ada pos anggaran untuk bulan ini");
+        return 0;
+    }
+
+    Menu menu;
+    menu_inisialisasi(&menu, "Pilih Pos Anggaran");
+
+    for (int i = 0; i < count; i++) {
+        menu_tambah_item(&menu, list[i].nama, i + 1);
+    }
+
+    int pilihan = menu_navigasi(&menu);
+
+    if (pilihan == CANCEL || pilihan <= 0) {
+        return 0;
+    }
+
+    salin_string_aman(result, list[pilihan - 1].nama, MAX_POS_LENGTH + 1);
+    return 1;
+}
+
+/* ===== IMPLEMENTASI HANDLER POS ===== */
+
+/**
+ * Jalankan modul pos anggaran
+ */
+void jalankan_modul_pos(int bulan_awal) {
+    int bulan = bulan_awal;
+
+    /* Inisialisasi pos untuk bulan jika belum ada */
+    tui_tunggu_pekerja(NULL);
+    inisialisasi_pos_untuk_bulan(bulan);
+
+    while (1) {
+        /* Sinkronisasi kalkulasi di latar belakang selama menu ditampilkan */
+        pekerja_kirim(PEKERJA_HITUNG_POS, bulan);
+
+        int action = menu_pos_utama(bulan);
+
+        /* Layar berikutnya membaca file pos; tunggu sinkronisasi selesai */
+        tui_tunggu_pekerja(NULL);
+
+        switch (action) {
+            case ACT_VIEW:
+                penanganan_lihat_pos(bulan);
+                break;
+
+            case ACT_TAMBAH:
+                penanganan_tambah_pos(bulan);
+                break;
+
+            case ACT_EDIT:
+                penanganan_ubah_pos(bulan);
+                break;
+
+            case ACT_HAPUS:
+                penanganan_hapus_pos(bulan);
+                break;
+
+            case ACT_KEMBALI:
+            case CANCEL:
+                return;
+        }
+    }
+}
+
+/**
+ * Inisialisasi data pos untuk bulan baru
+ */
+int inisialisasi_pos_untuk_bulan(int bulan) {
+    INSTRUMEN_FUNGSI();
+    if (bulan < 1 || bulan > 12) return 0;
+
+    /* Cek apakah sudah ada file */
+    if (cek_file_pos_ada(bulan)) {
+        return 1;  /* Sudah ada */
+    }
+
+    /* Cek bulan sebelumnya */
+    int bulan_sebelum = (bulan == 1) ? 12 : bulan - 1;
+
+    if (cek_file_pos_ada(bulan_sebelum)) {
+        /* Tanyakan apakah mau copy dari bulan sebelumnya */
+        char msg[100];
+        snprintf(msg, sizeof(msg),
+                 "Copy pos dari %s ke %s?",
+                 dapatkan_nama_bulan(bulan_sebelum),
+                 dapatkan_nama_bulan(bulan));
+
+        if (tampilkan_konfirmasi(msg)) {
+            if (salin_pos_dari_bulan(bulan, bulan_sebelum)) {
+                tampilkan_sukses("Pos berhasil dicopy");
+                return 1;
+            } else {
+                tampilkan_error("Gagal copy pos");
+            }
+        }
+    }
+
+    /* Buat file pos kosong */
+    return inisialisasi_pos_bulan(bulan);
+}
+
+/**
+ * Menampilkan menu utama pos anggaran
+ */
+int menu_pos_utama(int bulan) {
+    char title[64];
+    snprintf(title, sizeof(title), "Menu Pos Anggaran - %s", dapatkan_nama_bulan(bulan));
+
+    Menu menu;
+    menu_inisialisasi(&menu, title);
+
+    menu_tambah_item(&menu, "Lihat Daftar Pos", ACT_VIEW);
+    menu_tambah_item(&menu, "Tambah Pos Baru", ACT_TAMBAH);
+    menu_tambah_item(&menu, "Edit Pos", ACT_EDIT);
+    menu_tambah_item(&menu, "Hapus Pos", ACT_HAPUS);
+
+    return menu_navigasi(&menu);
+}
+
+/**
+ * Menampilkan menu pilih bulan
+ */
+int menu_pilih_bulan(int bulan_saat_ini) {
+    Menu menu;
+    menu_inisialisasi(&menu, "Pilih Bulan");
+
+    for (int i = 1; i <= 12; i++) {
+        char item[32];
+        if (i == bulan_saat_ini) {
+            snprintf(item, sizeof(item), "%s (aktif)", dapatkan_nama_bulan(i));
+        } else {
+            snprintf(item, sizeof(item), "%s", dapatkan_nama_bulan(i));
+        }
+        menu_tambah_item(&menu, item, i);
+    }
+
+    int pilihan = menu_navigasi(&menu);
+
+    if (pilihan == CANCEL) {
+        return bulan_saat_ini;  /* Tetap di bulan sekarang */
+    }
+
+    return pilihan;
+}
+
+/**
+ * Handler untuk view daftar pos dengan navigasi
+ */
+void penanganan_lihat_pos(int bulan) {
+    INSTRUMEN_AKSI(AKSI_BUKA_LAYAR);
+    int selected = 0;
+
+    /* Satu snapshot per layar; navigasi tidak membaca file lagi */
+    SnapshotPos snap;
+    if (!ambil_snapshot_pos(&snap, bulan)) {
+        tampilkan_error("Gagal memuat daftar pos");
+        return;
+    }
+    INSTRUMEN_AKSI_SELESAI(AKSI_BUKA_LAYAR, 0);
+
+    /* Sisakan ruang untuk ringkasan (6 baris) dan area pesan/footer */
+    TableViewport view;
+    tabel_viewport_inisialisasi(&view, tabel_hitung_baris_muat(6, BARIS_CADANGAN_LIHAT));
+
+    int gambar_penuh = 1;
+
+    while (1) {
+        int count = snap.count;
+
+        if (gambar_penuh) {
+            tui_hapus_layar();
+            tampilkan_header("DAFTAR POS ANGGARAN");
+            tabel_viewport_invalidasi(&view);
+        }
+
+        /* Setelah gambar penuh, tabel hanya memperbarui baris yang berubah */
+        int next_y = tampilkan_daftar_snapshot_pos(&snap, selected, &view);
+
+        if (gambar_penuh) {
+            tampilkan_ringkasan_snapshot_pos(&snap, next_y);
+            tampilkan_footer("Panah/PgUp/PgDn/Home/End | ENTER: Detail | R: Muat Ulang | ESC: Kembali");
+            gambar_penuh = 0;
+        }
+        tui_segarkan();
+
+        int ch = tui_ambil_karakter();
+
+        if (tabel_navigasi(ch, &selected, count, view.max_rows)) continue;
+
+        /* Aksi selain navigasi mengganti isi layar */
+        gambar_penuh = 1;
+
+        switch (ch) {
+            case KEY_ENTER:
+            case '\n':
+            case '\r':
+                if (count > 0) {
+                    tui_hapus_layar();
+                    tampilkan_header("DETAIL POS ANGGARAN");
+                    tampilkan_detail_pos(&snap.list[selected], 5);
+                    tampilkan_footer("Tekan sembarang tombol untuk kembali");
+                    tui_segarkan();
+                    tui_ambil_karakter();
+                }
+                break;
+
+            case 'r':
+            case 'R':
+                /* Muat ulang eksplisit dari file */
+                if (!ambil_snapshot_pos(&snap, bulan)) {
+                    tampilkan_error("Gagal memuat daftar pos");
+                    return;
+                }
+                if (selected >= snap.count) selected = snap.count - 1;
+                if (selected < 0) selected = 0;
+                break;
+
+            case KEY_RESIZE:
+                tabel_viewport_inisialisasi(&view, tabel_hitung_baris_muat(6, BARIS_CADANGAN_LIHAT));
+                break;
+
+            case 27:  /* ESC */
+                return;
+        }
+    }
+}
+
+/**
+ * Handler untuk tambah pos baru
+ */
+void penanganan_tambah_pos(int bulan) {
+    tampilkan_form_tambah_pos(bulan);
+}
+
+/**
+ * Handler untuk edit pos
+ */
+void penanganan_ubah_pos(int bulan) {
+    PosAnggaran list[MAX_POS];
+    int count = ambil_daftar_pos(list, MAX_POS, bulan);
+
+    if (count == 0) {
+        tampilkan_peringatan("Belum ada pos anggaran");
+        return;
+    }
+
+    /* Pilih pos untuk diedit */
+    Menu menu;
+    menu_inisialisasi(&menu, "Pilih Pos untuk Diedit");
+
+    for (int i = 0; i < count; i++) {
+        char item[64];
+        snprintf(item, sizeof(item), "%d. %s", list[i].no, list[i].nama);
+        menu_tambah_item(&menu, item, list[i].no);
+    }
+
+    int pilihan = menu_navigasi(&menu);
+
+    if (pilihan == CANCEL || pilihan <= 0) {
+        return;
+    }
+
+    tampilkan_form_edit_pos(pilihan, bulan);
+}
+
+/**
+ * Handler untuk hapus pos
+ */
+void penanganan_hapus_pos(int bulan) {
+    PosAnggaran list[MAX_POS];
+    int count = ambil_daftar_pos(list, MAX_POS, bulan);
+
+    if (count == 0) {
+        tampilkan_peringatan("Belum ada pos anggaran");
+        return;
+    }
+
+    /* Pilih pos untuk dihapus */
+    Menu menu;
+    menu_inisialisasi(&menu, "Pilih Pos untuk Dihapus");
+
+    for (int i = 0; i < count; i++) {
+        char item[64];
+        if (list[i].jumlah_transaksi > 0) {
+            snprintf(item, sizeof(item), "%d. %s (ada %d transaksi)",
+                     list[i].no, list[i].nama, list[i].jumlah_transaksi);
+        } else {
+            snprintf(item, sizeof(item), "%d. %s", list[i].no, list[i].nama);
+        }
+        menu_tambah_item(&menu, item, list[i].no);
+    }
+
+    int pilihan = menu_navigasi(&menu);
+
+    if (pilihan == CANCEL || pilihan <= 0) {
+        return;
+    }
+
+    tampilkan_konfirmasi_hapus_pos(pilihan, bulan);
+}
@@ -0,0 +1,643 @@
+/*
+ * =============================================================================
+ * File        : layar_transaksi.c
+ * Deskripsi   : Implementasi layar TUI transaksi keuangan
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini berisi layar interaktif untuk transaksi keuangan, termasuk:
+ * - Daftar transaksi dengan snapshot dan viewport tabel
+ * - Form tambah dan edit transaksi
+ * - Konfirmasi hapus transaksi
+ * - Menu dan handler modul transaksi
+ * - Merapikan file transaksi (baris rusak dipindah ke file .rusak)
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, string.h : Untuk snprintf dan manipulasi string
+ * - layar_transaksi.h : Header file modul ini
+ * - transaksi.h : Untuk CRUD dan snapshot transaksi
+ * - file.h      : Untuk label jenis transaksi dan kompaksi file transaksi
+ * - pos.h       : Untuk daftar dan pemilihan pos
+ * - layar_pos.h : Untuk tampilkan_pilih_pos
+ * - tui.h       : Untuk tampilan antarmuka pengguna
+ * - utils.h     : Untuk fungsi utilitas string dan formatting
+ * - instrumen.h : Untuk akuntansi aksi buka layar
+ *
+ * CATATAN:
+ * Fungsi di modul ini dipindahkan dari transaksi.c tanpa perubahan perilaku;
+ * transaksi.c kini hanya berisi logika mesin yang ikut libkeuangan.a.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "layar_transaksi.h"
+#include "transaksi.h"
+#include "file.h"
+#include "pos.h"
+#include "layar_pos.h"
+#include "tui.h"
+#include "utils.h"
+#include "instrumen.h"
+
+/* ===== KONSTANTA LOKAL ===== */
+/* Aksi Menu */
+#define ACT_VIEW    1
+#define ACT_TAMBAH  2
+#define ACT_EDIT    3
+#define ACT_HAPUS   4
+#define ACT_RAPIKAN 5
+#define ACT_KEMBALI 0
+
+/* Baris bawah yang dicadangkan di layar daftar (ringkasan + pesan + footer) */
+#define BARIS_CADANGAN_LIHAT 10
+
+/* ===== IMPLEMENTASI TAMPILAN TRANSAKSI ===== */
+
+int tampilkan_daftar_transaksi(int bulan, int selected, TableViewport *view) {
+    SnapshotTransaksi snap;
+    if (!ambil_snapshot_transaksi(&snap, bulan)) return 6;
+
+    int next_y = tampilkan_daftar_snapshot_transaksi(&snap, selected, view);
+    bebaskan_snapshot_transaksi(&snap);
+    return next_y;
+}
+
+int tampilkan_daftar_snapshot_transaksi(const SnapshotTransaksi *snap, int selected, TableViewport *view) {
+    if (!snap) return 6;
+
+    /* Judul statis hanya digambar saat tabel digambar penuh */
+    if (!tabel_viewport_sudah_digambar(view)) {
+        char title[64];
+        snprintf(title, sizeof(title), "Transaksi - %s", dapatkan_nama_bulan(snap->bulan));
+
+        tui_aktifkan_warna(COLOR_PAIR_CYAN);
+        tui_aktifkan_tebal();
+        tui_cetak(4, 2, title);
+        tui_nonaktifkan_tebal();
+        tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
+    }
+
+    return tampilkan_tabel_transaksi(snap->list.data, snap->list.count, 6, selected, view);
+}
+
+int tampilkan_detail_transaksi(Transaksi *trx, int start_y) {
+    if (!trx) return start_y;
+
+    int y = start_y;
+    char buffer[64];
+
+    tui_aktifkan_tebal();
+    tui_aktifkan_warna(COLOR_PAIR_CYAN);
+    tui_cetak(y++, 2, "Detail Transaksi");
+    tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
+    tui_nonaktifkan_tebal();
+
+    tui_gambar_garis_horizontal(y++, 2, 50, '-');
+
+    tui_cetakf(y++, 2, "ID          : %s", trx->id);
+    tui_cetakf(y++, 2, "Tanggal     : %s", trx->tanggal);
+
+    tui_cetak(y, 2, "Jenis       : ");
+    if (trx->jenis == JENIS_PENGELUARAN) {
+        tui_aktifkan_warna(COLOR_PAIR_RED);
+        tui_cetak(y++, 16, "Pengeluaran");
+    } else {
+        tui_aktifkan_warna(COLOR_PAIR_GREEN);
+        tui_cetak(y++, 16, "Pemasukan");
+    }
+    tui_reset_atribut();
+
+    tui_cetakf(y++, 2, "Pos         : %s", trx->pos);
+
+    format_rupiah(trx->nominal, buffer);
+    tui_cetakf(y++, 2, "Nominal     : %s", buffer);
+
+    tui_cetakf(y++, 2, "Deskripsi   : %s",
+               strlen(trx->deskripsi) > 0 ? trx->deskripsi : "-");
+
+    return y + 1;
+}
+
+int tampilkan_ringkasan_transaksi(int bulan, int start_y) {
+    SnapshotTransaksi snap;
+    if (!ambil_snapshot_transaksi(&snap, bulan)) return start_y;
+
+    int next_y = tampilkan_ringkasan_snapshot_transaksi(&snap, start_y);
+    bebaskan_snapshot_transaksi(&snap);
+    return next_y;
+}
+
+int tampilkan_ringkasan_snapshot_transaksi(const SnapshotTransaksi *snap, int start_y) {
+    if (!snap) return start_y;
+
+    int y = start_y;
+    char buffer[64];
+
+    unsigned long long pemasukan = snap->total_pemasukan;
+    unsigned long long pengeluaran = snap->total_pengeluaran;
+    long long saldo = (long long)pemasukan - (long long)pengeluaran;
+
+    tui_gambar_garis_horizontal(y++, 2, 60, '=');
+
+    tui_aktifkan_tebal();
+    tui_cetak(y++, 2, "RINGKASAN:");
+    tui_nonaktifkan_tebal();
+
+    format_rupiah(pemasukan, buffer);
+    tui_cetakf(y++, 2, "Total Pemasukan   : %s (%d transaksi)", buffer, snap->jumlah_pemasukan);
+
+    format_rupiah(pengeluaran, buffer);
+    tui_cetakf(y++, 2, "Total Pengeluaran : %s (%d transaksi)", buffer, snap->jumlah_pengeluaran);
+
+    format_saldo(saldo, buffer);
+    tui_cetak(y, 2, "Saldo             : ");
+    if (saldo < 0) {
+        tui_aktifkan_warna(COLOR_PAIR_RED);
+    } else {
+        tui_aktifkan_warna(COLOR_PAIR_GREEN);
+    }
+    tui_cetak(y++, 22, buffer);
+    tui_reset_atribut();
+
+    return y + 1;
+}
+
+int tampilkan_form_tambah_transaksi(int bulan) {
+    tui_hapus_layar();
+    tampilkan_header("TAMBAH TRANSAKSI");
+
+    int y = 5;
+    char tanggal[12], pos[MAX_POS_LENGTH + 1], deskripsi[MAX_DESKRIPSI_LENGTH + 1];
+    unsigned long long nominal;
+    int jenis;
+
+    /* Info bulan */
+    char bulan_info[64];
+    snprintf(bulan_info, sizeof(bulan_info), "Bulan: %s", dapatkan_nama_bulan(bulan));
+    tui_cetak(y++, 2, bulan_info);
+    y++;
+
+    /* Input tanggal dengan validasi bulan */
+    while (1) {
+        if (!masukan_tanggal(y, 2, "Tanggal", tanggal)) {
+            return 0;
+        }
+        /* Validasi bulan sesuai */
+        if (!validasi_bulan_sesuai(tanggal, bulan)) {
+            char error_msg[128];
+            snprintf(error_msg, sizeof(error_msg),
+                     "Anda memasukkan %s yang berbeda dari bulan terpilih! Input tidak valid!",
+                     tanggal);
+            tampilkan_error(error_msg);
+            /* Gambar ulang form */
+            tui_hapus_layar();
+            tampilkan_header("TAMBAH TRANSAKSI");
+            y = 5;
+            tui_cetak(y++, 2, bulan_info);
+            y++;
+            continue;
+        }
+        y++;
+        break;
+    }
+
+    /* Input jenis */
+    if (!masukan_jenis_transaksi(y++, 2, &jenis)) {
+        return 0;
+    }
+    y++;
+
+    /* Pilih pos (otomatis untuk Pemasukan) */
+    if (jenis == JENIS_PENGELUARAN) {
+        tui_cetak(y++, 2, "Pilih Pos Anggaran:");
+        if (!tampilkan_pilih_pos(bulan, pos)) {
+            tampilkan_peringatan("Pos anggaran harus dipilih");
+            return 0;
+        }
+    } else {
+        /* Untuk pemasukan, pos otomatis "Pemasukan" */
+        strcpy(pos, "Pemasukan");
+    }
+
+    /* Kembali ke form */
+    tui_hapus_layar();
+    tampilkan_header("TAMBAH TRANSAKSI");
+    y = 5;
+    tui_cetakf(y++, 2, "Tanggal : %s", tanggal);
+    tui_cetakf(y++, 2, "Jenis   : %s", dapatkan_label_jenis(jenis));
+    if (jenis == JENIS_PENGELUARAN) {
+        tui_cetakf(y++, 2, "Pos     : %s", pos);
+    } else {
+        tui_cetakf(y++, 2, "Pos     : %s (Otomatis)", pos);
+    }
+    y++;
+
+    /* Input nominal */
+    if (!masukan_angka_min(y++, 2, "Nominal: Rp ", &nominal, 1)) {
+        return 0;
+    }
+
+    /* Input deskripsi (opsional) */
+    if (!masukan_string(y++, 2, "Deskripsi (opsional): ", deskripsi, sizeof(deskripsi))) {
+        return 0;
+    }
+
+    /* Konfirmasi */
+    y++;
+    if (!masukan_konfirmasi(y, 2, "Simpan transaksi?")) {
+        tampilkan_info("Dibatalkan");
+        return 0;
+    }
+
+    /* Simpan */
+    char error_msg[100];
+    if (tambah_transaksi(tanggal, jenis, pos, nominal, deskripsi, error_msg)) {
+        tampilkan_sukses("Transaksi berhasil ditambahkan");
+        return 1;
+    } else {
+        tampilkan_error("%s", error_msg);
+        return 0;
+    }
+}
+
+int tampilkan_form_edit_transaksi(const char *id) {
+    Transaksi trx;
+    if (!ambil_transaksi_berdasarkan_id(id, &trx)) {
+        tampilkan_error("Transaksi tidak ditemukan");
+        return 0;
+    }
+
+    /* Ambil bulan dari transaksi yang ada untuk validasi */
+    int bulan_trx = ekstrak_bulan(trx.tanggal);
+
+    char tanggal_baru[12], deskripsi_baru[MAX_DESKRIPSI_LENGTH + 1], nominal_input[32];
+    unsigned long long nominal_baru = 0;
+
+    while (1) {
+        tui_hapus_layar();
+        tampilkan_header("EDIT TRANSAKSI");
+
+        int y = 5;
+        char nominal_str[64];
+        format_rupiah(trx.nominal, nominal_str);
+
+        /* Tampilkan data saat ini */
+        tui_cetak(y++, 2, "Data saat ini:");
+        tui_cetakf(y++, 2, "  ID        : %s", trx.id);
+        tui_cetakf(y++, 2, "  Tanggal   : %s", trx.tanggal);
+        tui_cetakf(y++, 2, "  Jenis     : %s", dapatkan_label_jenis(trx.jenis));
+        tui_cetakf(y++, 2, "  Pos       : %s", trx.pos);
+        tui_cetakf(y++, 2, "  Nominal   : %s", nominal_str);
+        tui_cetakf(y++, 2, "  Deskripsi : %s", trx.deskripsi);
+        y++;
+
+        tui_cetak(y++, 2, "Masukkan data baru (kosongkan jika tidak diubah):");
+        y++;
+
+        /* Input tanggal baru dengan validasi langsung */
+        if (!masukan_string(y++, 2, "Tanggal baru (dd-mm-YYYY): ", tanggal_baru, sizeof(tanggal_baru))) {
+            return 0;
+        }
+
+        /* Validasi langsung setelah input tanggal */
+        if (strlen(tanggal_baru) > 0) {
+            if (!validasi_tanggal_lengkap(tanggal_baru)) {
+                tampilkan_error("Format tanggal tidak valid! Gunakan format dd-mm-YYYY");
+                continue;
+            }
+            /* Validasi bulan sesuai dengan transaksi asli */
+            if (!validasi_bulan_sesuai(tanggal_baru, bulan_trx)) {
+                char error_msg[128];
+                snprintf(error_msg, sizeof(error_msg),
+                         "Anda memasukkan %s yang berbeda dari bulan terpilih! Input tidak valid!",
+                         tanggal_baru);
+                tampilkan_error(error_msg);
+                continue;
+            }
+        }
+
+        /* Input nominal baru dengan validasi langsung */
+        if (!masukan_string(y++, 2, "Nominal baru: Rp ", nominal_input, sizeof(nominal_input))) {
+            return 0;
+        }
+        if (strlen(nominal_input) > 0) {
+            if (!urai_nominal(nominal_input, &nominal_baru) || nominal_baru == 0) {
+                tampilkan_error("Nominal tidak valid! Harus berupa angka lebih dari 0");
+                continue;
+            }
+        }
+
+        /* Input deskripsi baru dengan validasi langsung */
+        if (!masukan_string(y++, 2, "Deskripsi baru: ", deskripsi_baru, sizeof(deskripsi_baru))) {
+            return 0;
+        }
+        if (strlen(deskripsi_baru) > MAX_DESKRIPSI_LENGTH) {
+            tampilkan_error("Deskripsi terlalu panjang (max 50 karakter)");
+            continue;
+        }
+
+        break; /* Semua validasi berhasil */
+    }
+
+    /* Cek perubahan */
+    if (strlen(tanggal_baru) == 0 && nominal_baru == 0 && strlen(deskripsi_baru) == 0) {
+        tampilkan_info("Tidak ada perubahan");
+        return 0;
+    }
+
+    /* Konfirmasi */
+    if (!tampilkan_konfirmasi("Simpan perubahan?")) {
+        tampilkan_info("Dibatalkan");
+        return 0;
+    }
+
+    /* Simpan */
+    char error_msg[100];
+    const char *tgl_param = strlen(tanggal_baru) > 0 ? tanggal_baru : NULL;
+    const char *desk_param = strlen(deskripsi_baru) > 0 ? deskripsi_baru : NULL;
+
+    if (ubah_transaksi(id, tgl_param, -1, NULL, nominal_baru, desk_param, error_msg)) {
+        tampilkan_sukses("Transaksi berhasil diupdate");
+        return 1;
+    } else {
+        tampilkan_error("%s", error_msg);
+        return 0;
+    }
+}
+
+int tampilkan_konfirmasi_hapus_transaksi(const char *id) {
+    Transaksi trx;
+    if (!ambil_transaksi_berdasarkan_id(id, &trx)) {
+        tampilkan_error("Transaksi tidak ditemukan");
+        return 0;
+    }
+
+    char nominal_str[30];
+    format_rupiah(trx.nominal, nominal_str);
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "Hapus transaksi %s (%s %s)?",
+             trx.id, dapatkan_label_jenis(trx.jenis), nominal_str);
+
+    if (!tampilkan_konfirmasi(msg)) {
+        tampilkan_info("Dibatalkan");
+        return 0;
+    }
+
+    char error_msg[100];
+    if (hapus_transaksi(id, error_msg)) {
+        tampilkan_sukses("Transaksi berhasil dihapus");
+        return 1;
+    } else {
+        tampilkan_error("%s", error_msg);
+        return 0;
+    }
+}
+
+/* ===== IMPLEMENTASI HANDLER TRANSAKSI ===== */
+
+/**
+ * Jalankan modul transaksi
+ */
+void jalankan_modul_transaksi(int bulan_awal) {
+    int bulan = bulan_awal;
+
+    /* Pastikan pos anggaran ada untuk bulan ini */
+    tui_tunggu_pekerja(NULL);
+    inisialisasi_pos_untuk_bulan(bulan);
+
+    while (1) {
+        int action = menu_transaksi_utama(bulan);
+
+        /* Layar berikutnya membaca file; tunggu perhitungan latar belakang selesai */
+        tui_tunggu_pekerja(NULL);
+
+        switch (action) {
+            case ACT_VIEW:
+                penanganan_lihat_transaksi(bulan);
+                break;
+
+            case ACT_TAMBAH:
+                penanganan_tambah_transaksi(bulan);
+                break;
+
+            case ACT_EDIT:
+                penanganan_ubah_transaksi(bulan);
+                break;
+
+            case ACT_HAPUS:
+                penanganan_hapus_transaksi(bulan);
+                break;
+
+            case ACT_RAPIKAN:
+                penanganan_rapikan_file_transaksi();
+                break;
+
+            case ACT_KEMBALI:
+            case CANCEL:
+                return;
+        }
+    }
+}
+
+int menu_transaksi_utama(int bulan) {
+    char title[64];
+    snprintf(title, sizeof(title), "Menu Transaksi - %s", dapatkan_nama_bulan(bulan));
+
+    Menu menu;
+    menu_inisialisasi(&menu, title);
+
+    menu_tambah_item(&menu, "Lihat Daftar Transaksi", ACT_VIEW);
+    menu_tambah_item(&menu, "Tambah Transaksi", ACT_TAMBAH);
+    menu_tambah_item(&menu, "Edit Transaksi", ACT_EDIT);
+    menu_tambah_item(&menu, "Hapus Transaksi", ACT_HAPUS);
+    menu_tambah_item(&menu, "Rapikan File Transaksi", ACT_RAPIKAN);
+
+    return menu_navigasi(&menu);
+}
+
+/**
+ * Handler untuk view daftar transaksi
+ */
+void penanganan_lihat_transaksi(int bulan) {
+    INSTRUMEN_AKSI(AKSI_BUKA_LAYAR);
+    int selected = 0;
+
+    /* Satu snapshot per layar; navigasi tidak membaca file lagi */
+    SnapshotTransaksi snap;
+    if (!ambil_snapshot_transaksi(&snap, bulan)) {
+        tampilkan_error("Gagal memuat daftar transaksi");
+        return;
+    }
+    INSTRUMEN_AKSI_SELESAI(AKSI_BUKA_LAYAR, 0);
+
+    /* Sisakan ruang untuk ringkasan (6 baris) dan area pesan/footer */
+    TableViewport view;
+    tabel_viewport_inisialisasi(&view, tabel_hitung_baris_muat(6, BARIS_CADANGAN_LIHAT));
+
+    int gambar_penuh = 1;
+
+    while (1) {
+        int count = snap.list.count;
+
+        if (gambar_penuh) {
+            tui_hapus_layar();
+            tampilkan_header("DAFTAR TRANSAKSI");
+            tabel_viewport_invalidasi(&view);
+        }
+
+        /* Setelah gambar penuh, tabel hanya memperbarui baris yang berubah */
+        int next_y = tampilkan_daftar_snapshot_transaksi(&snap, selected, &view);
+
+        if (gambar_penuh) {
+            tampilkan_ringkasan_snapshot_transaksi(&snap, next_y);
+            tampilkan_footer("Panah/PgUp/PgDn/Home/End | ENTER: Detail | R: Muat Ulang | ESC: Kembali");
+            gambar_penuh = 0;
+        }
+        tui_segarkan();
+
+        int ch = tui_ambil_karakter();
+
+        if (tabel_navigasi(ch, &selected, count, view.max_rows)) continue;
+
+        /* Aksi selain navigasi mengganti isi layar */
+        gambar_penuh = 1;
+
+        switch (ch) {
+            case KEY_ENTER:
+            case '\n':
+            case '\r':
+                if (count > 0) {
+                    tui_hapus_layar();
+                    tampilkan_header("DETAIL TRANSAKSI");
+                    tampilkan_detail_transaksi(&snap.list.data[selected], 5);
+                    tampilkan_footer("Tekan sembarang tombol untuk kembali");
+                    tui_segarkan();
+                    tui_ambil_karakter();
+                }
+                break;
+
+            case 'r':
+            case 'R':
+                /* Muat ulang eksplisit dari file */
+                bebaskan_snapshot_transaksi(&snap);
+                if (!ambil_snapshot_transaksi(&snap, bulan)) {
+                    tampilkan_error("Gagal memuat daftar transaksi");
+                    return;
+                }
+                if (selected >= snap.list.count) selected = snap.list.count - 1;
+                if (selected < 0) selected = 0;
+                break;
+
+            case KEY_RESIZE:
+                tabel_viewport_inisialisasi(&view, tabel_hitung_baris_muat(6, BARIS_CADANGAN_LIHAT));
+                break;
+
+            case 27:
+                bebaskan_snapshot_transaksi(&snap);
+                return;
+        }
+    }
+}
+
+/**
+ * Handler untuk tambah transaksi
+ */
+void penanganan_tambah_transaksi(int bulan) {
+    tampilkan_form_tambah_transaksi(bulan);
+}
+
+/**
+ * Handler untuk edit transaksi
+ */
+void penanganan_ubah_transaksi(int bulan) {
+    Transaksi list[MAX_TRANSAKSI];
+    int count = ambil_daftar_transaksi(list, MAX_TRANSAKSI, bulan);
+
+    if (count == 0) {
+        tampilkan_peringatan("Belum ada transaksi");
+        return;
+    }
+
+    Menu menu;
+    menu_inisialisasi(&menu, "Pilih Transaksi untuk Diedit");
+
+    char nominal_str[30];
+    for (int i = 0; i < count && i < 15; i++) {
+        char item[80];
+        format_rupiah(list[i].nominal, nominal_str);
+        snprintf(item, sizeof(item), "%s | %s | %s | %s",
+                 list[i].id, list[i].tanggal,
+                 list[i].jenis == JENIS_PENGELUARAN ? "Out" : "In",
+                 nominal_str);
+        menu_tambah_item(&menu, item, i);
+    }
+
+    int pilihan = menu_navigasi(&menu);
+
+    if (pilihan == CANCEL || pilihan < 0) {
+        return;
+    }
+
+    tampilkan_form_edit_transaksi(list[pilihan].id);
+}
+
+/**
+ * Handler untuk hapus transaksi
+ */
+void penanganan_hapus_transaksi(int bulan) {
+    Transaksi list[MAX_TRANSAKSI];
+    int count = ambil_daftar_transaksi(list, MAX_TRANSAKSI, bulan);
+
+    if (count == 0) {
+        tampilkan_peringatan("Belum ada transaksi");
+        return;
+    }
+
+    Menu menu;
+    menu_inisialisasi(&menu, "Pilih Transaksi untuk Dihapus");
+
+    char nominal_str[30];
+    for (int i = 0; i < count && i < 15; i++) {
+        char item[80];
+        format_rupiah(list[i].nominal, nominal_str);
+        snprintf(item, sizeof(item), "%s | %s | %s | %s",
+                 list[i].id, list[i].tanggal,
+                 list[i].jenis == JENIS_PENGELUARAN ? "Out" : "In",
+                 nominal_str);
+        menu_tambah_item(&menu, item, i);
+    }
+
+    int pilihan = menu_navigasi(&menu);
+
+    if (pilihan == CANCEL || pilihan < 0) {
+        return;
+    }
+
+    tampilkan_konfirmasi_hapus_transaksi(list[pilihan].id);
+}
+
+/**
+ * Handler untuk merapikan file transaksi dari baris rusak
+ */
+void penanganan_rapikan_file_transaksi(void) {
+    if (!tampilkan_konfirmasi("Pindahkan baris rusak ke file .rusak?")) {
+        tampilkan_info("Dibatalkan");
+        return;
+    }
+
+    int dipindah = kompaksi_file_transaksi();
+    if (dipindah < 0) {
+        tampilkan_error("Gagal merapikan file transaksi");
+    } else if (dipindah == 0) {
+        tampilkan_info("Tidak ada baris rusak");
+    } else {
+        char filename[MAX_PATH];
+        dapatkan_nama_file_transaksi(filename, sizeof(filename));
+        tampilkan_sukses("%d baris rusak dipindah ke %s%s", dipindah, filename, FILE_RUSAK_SUFFIX);
+    }
+}
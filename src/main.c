@@ -21,12 +21,17 @@
  * - stdlib.h    : Untuk fungsi umum C
  * - locale.h    : Untuk dukungan karakter Unicode
  * - string.h    : Untuk manipulasi string
- * - file.h      : Untuk memastikan direktori data ada
+ * - file.h      : Untuk memastikan direktori data ada dan melepas cache hangat
+ * - arsip.h     : Untuk menuntaskan segel/buka segel yang terhenti
  * - tui.h       : Untuk antarmuka pengguna
- * - pos.h       : Untuk modul pos anggaran
- * - transaksi.h : Untuk modul transaksi
- * - analisis.h  : Untuk modul analisis keuangan
+ * - layar_pos.h       : Untuk modul pos anggaran dan pemilihan bulan
+ * - layar_transaksi.h : Untuk modul transaksi
+ * - layar_analisis.h  : Untuk modul analisis keuangan
  * - utils.h     : Untuk fungsi utilitas
+ * - pekerja.h   : Untuk thread pekerja latar belakang
+ * - cli.h       : Untuk mode perintah non-interaktif
+ * - instrumen.h : Untuk layar diagnostik dan log instrumentasi
+ * - kolam.h     : Untuk jumlah thread kerja paralel (KEUANGAN_THREAD)
  *
  * CATATAN:
  * Program ini menggunakan ncurses untuk tampilan TUI interaktif.
@@ -39,11 +44,16 @@
 #include <locale.h>
 #include <string.h>
 #include "file.h"
+#include "arsip.h"
 #include "tui.h"
-#include "pos.h"
-#include "transaksi.h"
-#include "analisis.h"
+#include "layar_pos.h"
+#include "layar_transaksi.h"
+#include "layar_analisis.h"
 #include "utils.h"
+#include "pekerja.h"
+#include "cli.h"
+#include "instrumen.h"
+#include "kolam.h"
 
 /* ===== KONSTANTA LOKAL ===== */
 /* Aksi Menu */
@@ -53,6 +63,7 @@
 #define ACT_BULAN       4
 #define ACT_BANTUAN     5
 #define ACT_TENTANG     6
+#define ACT_DIAGNOSTIK  7       /* Tersembunyi: tombol 'D' di menu utama */
 #define ACT_KELUAR      0
 
 /* ===== VARIABEL GLOBAL LOKAL ===== */
@@ -64,6 +75,7 @@ static int menu_utama(void);
 static int pilih_bulan_global(int bulan_saat_ini);
 static void tampilkan_tentang(void);
 static void tampilkan_bantuan(void);
+static void tampilkan_diagnostik(void);
 
 /* ===== FUNGSI UTAMA ===== */
 
@@ -73,36 +85,64 @@ static void tampilkan_bantuan(void);
  * -----------------------------------------------------------------------------
  * Deskripsi      : Fungsi utama aplikasi - titik masuk program. Melakukan
  *                  inisialisasi sistem, menampilkan splash screen, dan
- *                  menjalankan loop utama menu aplikasi.
+ *                  menjalankan loop utama menu aplikasi. Jika diberi argumen
+ *                  perintah, aplikasi berjalan dalam mode CLI tanpa ncurses.
  *
  * Mengembalikan  : int - 0 jika aplikasi berjalan dan ditutup dengan sukses,
- *                  1 jika terjadi error saat inisialisasi
+ *                  1 jika terjadi error saat inisialisasi; pada mode CLI
+ *                  kode keluar dari cli_jalankan
  *
  * Modul Pemanggil: Sistem operasi (entry point program)
- * Modul Dipanggil: pastikan_direktori_data, tui_inisialisasi, tui_inisialisasi_warna,
+ * Modul Dipanggil: cli_jalankan, pastikan_direktori_data, pulihkan_segel,
+ *                  tui_inisialisasi, tui_inisialisasi_warna,
  *                  dapatkan_bulan_saat_ini, tampilkan_splash_screen, menu_utama,
  *                  jalankan_modul_transaksi, jalankan_modul_pos, jalankan_modul_analisis,
  *                  pilih_bulan_global, tampilkan_bantuan, tampilkan_tentang,
- *                  tampilkan_konfirmasi, tui_bersihkan
+ *                  tampilkan_diagnostik, tampilkan_konfirmasi, tui_bersihkan,
+ *                  instrumen_pasang_log_keluar, atur_sinkron_file, kolam_atur_thread,
+ *                  pekerja_kirim, lepaskan_cache_hangat
  *
  * Author/PIC     : Hafiz Fauzan Syafrudin
  * Version        : v1.0 (3 Desember 2025)
  * -----------------------------------------------------------------------------
- * Parameter Input: Tidak ada
+ * Parameter Input: argc, argv - argumen program (argv[1] = perintah CLI, opsional)
  *
  * Parameter Output: Tidak ada (status dikembalikan via return)
  * -----------------------------------------------------------------------------
  */
-int main(void) {
+int main(int argc, char *argv[]) {
     /* Atur locale untuk mendukung karakter khusus */
     setlocale(LC_ALL, "");
 
+    /* Dump statistik instrumentasi saat keluar jika KEUANGAN_DIAG_LOG diisi */
+    instrumen_pasang_log_keluar();
+
+    /* fdatasync pada penulisan ulang penuh jika KEUANGAN_FDATASYNC=1 */
+    const char *sinkron = getenv(ENV_SINKRON_FILE);
+    atur_sinkron_file(sinkron != NULL && strcmp(sinkron, "1") == 0 ? SINKRON_DATA : SINKRON_TIDAK);
+
+    /* Jumlah thread kerja paralel: pemuatan dan rekap tahunan (KEUANGAN_THREAD, 0 = otomatis) */
+    const char *thread_kolam = getenv(ENV_THREAD_KOLAM);
+    if (thread_kolam != NULL) kolam_atur_thread(atoi(thread_kolam));
+
+    /* Mode perintah non-interaktif: ncurses tidak diinisialisasi sama sekali */
+    if (argc > 1) {
+        return cli_jalankan(argc, argv);
+    }
+
     /* Pastikan direktori data ada */
     if (!pastikan_direktori_data()) {
         fprintf(stderr, "Error: Tidak dapat membuat direktori data.\n");
         return 1;
     }
 
+    /* Tuntaskan segel/buka segel yang terhenti sebelum data dibaca */
+    char error_msg[256] = "";
+    if (!pulihkan_segel(error_msg)) {
+        fprintf(stderr, "Error: Gagal memulihkan segel yang terhenti: %s\n", error_msg);
+        return 1;
+    }
+
     /* Inisialisasi TUI */
     tui_inisialisasi();
     tui_inisialisasi_warna();
@@ -110,6 +150,13 @@ int main(void) {
     /* Atur bulan aktif ke bulan saat ini */
     bulan_aktif = dapatkan_bulan_saat_ini();
 
+    /* Thread pekerja untuk perhitungan ulang; validasi manifes (membangun ulang hanya bulan
+       yang berubah sejak terakhir dicatat) lalu pemanasan transaksi bulan aktif berjalan
+       selama splash sehingga layar pertama dilayani dari memori */
+    pekerja_mulai();
+    pekerja_kirim(PEKERJA_MANIFES, 0);
+    pekerja_kirim(PEKERJA_HANGATKAN, bulan_aktif);
+
     /* Tampilkan splash screen */
     tampilkan_splash_screen();
 
@@ -131,9 +178,12 @@ int main(void) {
                 jalankan_modul_analisis(bulan_aktif);
                 break;
 
-            case ACT_BULAN:
+            case ACT_BULAN: {
+                int bulan_lama = bulan_aktif;
                 bulan_aktif = pilih_bulan_global(bulan_aktif);
+                if (bulan_aktif != bulan_lama) pekerja_kirim(PEKERJA_HANGATKAN, bulan_aktif);
                 break;
+            }
 
             case ACT_BANTUAN:
                 tampilkan_bantuan();
@@ -143,6 +193,10 @@ int main(void) {
                 tampilkan_tentang();
                 break;
 
+            case ACT_DIAGNOSTIK:
+                tampilkan_diagnostik();
+                break;
+
             case ACT_KELUAR:
             case CANCEL:
                 if (tampilkan_konfirmasi("Keluar dari aplikasi?")) {
@@ -152,7 +206,11 @@ int main(void) {
         }
     }
 
-    /* Pembersihan */
+    /* Pembersihan: selesaikan antrian pekerja, lalu catat keadaan data ke manifes */
+    pekerja_kirim(PEKERJA_CATAT_MANIFES, 0);
+    tui_tunggu_pekerja("Menyimpan perubahan...");
+    pekerja_hentikan();
+    lepaskan_cache_hangat();
     tui_bersihkan();
 
     return 0;
@@ -246,7 +304,7 @@ static void tampilkan_splash_screen(void) {
  *
  * Modul Pemanggil: main (main.c)
  * Modul Dipanggil: dapatkan_nama_bulan, menu_inisialisasi, menu_tambah_item,
- *                  menu_navigasi
+ *                  menu_atur_tombol_tersembunyi, menu_navigasi
  *
  * Author/PIC     : Hafiz Fauzan Syafrudin
  * Version        : v1.0 (3 Desember 2025)
@@ -270,6 +328,7 @@ static int menu_utama(void) {
     menu_tambah_item(&menu, "Bantuan", ACT_BANTUAN);
     menu_tambah_item(&menu, "Tentang", ACT_TENTANG);
     menu_tambah_item(&menu, "Keluar", ACT_KELUAR);
+    menu_atur_tombol_tersembunyi(&menu, 'D', ACT_DIAGNOSTIK);
 
     return menu_navigasi(&menu);
 }
@@ -425,6 +484,7 @@ static void tampilkan_bantuan(void) {
     tui_cetak(y++, 4, "* Edit data transaksi yang sudah ada");
     tui_cetak(y++, 4, "* Hapus transaksi");
     tui_cetak(y++, 4, "* Lihat daftar dan detail transaksi");
+    tui_cetak(y++, 4, "* Rapikan file: pindahkan baris rusak ke transaksi.txt.rusak");
     y++;
 
     tui_aktifkan_tebal();
@@ -453,3 +513,109 @@ static void tampilkan_bantuan(void) {
     tui_segarkan();
     tui_ambil_karakter();
 }
+
+/*
+ * -----------------------------------------------------------------------------
+ * Nama Prosedur  : tampilkan_diagnostik
+ * -----------------------------------------------------------------------------
+ * Deskripsi      : Menampilkan layar diagnostik tersembunyi berisi penghitung
+ *                  I/O, amplifikasi per aksi pengguna, dan timer per fungsi
+ *                  sejak program berjalan (atau sejak reset terakhir). Tombol
+ *                  sembarang menyegarkan angka.
+ *
+ * Perubahan State: Menampilkan konten ke layar terminal; R mengosongkan
+ *                  statistik, L menambahkan dump ke file log
+ *
+ * I.S (Initial State)  : TUI sudah terinisialisasi, berada di menu utama
+ * F.S (Final State)    : Kembali ke menu utama setelah ESC atau q
+ *
+ * Modul Pemanggil: main (main.c)
+ * Modul Dipanggil: instrumen_ambil_penghitung, instrumen_nama_penghitung,
+ *                  instrumen_ambil_statistik_aksi, instrumen_amplifikasi_aksi,
+ *                  instrumen_ambil_statistik, instrumen_reset, instrumen_tulis_log,
+ *                  tui_hapus_layar, tampilkan_header, tui_cetakf, tampilkan_footer,
+ *                  tui_segarkan, tui_ambil_karakter
+ *
+ * Author/PIC     : Hafiz Fauzan Syafrudin
+ * Version        : v1.0 (19 Oktober 2026)
+ * -----------------------------------------------------------------------------
+ * Parameter Input: Tidak ada
+ *
+ * Parameter Output: Tidak ada (output ke layar)
+ * -----------------------------------------------------------------------------
+ */
+static void tampilkan_diagnostik(void) {
+    char pesan[MAX_PATH + 32] = "";
+
+    while (1) {
+        tui_hapus_layar();
+        tampilkan_header("DIAGNOSTIK");
+
+        int y = 4;
+        tui_aktifkan_tebal();
+        tui_cetak(y++, 2, "PENGHITUNG");
+        tui_nonaktifkan_tebal();
+        for (int i = 0; i < INS_JUMLAH_PENGHITUNG; i++) {
+            tui_cetakf(y + i / 2, 4 + (i % 2) * 36, "%-16s %16llu",
+                       instrumen_nama_penghitung(i), instrumen_ambil_penghitung(i));
+        }
+        y += (INS_JUMLAH_PENGHITUNG + 1) / 2 + 1;
+
+        /* Amplifikasi: byte fisik yang dibaca/ditulis per byte data yang berubah */
+        StatistikAksi aksi[INS_JUMLAH_AKSI];
+        int n_aksi = instrumen_ambil_statistik_aksi(aksi);
+        if (n_aksi > 0) {
+            tui_aktifkan_tebal();
+            tui_cetakf(y++, 2, "%-18s %7s %10s %12s %12s %9s %9s",
+                       "AKSI", "jumlah", "byte_logis", "byte_baca", "byte_tulis",
+                       "amp_tulis", "amp_total");
+            tui_nonaktifkan_tebal();
+            for (int i = 0; i < n_aksi; i++) {
+                tui_cetakf(y++, 4, "%-16s %7llu %10llu %12llu %12llu %9.1f %9.1f",
+                           aksi[i].nama, aksi[i].jumlah, aksi[i].byte_logis,
+                           aksi[i].penghitung[INS_BYTE_BACA], aksi[i].penghitung[INS_BYTE_TULIS],
+                           instrumen_amplifikasi_aksi(&aksi[i], 1),
+                           instrumen_amplifikasi_aksi(&aksi[i], 0));
+            }
+            y++;
+        }
+
+        tui_aktifkan_tebal();
+        tui_cetakf(y++, 2, "%-32s %10s %11s %10s %10s",
+                   "FUNGSI (inklusif)", "panggilan", "total_ms", "rata_us", "maks_us");
+        tui_nonaktifkan_tebal();
+
+        StatistikInstrumen stat[64];
+        int n = instrumen_ambil_statistik(stat, 64);
+        int muat = tui_ambil_tinggi() - 3 - y;
+        for (int i = 0; i < n && i < muat; i++) {
+            tui_cetakf(y++, 2, "%-32.32s %10llu %11.2f %10.1f %10.1f",
+                       stat[i].nama, stat[i].panggilan,
+                       stat[i].total_ns / 1e6,
+                       stat[i].total_ns / 1e3 / stat[i].panggilan,
+                       stat[i].maks_ns / 1e3);
+        }
+        if (n == 0) tui_cetak(y++, 4, "(belum ada fungsi terukur)");
+        if (pesan[0]) tui_cetak(tui_ambil_tinggi() - 3, 2, pesan);
+
+        tampilkan_footer("R: Reset | L: Tulis log | ESC: Kembali | Tombol lain: Segarkan");
+        tui_segarkan();
+
+        int ch = tui_ambil_karakter();
+        pesan[0] = '\0';
+        if (ch == 27 || ch == 'q' || ch == 'Q') break;
+
+        if (ch == 'r' || ch == 'R') {
+            instrumen_reset();
+        } else if (ch == 'l' || ch == 'L') {
+            const char *path = getenv(ENV_LOG_INSTRUMEN);
+            char path_default[MAX_PATH];
+            if (!path || !path[0]) {
+                snprintf(path_default, sizeof(path_default), "%sdiagnostik.log", DATA_DIR);
+                path = path_default;
+            }
+            snprintf(pesan, sizeof(pesan), instrumen_tulis_log(path)
+                     ? "Log ditambahkan ke %s" : "Gagal menulis %s", path);
+        }
+    }
+}
@@ -0,0 +1,492 @@
+/*
+ * =============================================================================
+ * File        : manifes.c
+ * Deskripsi   : Implementasi modul manifes data (validasi saat mulai)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan pencatatan dan pemeriksaan manifes:
+ * 1. Mengumpulkan stat semua file data yang dikenal (tanpa membaca isinya)
+ * 2. Meng-hash ulang hanya file yang stat-nya berbeda dari manifes
+ * 3. Memindai transaksi hanya jika isi partisi buku besar berubah, lalu
+ *    membandingkan checksum per bulan
+ * 4. Membangun ulang pos dan analisis bulan terdampak dengan satu rekap
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, stdlib.h, string.h : Untuk I/O manifes, malloc, dan string
+ * - sys/stat.h, fcntl.h, unistd.h, errno.h : Untuk stat dan pembacaan file mentah
+ * - manifes.h   : Header file modul ini
+ * - file.h      : Untuk nama file data, telusuri_transaksi, dan PenulisBaris
+ * - arsip.h     : Untuk daftar dan nama file arsip tahun
+ * - periode.h   : Untuk nama file snapshot bulan
+ * - rekap.h     : Untuk membangun ulang bulan terpilih
+ * - utils.h     : Untuk hash FNV-1a, pisah_rentang, dan ekstrak_bulan
+ * - instrumen.h : Untuk timer fungsi dan penghitung I/O
+ *
+ * CATATAN:
+ * Hanya bulan yang memiliki file pos atau analisis yang dibangun ulang, sama
+ * dengan recalc tanpa --bulan; bulan tanpa file turunan tidak punya cache.
+ * Jika pemeriksaan atau pembangunan gagal, manifes dihapus agar pemeriksaan
+ * berikutnya tidak mempercayai keadaan setengah jadi.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include "manifes.h"
+#include "file.h"
+#include "arsip.h"
+#include "periode.h"
+#include "rekap.h"
+#include "utils.h"
+#include "instrumen.h"
+
+/* ===== KONSTANTA LOKAL ===== */
+
+#define MAX_ENTRI_MANIFES   (1 + MAKS_TAHUN_ARSIP + 36)    /* transaksi.txt, arsip, tutup/pos/analisis 12 bulan */
+#define MAX_NAMA_MANIFES    32                              /* Panjang nama file relatif DATA_DIR */
+#define UKURAN_BACA_HASH    65536                           /* Blok baca saat meng-hash isi file */
+
+/* ===== STRUKTUR DATA LOKAL ===== */
+
+/**
+ * Struct satu file data yang dicatat manifes
+ */
+typedef struct {
+    char nama[MAX_NAMA_MANIFES];    /* Nama file relatif DATA_DIR */
+    int peran;                      /* PERAN_* */
+    int bulan;                      /* Bulan 1-12, 0 untuk partisi buku besar */
+    struct stat st;                 /* Hanya st_ino, st_dev, st_size, dan st_mtim yang dicatat */
+    unsigned long long hash;        /* Hash FNV-1a isi file */
+} EntriManifes;
+
+/**
+ * Struct isi manifes lengkap
+ */
+typedef struct {
+    int versi_cache;                            /* VERSI_CACHE_TURUNAN saat ditulis */
+    int jumlah_entri;
+    EntriManifes entri[MAX_ENTRI_MANIFES];
+    int jumlah_bulan[13];                       /* Transaksi per bulan (indeks 1-12) */
+    unsigned long long hash_bulan[13];          /* Checksum transaksi per bulan (indeks 1-12) */
+} Manifes;
+
+/**
+ * Struct akumulator pemindaian transaksi per bulan
+ */
+typedef struct {
+    int jumlah[13];
+    unsigned long long hash[13];
+} PindaiBulan;
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Membuat path file manifes
+ */
+static void dapatkan_nama_file_manifes(char *result, int result_size) {
+    snprintf(result, result_size, "%s%s", DATA_DIR, FILE_MANIFES_NAME);
+}
+
+/**
+ * Helper: Memeriksa apakah rentang sama persis dengan string
+ */
+static int rentang_sama(RentangTeks rentang, const char *s) {
+    int len = strlen(s);
+    return rentang.len == len && memcmp(rentang.ptr, s, len) == 0;
+}
+
+/**
+ * Helper: Meng-hash seluruh isi file, mengembalikan 1 jika berhasil dibaca
+ */
+static int hash_isi_file(const char *filename, unsigned long long *hash) {
+    int fd;
+    do {
+        fd = open(filename, O_RDONLY);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0) return 0;
+    INSTRUMEN_TAMBAH(INS_FOPEN, 1);
+
+    char buffer[UKURAN_BACA_HASH];
+    unsigned long long h = HASH_FNV_AWAL;
+    int ok = 1;
+
+    while (1) {
+        ssize_t n = read(fd, buffer, sizeof(buffer));
+        if (n == 0) break;
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            ok = 0;
+            break;
+        }
+        h = hash_fnv1a(buffer, (unsigned long)n, h);
+        INSTRUMEN_TAMBAH(INS_BYTE_BACA, n);
+    }
+
+    close(fd);
+    *hash = h;
+    return ok;
+}
+
+/**
+ * Helper: Menambahkan file ke manifes jika ada (hanya stat, isi belum di-hash)
+ */
+static void tambah_entri(Manifes *m, const char *path, int peran, int bulan) {
+    struct stat st;
+    if (m->jumlah_entri >= MAX_ENTRI_MANIFES || stat(path, &st) != 0) return;
+
+    EntriManifes *e = &m->entri[m->jumlah_entri++];
+    memset(e, 0, sizeof(*e));
+    salin_string_aman(e->nama, path + strlen(DATA_DIR), MAX_NAMA_MANIFES);
+    e->peran = peran;
+    e->bulan = bulan;
+    e->st.st_ino = st.st_ino;
+    e->st.st_dev = st.st_dev;
+    e->st.st_size = st.st_size;
+    e->st.st_mtim = st.st_mtim;
+}
+
+/**
+ * Helper: Mengumpulkan stat semua file data yang dikenal
+ */
+static void kumpulkan_file_data(Manifes *m) {
+    char path[MAX_PATH];
+
+    dapatkan_nama_file_transaksi(path, sizeof(path));
+    tambah_entri(m, path, PERAN_BUKU, 0);
+
+    int tahun[MAKS_TAHUN_ARSIP];
+    int jumlah_tahun = daftar_tahun_arsip(tahun, MAKS_TAHUN_ARSIP);
+    for (int i = 0; i < jumlah_tahun; i++) {
+        dapatkan_nama_file_arsip(tahun[i], path, sizeof(path));
+        tambah_entri(m, path, PERAN_BUKU, 0);
+    }
+
+    for (int b = 1; b <= 12; b++) {
+        dapatkan_nama_file_tutup(b, path, sizeof(path));
+        tambah_entri(m, path, PERAN_TUTUP, b);
+        dapatkan_nama_file_bulan(FILE_POS_PREFIX, b, path, sizeof(path));
+        tambah_entri(m, path, PERAN_POS, b);
+        dapatkan_nama_file_bulan(FILE_ANALISIS_PREFIX, b, path, sizeof(path));
+        tambah_entri(m, path, PERAN_ANALISIS, b);
+    }
+}
+
+/**
+ * Helper: Mencari entri berdasarkan nama, NULL jika tidak ada
+ */
+static const EntriManifes *cari_entri(const Manifes *m, const char *nama) {
+    for (int i = 0; i < m->jumlah_entri; i++) {
+        if (strcmp(m->entri[i].nama, nama) == 0) return &m->entri[i];
+    }
+    return NULL;
+}
+
+/**
+ * Helper: Membaca manifes, mengembalikan 1 jika utuh dan versinya dikenal
+ */
+static int baca_manifes(Manifes *m) {
+    memset(m, 0, sizeof(*m));
+
+    char filename[MAX_PATH];
+    dapatkan_nama_file_manifes(filename, sizeof(filename));
+    FILE *fp = fopen(filename, "r");
+    if (!fp) return 0;
+    INSTRUMEN_TAMBAH(INS_FOPEN, 1);
+
+    char line[MAX_LINE_LENGTH];
+    RentangTeks kolom[10];
+    unsigned long long hash = HASH_FNV_AWAL;
+    int jumlah_file = -1, jumlah_bulan = 0, ok = 0;
+
+    while (fgets(line, sizeof(line), fp)) {
+        hapus_newline_string(line);
+        int n = pisah_rentang(line, '|', kolom, 10);
+
+        if (n == 2 && rentang_sama(kolom[0], "AKHIR")) {
+            ok = (strtoull(kolom[1].ptr, NULL, 16) == hash &&
+                  m->jumlah_entri == jumlah_file && jumlah_bulan == 12);
+            break;
+        }
+        hash = hash_baris(hash, line);
+
+        if (jumlah_file < 0) {
+            /* Baris pertama wajib kepala dengan versi format yang dikenal */
+            if (n != 4 || !rentang_sama(kolom[0], PENANDA_MANIFES) ||
+                rentang_ke_int(kolom[1]) != VERSI_MANIFES) break;
+            m->versi_cache = rentang_ke_int(kolom[2]);
+            jumlah_file = rentang_ke_int(kolom[3]);
+            if (jumlah_file < 0 || jumlah_file > MAX_ENTRI_MANIFES) break;
+        } else if (n == 10 && rentang_sama(kolom[0], "FILE")) {
+            if (m->jumlah_entri >= jumlah_file) break;
+            EntriManifes *e = &m->entri[m->jumlah_entri++];
+            salin_rentang(e->nama, kolom[1], MAX_NAMA_MANIFES);
+            e->peran = rentang_ke_int(kolom[2]);
+            e->bulan = rentang_ke_int(kolom[3]);
+            e->st.st_ino = (ino_t)strtoull(kolom[4].ptr, NULL, 10);
+            e->st.st_dev = (dev_t)strtoull(kolom[5].ptr, NULL, 10);
+            e->st.st_size = (off_t)rentang_ke_ll(kolom[6]);
+            e->st.st_mtim.tv_sec = (time_t)rentang_ke_ll(kolom[7]);
+            e->st.st_mtim.tv_nsec = (long)rentang_ke_ll(kolom[8]);
+            e->hash = strtoull(kolom[9].ptr, NULL, 16);
+            if (e->bulan < 0 || e->bulan > 12) break;
+        } else if (n == 4 && rentang_sama(kolom[0], "BULAN")) {
+            int b = rentang_ke_int(kolom[1]);
+            if (b != jumlah_bulan + 1) break;
+            m->jumlah_bulan[b] = rentang_ke_int(kolom[2]);
+            m->hash_bulan[b] = strtoull(kolom[3].ptr, NULL, 16);
+            jumlah_bulan++;
+        } else {
+            break;
+        }
+    }
+
+    fclose(fp);
+
+    /* Manifes rusak tidak boleh dipakai untuk mempercayai stat file */
+    if (!ok) memset(m, 0, sizeof(*m));
+    return ok;
+}
+
+/**
+ * Helper: Menulis manifes lewat file sementara lalu rename
+ */
+static int tulis_manifes(const Manifes *m) {
+    char filename[MAX_PATH], temp_name[MAX_PATH + 8];
+    dapatkan_nama_file_manifes(filename, sizeof(filename));
+    snprintf(temp_name, sizeof(temp_name), "%s.tmp", filename);
+
+    PenulisBaris w;
+    if (!penulis_buka(&w, temp_name)) return 0;
+
+    char line[MAX_LINE_LENGTH];
+    unsigned long long hash = HASH_FNV_AWAL;
+
+    snprintf(line, sizeof(line), "%s|%d|%d|%d", PENANDA_MANIFES, VERSI_MANIFES, m->versi_cache, m->jumlah_entri);
+    hash = hash_baris(hash, line);
+    penulis_tulis_baris(&w, line);
+
+    for (int i = 0; i < m->jumlah_entri; i++) {
+        const EntriManifes *e = &m->entri[i];
+        snprintf(line, sizeof(line), "FILE|%s|%d|%d|%llu|%llu|%lld|%lld|%ld|%016llx", e->nama, e->peran,
+                 e->bulan, (unsigned long long)e->st.st_ino, (unsigned long long)e->st.st_dev,
+                 (long long)e->st.st_size, (long long)e->st.st_mtim.tv_sec, (long)e->st.st_mtim.tv_nsec,
+                 e->hash);
+        hash = hash_baris(hash, line);
+        penulis_tulis_baris(&w, line);
+    }
+    for (int b = 1; b <= 12; b++) {
+        snprintf(line, sizeof(line), "BULAN|%d|%d|%016llx", b, m->jumlah_bulan[b], m->hash_bulan[b]);
+        hash = hash_baris(hash, line);
+        penulis_tulis_baris(&w, line);
+    }
+
+    snprintf(line, sizeof(line), "AKHIR|%016llx", hash);
+    penulis_tulis_baris(&w, line);
+
+    int ok = penulis_tutup(&w);
+    if (ok) {
+        INSTRUMEN_TAMBAH(INS_RENAME, 1);
+        ok = (rename(temp_name, filename) == 0);
+    }
+    if (!ok) remove(temp_name);
+    return ok;
+}
+
+/**
+ * Helper: Menghapus manifes agar pemeriksaan berikutnya membangun dari awal
+ */
+static void hapus_manifes(void) {
+    char filename[MAX_PATH];
+    dapatkan_nama_file_manifes(filename, sizeof(filename));
+    remove(filename);
+}
+
+/**
+ * Helper: Callback pemindaian, menjumlahkan hash baris transaksi per bulan
+ */
+static int kunjungi_pindai(const Transaksi *trx, void *konteks) {
+    PindaiBulan *p = (PindaiBulan *)konteks;
+    int bulan = ekstrak_bulan(trx->tanggal);
+    if (bulan < 1 || bulan > 12) return 1;
+
+    char line[MAX_LINE_LENGTH];
+    format_transaksi_ke_string(trx, line, sizeof(line));
+    p->hash[bulan] += hash_baris(HASH_FNV_AWAL, line);
+    p->jumlah[bulan]++;
+    return 1;
+}
+
+/**
+ * Helper: Mengisi hash entri dari acuan jika stat sama, selain itu meng-hash
+ * isinya. Entri yang isinya berbeda dari acuan (atau baru) ditandai di berubah[i].
+ * Mengembalikan jumlah file yang di-hash ulang.
+ */
+static int isi_hash_entri(Manifes *m, const Manifes *acuan, int *berubah) {
+    int dibaca = 0;
+
+    for (int i = 0; i < m->jumlah_entri; i++) {
+        EntriManifes *e = &m->entri[i];
+        const EntriManifes *a = cari_entri(acuan, e->nama);
+        berubah[i] = 0;
+
+        if (a && a->peran == e->peran && stat_sama(&a->st, &e->st)) {
+            e->hash = a->hash;
+            continue;
+        }
+
+        char path[MAX_PATH];
+        snprintf(path, sizeof(path), "%s%s", DATA_DIR, e->nama);
+        if (!hash_isi_file(path, &e->hash)) e->hash = 0;
+        dibaca++;
+
+        berubah[i] = (a == NULL || a->peran != e->peran || a->hash != e->hash);
+    }
+    return dibaca;
+}
+
+/**
+ * Helper: Membandingkan keadaan data saat ini dengan manifes lama.
+ * baru terisi keadaan saat ini; hasil berisi bulan yang perlu dibangun ulang.
+ * Mengembalikan 1 jika berhasil, 0 jika pemindaian transaksi gagal.
+ */
+static int periksa_manifes(const Manifes *lama, int lama_valid, Manifes *baru, HasilManifes *hasil) {
+    int berubah[MAX_ENTRI_MANIFES];
+    int bulan_berubah[13] = { 0 };
+    int ada_turunan[13] = { 0 };
+    int buku_berubah = !lama_valid;
+
+    memset(baru, 0, sizeof(*baru));
+    baru->versi_cache = VERSI_CACHE_TURUNAN;
+    kumpulkan_file_data(baru);
+
+    hasil->file_diperiksa = baru->jumlah_entri;
+    hasil->file_dibaca = isi_hash_entri(baru, lama, berubah);
+
+    for (int i = 0; i < baru->jumlah_entri; i++) {
+        const EntriManifes *e = &baru->entri[i];
+        if (e->peran == PERAN_POS || e->peran == PERAN_ANALISIS) ada_turunan[e->bulan] = 1;
+        if (!berubah[i]) continue;
+
+        hasil->file_berubah++;
+        if (e->peran == PERAN_BUKU) buku_berubah = 1;
+        else bulan_berubah[e->bulan] = 1;
+    }
+
+    /* File yang hilang sejak manifes ditulis juga perubahan */
+    for (int i = 0; i < lama->jumlah_entri; i++) {
+        const EntriManifes *e = &lama->entri[i];
+        if (cari_entri(baru, e->nama)) continue;
+
+        hasil->file_berubah++;
+        if (e->peran == PERAN_BUKU) buku_berubah = 1;
+        else bulan_berubah[e->bulan] = 1;
+    }
+
+    if (buku_berubah) {
+        /* Isi buku besar berubah: checksum per bulan menentukan bulan yang terdampak */
+        PindaiBulan pindai;
+        memset(&pindai, 0, sizeof(pindai));
+        if (telusuri_transaksi(0, kunjungi_pindai, &pindai) < 0) return 0;
+        hasil->buku_dipindai = 1;
+
+        for (int b = 1; b <= 12; b++) {
+            baru->jumlah_bulan[b] = pindai.jumlah[b];
+            baru->hash_bulan[b] = pindai.hash[b];
+            if (pindai.jumlah[b] != lama->jumlah_bulan[b] || pindai.hash[b] != lama->hash_bulan[b]) {
+                bulan_berubah[b] = 1;
+            }
+        }
+    } else {
+        memcpy(baru->jumlah_bulan, lama->jumlah_bulan, sizeof(baru->jumlah_bulan));
+        memcpy(baru->hash_bulan, lama->hash_bulan, sizeof(baru->hash_bulan));
+    }
+
+    /* Manifes baru atau versi cache lain: semua bulan berdata dianggap usang */
+    int semua = !lama_valid || lama->versi_cache != VERSI_CACHE_TURUNAN;
+    for (int b = 1; b <= 12; b++) {
+        hasil->bulan_dibangun[b] = ada_turunan[b] && (semua || bulan_berubah[b]);
+        hasil->jumlah_bulan_dibangun += hasil->bulan_dibangun[b];
+    }
+    return 1;
+}
+
+/**
+ * Helper: Alur bersama sinkronkan_manifes dan catat_manifes
+ */
+static int proses_manifes(int bangun_ulang, HasilManifes *hasil) {
+    HasilManifes hasil_lokal;
+    if (!hasil) hasil = &hasil_lokal;
+    memset(hasil, 0, sizeof(*hasil));
+
+    pastikan_direktori_data();
+
+    Manifes *lama = (Manifes *)malloc(sizeof(Manifes));
+    Manifes *baru = (Manifes *)malloc(sizeof(Manifes));
+    if (lama == NULL || baru == NULL) {
+        free(lama);
+        free(baru);
+        return 0;
+    }
+
+    int lama_valid = baca_manifes(lama);
+    int ok = periksa_manifes(lama, lama_valid, baru, hasil);
+
+    if (!bangun_ulang) {
+        /* Pencatatan saja: bulan usang dianggap sudah dihitung ulang oleh pemanggil */
+        memset(hasil->bulan_dibangun, 0, sizeof(hasil->bulan_dibangun));
+        hasil->jumlah_bulan_dibangun = 0;
+    }
+
+    /* Tanpa perbedaan stat, manifes tidak perlu ditulis ulang */
+    int perlu_tulis = !lama_valid || hasil->file_dibaca > 0 || lama->jumlah_entri != baru->jumlah_entri ||
+                      lama->versi_cache != baru->versi_cache;
+
+    if (ok && hasil->jumlah_bulan_dibangun > 0) {
+        ok = refresh_rekap_bulan(hasil->bulan_dibangun, NULL);
+
+        /* File pos/analisis yang baru ditulis dicatat dengan stat dan hash terbarunya;
+           manifes lama tidak dipakai lagi sehingga dijadikan acuan keadaan sebelum rekap */
+        if (ok) {
+            int berubah[MAX_ENTRI_MANIFES];
+            memcpy(lama, baru, sizeof(Manifes));
+            baru->jumlah_entri = 0;
+            kumpulkan_file_data(baru);
+            isi_hash_entri(baru, lama, berubah);
+            perlu_tulis = 1;
+        }
+    }
+
+    if (ok && perlu_tulis) ok = tulis_manifes(baru);
+    if (!ok) hapus_manifes();
+
+    free(lama);
+    free(baru);
+    return ok;
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+/**
+ * Memvalidasi data terhadap manifes dan membangun ulang yang berubah
+ */
+int sinkronkan_manifes(HasilManifes *hasil) {
+    INSTRUMEN_FUNGSI();
+    return proses_manifes(1, hasil);
+}
+
+/**
+ * Mencatat keadaan data saat ini ke manifes tanpa membangun ulang
+ */
+int catat_manifes(HasilManifes *hasil) {
+    INSTRUMEN_FUNGSI();
+    return proses_manifes(0, hasil);
+}
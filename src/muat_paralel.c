@@ -0,0 +1,236 @@
+/*
+ * =============================================================================
+ * File        : muat_paralel.c
+ * Deskripsi   : Implementasi modul pemuatan file transaksi secara paralel
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan pemuatan file transaksi dengan beberapa
+ * thread. File dipetakan ke memori, dibagi menjadi potongan yang berakhir di
+ * newline, lalu setiap potongan diurai sebagai tugas kolam ke list milik
+ * potongan itu sendiri. Setelah batch selesai, list digabung berurutan ke
+ * list tujuan.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - fcntl.h, unistd.h, sys/mman.h, sys/stat.h : Untuk open, close, mmap, fstat
+ * - stdlib.h, string.h : Untuk malloc, realloc, memchr, memcpy
+ * - muat_paralel.h : Header file modul ini
+ * - kolam.h     : Untuk menjalankan potongan di kolam thread
+ * - file.h      : Untuk urai_baris_transaksi dan nama file transaksi
+ * - arsip.h     : Untuk memuat arsip tahun yang disegel sebelum file teks
+ * - utils.h     : Untuk ListTransaksi dan urai_tanggal_struct
+ * - instrumen.h : Untuk penghitung I/O dan atribusi aksi di thread parser
+ *
+ * CATATAN:
+ * Tidak ada state bersama yang ditulis selama parsing: setiap potongan hanya
+ * menulis list miliknya, sehingga tidak diperlukan mutex. File dibagi menjadi
+ * POTONGAN_PER_THREAD potongan per thread agar thread yang selesai lebih dulu
+ * dapat mencuri potongan sisa.
+ * =============================================================================
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <string.h>
+#include "muat_paralel.h"
+#include "kolam.h"
+#include "file.h"
+#include "arsip.h"
+#include "utils.h"
+#include "instrumen.h"
+
+/* ===== STRUKTUR DATA LOKAL ===== */
+
+/**
+ * Struct satu potongan file yang diurai oleh satu thread
+ */
+typedef struct {
+    const char *awal;       /* Byte pertama potongan (awal baris) */
+    const char *akhir;      /* Satu byte setelah potongan */
+    int bulan;              /* Filter bulan (0 = semua) */
+    ListTransaksi hasil;    /* Transaksi hasil potongan ini */
+    int gagal;              /* 1 jika alokasi gagal */
+} PotonganMuat;
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Mengurai satu potongan file, baris demi baris.
+ * Baris dipotong per MAX_LINE_LENGTH - 1 byte seperti fgets agar hasilnya
+ * sama dengan penelusuran berurutan.
+ */
+static void urai_potongan(void *konteks, int indeks) {
+    PotonganMuat *p = &((PotonganMuat *)konteks)[indeks];
+
+    char line[MAX_LINE_LENGTH];
+    Transaksi trx;
+    const char *pos = p->awal;
+
+    while (pos < p->akhir) {
+        int maks = MAX_LINE_LENGTH - 1;
+        int sisa = (int)(p->akhir - pos);
+        int len = (sisa < maks) ? sisa : maks;
+
+        const char *nl = memchr(pos, '\n', len);
+        if (nl) len = (int)(nl - pos) + 1;
+
+        memcpy(line, pos, len);
+        line[len] = '\0';
+        pos += len;
+
+        hapus_newline_string(line);
+        if (line[0] == '\0') continue;
+        if (!urai_baris_transaksi(line, &trx)) continue;
+
+        if (p->bulan > 0) {
+            Tanggal tgl;
+            if (!urai_tanggal_struct(trx.tanggal, &tgl) || tgl.bulan != p->bulan) continue;
+        }
+
+        if (!tambah_ke_list_transaksi(&p->hasil, &trx)) {
+            p->gagal = 1;
+            break;
+        }
+    }
+}
+
+/**
+ * Helper: Pengunjung arsip yang menambah transaksi ke list tujuan
+ */
+static int kunjungi_tambah_list(const Transaksi *trx, void *konteks) {
+    return tambah_ke_list_transaksi((ListTransaksi *)konteks, trx) ? 1 : -1;
+}
+
+/**
+ * Helper: Memastikan kapasitas list minimal kapasitas elemen
+ */
+static int pastikan_kapasitas_list(ListTransaksi *list, int kapasitas) {
+    if (list->capacity >= kapasitas) return 1;
+
+    Transaksi *baru = (Transaksi *)realloc(list->data, (size_t)kapasitas * sizeof(Transaksi));
+    if (baru == NULL) return 0;
+
+    list->data = baru;
+    list->capacity = kapasitas;
+    return 1;
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+/**
+ * Memeriksa apakah file cukup besar untuk dimuat paralel
+ */
+int muat_paralel_dianjurkan(const char *filename) {
+    if (filename == NULL || kolam_ambil_thread() < 2) return 0;
+
+    struct stat st;
+    if (stat(filename, &st) != 0) return 0;
+    return st.st_size >= AMBANG_MUAT_PARALEL;
+}
+
+/**
+ * Memuat file transaksi secara paralel ke list dinamis
+ */
+int muat_transaksi_paralel(ListTransaksi *list, int bulan) {
+    INSTRUMEN_FUNGSI();
+    if (!list || !list->data || bulan < 0 || bulan > 12) return -1;
+
+    list->count = 0;
+
+    /* Arsip tahun yang disegel mendahului isi file teks, sama dengan telusuri_transaksi */
+    pastikan_direktori_data();
+    if (telusuri_arsip(bulan, kunjungi_tambah_list, list, NULL) < 0) return -1;
+
+    char filename[MAX_PATH];
+    dapatkan_nama_file_transaksi(filename, sizeof(filename));
+
+    INSTRUMEN_TAMBAH(INS_FOPEN, 1);
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return list->count;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return -1;
+    }
+    if (st.st_size == 0) {
+        close(fd);
+        return list->count;
+    }
+
+    size_t ukuran = (size_t)st.st_size;
+    const char *peta = mmap(NULL, ukuran, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (peta == MAP_FAILED) return -1;
+    madvise((void *)peta, ukuran, MADV_SEQUENTIAL);
+    INSTRUMEN_TAMBAH(INS_BYTE_BACA, ukuran);
+
+    /* Potongan terlalu kecil tidak sebanding dengan biaya penjadwalan */
+    int jumlah = (int)(ukuran / POTONGAN_MIN_PARALEL);
+    int maks_potongan = kolam_ambil_thread() * POTONGAN_PER_THREAD;
+    if (jumlah > maks_potongan) jumlah = maks_potongan;
+    if (jumlah < 1) jumlah = 1;
+
+    PotonganMuat *potongan = (PotonganMuat *)calloc((size_t)jumlah, sizeof(PotonganMuat));
+    if (potongan == NULL) {
+        munmap((void *)peta, ukuran);
+        return -1;
+    }
+    const char *akhir_file = peta + ukuran;
+    const char *awal = peta;
+    int hasil = 0;
+
+    /* Batas potongan digeser maju ke byte setelah newline berikutnya */
+    for (int i = 0; i < jumlah; i++) {
+        const char *akhir = akhir_file;
+        if (i < jumlah - 1) {
+            const char *target = peta + (ukuran / jumlah) * (i + 1);
+            if (target < awal) target = awal;
+            const char *nl = memchr(target, '\n', akhir_file - target);
+            akhir = nl ? nl + 1 : akhir_file;
+        }
+
+        potongan[i].awal = awal;
+        potongan[i].akhir = akhir;
+        potongan[i].bulan = bulan;
+        /* Perkiraan kasar: satu transaksi per 48 byte */
+        int perkiraan = (int)((akhir - awal) / 48) + 16;
+        if (!inisialisasi_list_transaksi(&potongan[i].hasil, perkiraan)) {
+            potongan[i].hasil.data = NULL;
+            potongan[i].gagal = 1;
+            /* Kosongkan rentang agar tugasnya tidak mengurai apa pun */
+            potongan[i].akhir = awal;
+        }
+        awal = akhir;
+    }
+
+    kolam_jalankan(urai_potongan, potongan, jumlah);
+
+    munmap((void *)peta, ukuran);
+
+    /* Gabungkan hasil sesuai urutan potongan di file */
+    int total = 0;
+    for (int i = 0; i < jumlah; i++) {
+        if (potongan[i].gagal) hasil = -1;
+        total += potongan[i].hasil.count;
+    }
+    if (hasil == 0 && !pastikan_kapasitas_list(list, list->count + total)) hasil = -1;
+
+    for (int i = 0; i < jumlah; i++) {
+        if (hasil == 0 && potongan[i].hasil.count > 0) {
+            memcpy(&list->data[list->count], potongan[i].hasil.data,
+                   (size_t)potongan[i].hasil.count * sizeof(Transaksi));
+            list->count += potongan[i].hasil.count;
+        }
+        if (potongan[i].hasil.data) bebaskan_list_transaksi(&potongan[i].hasil);
+    }
+    free(potongan);
+
+    return (hasil == 0) ? list->count : -1;
+}
@@ -0,0 +1,285 @@
+/*
+ * =============================================================================
+ * File        : pekerja.c
+ * Deskripsi   : Implementasi modul pekerja latar belakang (worker thread)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan satu thread pekerja dengan antrian FIFO
+ * melingkar yang dilindungi mutex. Thread UI mengirim pekerjaan dan
+ * memantau tiket; thread pekerja menjalankan pekerjaan satu per satu.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - pthread.h   : Untuk thread, mutex, dan condition variable
+ * - pekerja.h   : Header file modul ini
+ * - pos.h       : Untuk update_semua_pos_bulan
+ * - analisis.h  : Untuk refresh_analisis_bulan
+ * - file.h      : Untuk hangatkan_transaksi_bulan
+ * - manifes.h   : Untuk sinkronkan_manifes dan catat_manifes
+ * - periode.h   : Untuk ambil_ringkasan_periode saat pemanasan
+ * - instrumen.h : Untuk mengatribusikan pekerjaan ke aksi pengirimnya
+ *
+ * CATATAN:
+ * Hanya satu thread pekerja agar pekerjaan tidak pernah saling tumpang
+ * tindih pada file yang sama dan urutan penyimpanan tetap terjaga.
+ * =============================================================================
+ */
+
+#include <pthread.h>
+#include "pekerja.h"
+#include "pos.h"
+#include "analisis.h"
+#include "file.h"
+#include "manifes.h"
+#include "periode.h"
+#include "instrumen.h"
+
+/* ===== STRUKTUR DATA LOKAL ===== */
+
+/**
+ * Struct untuk satu pekerjaan di antrian
+ */
+typedef struct {
+    int jenis;              /* Jenis pekerjaan (PEKERJA_*) */
+    int bulan;              /* Bulan target */
+    unsigned long tiket;    /* Nomor tiket */
+    int aksi;               /* Aksi pengguna pengirim (AKSI_*) */
+} Pekerjaan;
+
+/* ===== VARIABEL GLOBAL LOKAL ===== */
+
+static pthread_mutex_t kunci = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond_ada_pekerjaan = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t cond_selesai = PTHREAD_COND_INITIALIZER;
+static pthread_t thread_pekerja;
+
+static Pekerjaan antrian[MAX_ANTRIAN_PEKERJA];
+static int kepala = 0;                      /* Index pekerjaan terdepan */
+static int jumlah_antri = 0;                /* Jumlah pekerjaan menunggu */
+static int sedang_berjalan = 0;             /* 1 jika pekerjaan sedang dikerjakan */
+static int thread_aktif = 0;                /* 1 jika thread sudah dimulai */
+static int diminta_berhenti = 0;            /* 1 jika thread diminta berhenti */
+static int mode_tunda = 0;                  /* 1 jika pekerjaan tanpa thread dikumpulkan */
+
+static unsigned long tiket_berikutnya = 1;  /* Tiket untuk pekerjaan berikutnya */
+static unsigned long tiket_selesai = 0;     /* Tiket terakhir yang selesai */
+static int jumlah_gagal = 0;                /* Pekerjaan gagal sejak dibaca terakhir */
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Memuat data bulan ke memori sebelum layar pertama membutuhkannya
+ */
+static int hangatkan_bulan(int bulan) {
+    /* Bulan tertutup: kepala snapshot masuk cache ringkasan periode */
+    RingkasanPeriode ringkasan;
+    ambil_ringkasan_periode(bulan, &ringkasan);
+
+    return hangatkan_transaksi_bulan(bulan) >= 0;
+}
+
+/**
+ * Helper: Menjalankan satu pekerjaan, mengembalikan 1 jika berhasil
+ */
+static int jalankan_pekerjaan(const Pekerjaan *p) {
+    INSTRUMEN_AKSI(p->aksi);
+    switch (p->jenis) {
+        case PEKERJA_HITUNG_POS:
+            return update_semua_pos_bulan(p->bulan);
+        case PEKERJA_REFRESH_ANALISIS:
+            return refresh_analisis_bulan(p->bulan);
+        case PEKERJA_MANIFES:
+            return sinkronkan_manifes(NULL);
+        case PEKERJA_CATAT_MANIFES:
+            return catat_manifes(NULL);
+        case PEKERJA_HANGATKAN:
+            return hangatkan_bulan(p->bulan);
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Helper: Loop utama thread pekerja
+ */
+static void *loop_pekerja(void *arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&kunci);
+    while (1) {
+        while (jumlah_antri == 0 && !diminta_berhenti) {
+            pthread_cond_wait(&cond_ada_pekerjaan, &kunci);
+        }
+        /* Berhenti hanya setelah antrian habis */
+        if (jumlah_antri == 0) break;
+
+        Pekerjaan p = antrian[kepala];
+        kepala = (kepala + 1) % MAX_ANTRIAN_PEKERJA;
+        jumlah_antri--;
+        sedang_berjalan = 1;
+        pthread_mutex_unlock(&kunci);
+
+        int ok = jalankan_pekerjaan(&p);
+
+        pthread_mutex_lock(&kunci);
+        sedang_berjalan = 0;
+        tiket_selesai = p.tiket;
+        if (!ok) jumlah_gagal++;
+        pthread_cond_broadcast(&cond_selesai);
+    }
+    pthread_mutex_unlock(&kunci);
+
+    return NULL;
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+int pekerja_mulai(void) {
+    pthread_mutex_lock(&kunci);
+    if (thread_aktif) {
+        pthread_mutex_unlock(&kunci);
+        return 1;
+    }
+    diminta_berhenti = 0;
+    thread_aktif = (pthread_create(&thread_pekerja, NULL, loop_pekerja, NULL) == 0);
+    pthread_mutex_unlock(&kunci);
+
+    return thread_aktif;
+}
+
+void pekerja_hentikan(void) {
+    pthread_mutex_lock(&kunci);
+    if (!thread_aktif) {
+        pthread_mutex_unlock(&kunci);
+        return;
+    }
+    diminta_berhenti = 1;
+    pthread_cond_signal(&cond_ada_pekerjaan);
+    pthread_mutex_unlock(&kunci);
+
+    pthread_join(thread_pekerja, NULL);
+
+    pthread_mutex_lock(&kunci);
+    thread_aktif = 0;
+    pthread_mutex_unlock(&kunci);
+}
+
+unsigned long pekerja_kirim(int jenis, int bulan) {
+    pthread_mutex_lock(&kunci);
+
+    /* Tanpa thread: jalankan langsung agar hasil tetap sama */
+    if (!thread_aktif && !mode_tunda) {
+        Pekerjaan p = { jenis, bulan, tiket_berikutnya++, instrumen_aksi_sekarang() };
+        pthread_mutex_unlock(&kunci);
+
+        int ok = jalankan_pekerjaan(&p);
+
+        pthread_mutex_lock(&kunci);
+        tiket_selesai = p.tiket;
+        if (!ok) jumlah_gagal++;
+        pthread_mutex_unlock(&kunci);
+        return p.tiket;
+    }
+
+    /* Pekerjaan sama yang belum dimulai akan membaca data terbaru, cukup digabung
+       (kerjanya tetap tercatat pada aksi pengirim pertama) */
+    for (int i = 0; i < jumlah_antri; i++) {
+        const Pekerjaan *p = &antrian[(kepala + i) % MAX_ANTRIAN_PEKERJA];
+        if (p->jenis == jenis && p->bulan == bulan) {
+            unsigned long tiket = p->tiket;
+            pthread_mutex_unlock(&kunci);
+            return tiket;
+        }
+    }
+
+    while (jumlah_antri >= MAX_ANTRIAN_PEKERJA) {
+        if (!thread_aktif) {
+            /* Mode tunda penuh: kosongkan antrian lebih dulu */
+            pthread_mutex_unlock(&kunci);
+            pekerja_jalankan_tertunda();
+            pthread_mutex_lock(&kunci);
+            continue;
+        }
+        pthread_cond_wait(&cond_selesai, &kunci);
+    }
+
+    int ekor = (kepala + jumlah_antri) % MAX_ANTRIAN_PEKERJA;
+    antrian[ekor].jenis = jenis;
+    antrian[ekor].bulan = bulan;
+    antrian[ekor].tiket = tiket_berikutnya++;
+    antrian[ekor].aksi = instrumen_aksi_sekarang();
+    jumlah_antri++;
+
+    unsigned long tiket = antrian[ekor].tiket;
+    pthread_cond_signal(&cond_ada_pekerjaan);
+    pthread_mutex_unlock(&kunci);
+
+    return tiket;
+}
+
+int pekerja_selesai(unsigned long tiket) {
+    pthread_mutex_lock(&kunci);
+    int selesai = (tiket_selesai >= tiket);
+    pthread_mutex_unlock(&kunci);
+    return selesai;
+}
+
+int pekerja_sibuk(void) {
+    pthread_mutex_lock(&kunci);
+    int sibuk = (jumlah_antri > 0 || sedang_berjalan);
+    pthread_mutex_unlock(&kunci);
+    return sibuk;
+}
+
+void pekerja_tunggu_semua(void) {
+    /* Pekerjaan tertunda tanpa thread harus dijalankan sendiri */
+    pekerja_jalankan_tertunda();
+
+    pthread_mutex_lock(&kunci);
+    while (jumlah_antri > 0 || sedang_berjalan) {
+        pthread_cond_wait(&cond_selesai, &kunci);
+    }
+    pthread_mutex_unlock(&kunci);
+}
+
+void pekerja_tunda(int aktif) {
+    pthread_mutex_lock(&kunci);
+    mode_tunda = aktif ? 1 : 0;
+    pthread_mutex_unlock(&kunci);
+}
+
+int pekerja_jalankan_tertunda(void) {
+    int dijalankan = 0;
+
+    pthread_mutex_lock(&kunci);
+    /* Dengan thread aktif, antrian sudah dikerjakan oleh thread pekerja */
+    while (!thread_aktif && jumlah_antri > 0) {
+        Pekerjaan p = antrian[kepala];
+        kepala = (kepala + 1) % MAX_ANTRIAN_PEKERJA;
+        jumlah_antri--;
+        sedang_berjalan = 1;
+        pthread_mutex_unlock(&kunci);
+
+        int ok = jalankan_pekerjaan(&p);
+        dijalankan++;
+
+        pthread_mutex_lock(&kunci);
+        sedang_berjalan = 0;
+        tiket_selesai = p.tiket;
+        if (!ok) jumlah_gagal++;
+    }
+    pthread_mutex_unlock(&kunci);
+
+    return dijalankan;
+}
+
+int pekerja_ambil_jumlah_gagal(void) {
+    pthread_mutex_lock(&kunci);
+    int gagal = jumlah_gagal;
+    jumlah_gagal = 0;
+    pthread_mutex_unlock(&kunci);
+    return gagal;
+}
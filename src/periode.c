@@ -0,0 +1,405 @@
+/*
+ * =============================================================================
+ * File        : periode.c
+ * Deskripsi   : Implementasi modul tutup periode (snapshot bulan)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan penulisan snapshot bulan yang ditutup,
+ * pembacaan agregatnya dengan cache per bulan, verifikasi checksum, serta
+ * buka kembali periode.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, stdlib.h, string.h : Untuk file, strtoull, dan manipulasi string
+ * - sys/stat.h  : Untuk mendeteksi perubahan file snapshot
+ * - pthread.h   : Untuk mutex cache ringkasan
+ * - periode.h   : Header file modul ini
+ * - transaksi.h : Untuk ListTransaksi dan RingkasanTransaksi
+ * - file.h      : Untuk muat/simpan pos, analisis, transaksi, dan PenulisBaris
+ * - pos.h       : Untuk akumulasi_transaksi (lewat file.h)
+ * - utils.h     : Untuk hash FNV-1a dan pisah_rentang
+ * - instrumen.h : Untuk timer fungsi dan penghitung rename
+ *
+ * CATATAN:
+ * Agregat dihitung dari satu kali pemuatan transaksi bulan dengan
+ * akumulasi_transaksi (pos.c). Checksum
+ * transaksi adalah jumlah (mod 2^64) hash tiap baris sehingga tidak
+ * bergantung urutan baris; segel/buka segel tahun boleh mengubah urutan
+ * tanpa membuat snapshot dianggap berubah.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include "periode.h"
+#include "transaksi.h"
+#include "file.h"
+#include "utils.h"
+#include "instrumen.h"
+
+/* ===== STRUKTUR DATA LOKAL ===== */
+
+/**
+ * Struct cache ringkasan satu bulan, berlaku selama stat file sama
+ */
+typedef struct {
+    int valid;
+    struct stat st;
+    RingkasanPeriode data;
+} CachePeriode;
+
+/* ===== VARIABEL GLOBAL LOKAL ===== */
+
+static pthread_mutex_t kunci_cache = PTHREAD_MUTEX_INITIALIZER;
+static CachePeriode cache_periode[13];      /* Indeks 1-12 */
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Mengisi pesan error jika buffer tersedia
+ */
+static void atur_pesan_error(char *error_msg, const char *msg) {
+    if (error_msg && msg) {
+        salin_string_aman(error_msg, msg, 100);
+    }
+}
+
+/**
+ * Helper: Checksum transaksi yang tidak bergantung urutan
+ */
+static unsigned long long hash_daftar_transaksi(const ListTransaksi *list) {
+    char line[MAX_LINE_LENGTH];
+    unsigned long long total = 0;
+
+    for (int i = 0; i < list->count; i++) {
+        format_transaksi_ke_string(&list->data[i], line, sizeof(line));
+        total += hash_baris(HASH_FNV_AWAL, line);
+    }
+    return total;
+}
+
+/**
+ * Helper: Analisis dihitung ulang dari kolom bilangan bulat agar rata-rata
+ * dan persentase sama persis dengan perhitungan dari transaksi
+ */
+static void normalkan_analisis(AnalisisKeuangan *analisis) {
+    RingkasanTransaksi r;
+    r.total_pemasukan = analisis->total_pemasukan;
+    r.total_pengeluaran = analisis->total_pengeluaran;
+    r.jumlah_pemasukan = analisis->total_trx_pemasukan;
+    r.jumlah_pengeluaran = analisis->total_trx_pengeluaran;
+    isi_analisis_dari_ringkasan(&r, analisis);
+}
+
+/**
+ * Helper: Membuka snapshot dan membaca kepala, analisis, dan pos.
+ * Mengembalikan FILE yang berada di awal bagian transaksi, atau NULL jika
+ * tidak ada atau bagian agregat rusak.
+ */
+static FILE *buka_snapshot(int bulan, RingkasanPeriode *hasil, unsigned long long *hash_transaksi) {
+    char filename[MAX_PATH];
+    dapatkan_nama_file_tutup(bulan, filename, sizeof(filename));
+
+    FILE *fp = buka_file_baca(filename);
+    if (!fp) return NULL;
+
+    char line[MAX_LINE_LENGTH];
+    RentangTeks kolom[7];
+    memset(hasil, 0, sizeof(RingkasanPeriode));
+
+    /* Kepala */
+    int ok = fgets(line, sizeof(line), fp) != NULL;
+    if (ok) {
+        hapus_newline_string(line);
+        ok = pisah_rentang(line, '|', kolom, 7) == 7 &&
+             kolom[0].len == (int)strlen(PENANDA_TUTUP) &&
+             strncmp(kolom[0].ptr, PENANDA_TUTUP, kolom[0].len) == 0 &&
+             rentang_ke_int(kolom[1]) == VERSI_TUTUP &&
+             rentang_ke_int(kolom[2]) == bulan;
+    }
+    unsigned long long hash_agregat = 0;
+    if (ok) {
+        hasil->bulan = bulan;
+        hasil->jumlah_transaksi = rentang_ke_int(kolom[3]);
+        hasil->jumlah_pos = rentang_ke_int(kolom[4]);
+        hash_agregat = strtoull(kolom[5].ptr, NULL, 16);
+        *hash_transaksi = strtoull(kolom[6].ptr, NULL, 16);
+        ok = hasil->jumlah_transaksi >= 0 && hasil->jumlah_pos >= 0 && hasil->jumlah_pos <= MAX_POS;
+    }
+
+    /* Analisis lalu pos, di-hash sambil dibaca */
+    unsigned long long hash = HASH_FNV_AWAL;
+    for (int i = -1; ok && i < hasil->jumlah_pos; i++) {
+        if (!fgets(line, sizeof(line), fp)) {
+            ok = 0;
+            break;
+        }
+        hapus_newline_string(line);
+        hash = hash_baris(hash, line);
+        ok = (i < 0) ? urai_baris_analisis(line, &hasil->analisis)
+                     : urai_baris_pos(line, &hasil->pos[i]);
+    }
+
+    if (!ok || hash != hash_agregat) {
+        fclose(fp);
+        return NULL;
+    }
+
+    normalkan_analisis(&hasil->analisis);
+    hasil->hash_transaksi = *hash_transaksi;
+    return fp;
+}
+
+/**
+ * Helper: Membuang cache ringkasan satu bulan
+ */
+static void batalkan_cache(int bulan) {
+    pthread_mutex_lock(&kunci_cache);
+    cache_periode[bulan].valid = 0;
+    pthread_mutex_unlock(&kunci_cache);
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+/**
+ * Membuat nama file snapshot bulan
+ */
+void dapatkan_nama_file_tutup(int bulan, char *result, int result_size) {
+    if (result == NULL || result_size <= 0) return;
+
+    snprintf(result, result_size, "%s%s_%02d%s", DATA_DIR, FILE_TUTUP_PREFIX, bulan, FILE_TUTUP_EXTENSION);
+}
+
+/**
+ * Memeriksa apakah bulan sudah ditutup
+ */
+int cek_periode_tertutup(int bulan) {
+    if (bulan < 1 || bulan > 12) return 0;
+
+    char filename[MAX_PATH];
+    dapatkan_nama_file_tutup(bulan, filename, sizeof(filename));
+    return cek_file_ada(filename);
+}
+
+/**
+ * Memeriksa apakah tanggal berada di bulan yang ditutup
+ */
+int cek_tanggal_tertutup(const char *tanggal) {
+    return cek_periode_tertutup(ekstrak_bulan(tanggal));
+}
+
+/**
+ * Mengambil agregat akhir bulan yang ditutup
+ */
+int ambil_ringkasan_periode(int bulan, RingkasanPeriode *hasil) {
+    if (hasil == NULL || bulan < 1 || bulan > 12) return 0;
+
+    char filename[MAX_PATH];
+    struct stat st;
+    dapatkan_nama_file_tutup(bulan, filename, sizeof(filename));
+    if (stat(filename, &st) != 0) return 0;
+
+    pthread_mutex_lock(&kunci_cache);
+    CachePeriode *c = &cache_periode[bulan];
+    int sama = c->valid && stat_sama(&st, &c->st);
+
+    if (!sama) {
+        unsigned long long hash_transaksi = 0;
+        FILE *fp = buka_snapshot(bulan, &c->data, &hash_transaksi);
+        c->valid = (fp != NULL);
+        c->st = st;
+        if (fp) fclose(fp);
+    }
+
+    int ok = c->valid;
+    if (ok) memcpy(hasil, &c->data, sizeof(RingkasanPeriode));
+    pthread_mutex_unlock(&kunci_cache);
+
+    return ok;
+}
+
+/**
+ * Menutup periode: membekukan transaksi, analisis, dan pos bulan
+ */
+int tutup_periode(int bulan, char *error_msg) {
+    INSTRUMEN_FUNGSI();
+    if (bulan < 1 || bulan > 12) {
+        atur_pesan_error(error_msg, "Bulan tidak valid");
+        return -1;
+    }
+    if (bulan >= dapatkan_bulan_saat_ini()) {
+        atur_pesan_error(error_msg, "Hanya bulan yang sudah lewat yang bisa ditutup");
+        return -1;
+    }
+    if (cek_periode_tertutup(bulan)) {
+        atur_pesan_error(error_msg, "Bulan sudah ditutup");
+        return -1;
+    }
+
+    pastikan_direktori_data();
+    ListTransaksi list;
+    if (!inisialisasi_list_transaksi(&list, 1024)) {
+        atur_pesan_error(error_msg, "Memori tidak cukup");
+        return -1;
+    }
+    if (muat_transaksi_ke_list(&list, bulan) < 0) {
+        bebaskan_list_transaksi(&list);
+        atur_pesan_error(error_msg, "Gagal membaca transaksi");
+        return -1;
+    }
+
+    /* Agregat akhir dari satu lintasan list */
+    RingkasanPeriode *r = (RingkasanPeriode *)calloc(1, sizeof(RingkasanPeriode));
+    if (r == NULL) {
+        bebaskan_list_transaksi(&list);
+        atur_pesan_error(error_msg, "Memori tidak cukup");
+        return -1;
+    }
+    r->bulan = bulan;
+    r->jumlah_transaksi = list.count;
+    r->jumlah_pos = muat_pos_bulan(r->pos, MAX_POS, bulan);
+
+    RingkasanTransaksi ringkasan;
+    memset(&ringkasan, 0, sizeof(ringkasan));
+    for (int j = 0; j < r->jumlah_pos; j++) {
+        r->pos[j].realisasi = 0;
+        r->pos[j].jumlah_transaksi = 0;
+    }
+    for (int i = 0; i < list.count; i++) {
+        akumulasi_transaksi(&list.data[i], r->pos, r->jumlah_pos, &ringkasan);
+    }
+    for (int j = 0; j < r->jumlah_pos; j++) {
+        r->pos[j].sisa = hitung_sisa_pos(r->pos[j].nominal, r->pos[j].realisasi);
+        r->pos[j].status = tentukan_status_pos(r->pos[j].sisa);
+    }
+    isi_analisis_dari_ringkasan(&ringkasan, &r->analisis);
+
+    /* Lintasan pertama menghitung checksum, lintasan kedua menulis */
+    char line[MAX_LINE_LENGTH];
+    unsigned long long hash_agregat = HASH_FNV_AWAL;
+    format_analisis_ke_string(&r->analisis, line, sizeof(line));
+    hash_agregat = hash_baris(hash_agregat, line);
+    for (int j = 0; j < r->jumlah_pos; j++) {
+        format_pos_ke_string(&r->pos[j], line, sizeof(line));
+        hash_agregat = hash_baris(hash_agregat, line);
+    }
+    r->hash_transaksi = hash_daftar_transaksi(&list);
+
+    char filename[MAX_PATH], temp_name[MAX_PATH + 8];
+    dapatkan_nama_file_tutup(bulan, filename, sizeof(filename));
+    snprintf(temp_name, sizeof(temp_name), "%s.tmp", filename);
+
+    int jumlah = list.count;
+    PenulisBaris w;
+    if (!penulis_buka(&w, temp_name)) {
+        atur_pesan_error(error_msg, "Gagal membuat file sementara");
+        jumlah = -1;
+    } else {
+        snprintf(line, sizeof(line), "%s|%d|%d|%d|%d|%016llx|%016llx", PENANDA_TUTUP, VERSI_TUTUP,
+                 bulan, list.count, r->jumlah_pos, hash_agregat, r->hash_transaksi);
+        penulis_tulis_baris(&w, line);
+        format_analisis_ke_string(&r->analisis, line, sizeof(line));
+        penulis_tulis_baris(&w, line);
+        for (int j = 0; j < r->jumlah_pos; j++) {
+            format_pos_ke_string(&r->pos[j], line, sizeof(line));
+            penulis_tulis_baris(&w, line);
+        }
+        for (int i = 0; i < list.count; i++) {
+            format_transaksi_ke_string(&list.data[i], line, sizeof(line));
+            penulis_tulis_baris(&w, line);
+        }
+
+        /* File pos dan analisis disamakan dengan snapshot sebelum periode dikunci */
+        int ok = penulis_tutup(&w);
+        if (ok && r->jumlah_pos > 0) ok = simpan_pos_bulan(r->pos, r->jumlah_pos, bulan);
+        if (ok) ok = simpan_analisis_bulan(bulan, &r->analisis);
+        if (ok) {
+            INSTRUMEN_TAMBAH(INS_RENAME, 1);
+            ok = (rename(temp_name, filename) == 0);
+        }
+        if (!ok) {
+            remove(temp_name);
+            atur_pesan_error(error_msg, "Gagal menulis snapshot");
+            jumlah = -1;
+        }
+    }
+
+    batalkan_cache(bulan);
+    free(r);
+    bebaskan_list_transaksi(&list);
+    return jumlah;
+}
+
+/**
+ * Membuka kembali periode yang ditutup
+ */
+int buka_periode(int bulan, char *error_msg) {
+    INSTRUMEN_FUNGSI();
+    if (bulan < 1 || bulan > 12) {
+        atur_pesan_error(error_msg, "Bulan tidak valid");
+        return 0;
+    }
+    if (!cek_periode_tertutup(bulan)) {
+        atur_pesan_error(error_msg, "Bulan belum ditutup");
+        return 0;
+    }
+
+    char filename[MAX_PATH];
+    dapatkan_nama_file_tutup(bulan, filename, sizeof(filename));
+    int ok = (remove(filename) == 0);
+    batalkan_cache(bulan);
+
+    if (!ok) atur_pesan_error(error_msg, "Gagal menghapus snapshot");
+    return ok;
+}
+
+/**
+ * Memverifikasi snapshot bulan
+ */
+int verifikasi_periode(int bulan) {
+    INSTRUMEN_FUNGSI();
+    if (!cek_periode_tertutup(bulan)) return PERIODE_TERBUKA;
+
+    RingkasanPeriode *r = (RingkasanPeriode *)malloc(sizeof(RingkasanPeriode));
+    if (r == NULL) return PERIODE_RUSAK;
+
+    unsigned long long hash_simpan = 0;
+    FILE *fp = buka_snapshot(bulan, r, &hash_simpan);
+    if (!fp) {
+        free(r);
+        return PERIODE_RUSAK;
+    }
+
+    /* Isi snapshot sendiri: jumlah dan checksum baris transaksi */
+    char line[MAX_LINE_LENGTH];
+    unsigned long long hash = 0;
+    int jumlah = 0;
+    while (fgets(line, sizeof(line), fp)) {
+        hapus_newline_string(line);
+        if (line[0] == '\0') continue;
+        hash += hash_baris(HASH_FNV_AWAL, line);
+        jumlah++;
+    }
+    fclose(fp);
+
+    int hasil = (jumlah == r->jumlah_transaksi && hash == hash_simpan) ? PERIODE_TERTUTUP : PERIODE_RUSAK;
+
+    /* Transaksi saat ini di file data harus sama dengan yang dibekukan */
+    ListTransaksi list;
+    if (hasil == PERIODE_TERTUTUP && inisialisasi_list_transaksi(&list, 1024)) {
+        if (muat_transaksi_ke_list(&list, bulan) < 0 || list.count != r->jumlah_transaksi ||
+            hash_daftar_transaksi(&list) != hash_simpan) {
+            hasil = PERIODE_BERUBAH;
+        }
+        bebaskan_list_transaksi(&list);
+    }
+
+    free(r);
+    return hasil;
+}
@@ -13,7 +13,6 @@
  * - Operasi CRUD (Create, Read, Update, Delete) untuk pos anggaran
  * - Perhitungan realisasi dan sisa anggaran per pos
  * - Penentuan status pos (Aman/Tidak Aman berdasarkan budget)
- * - Tampilan interaktif untuk manajemen pos anggaran
  * - Validasi data pos anggaran
  *
  * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
@@ -22,11 +21,14 @@
  * - ctype.h  : Untuk fungsi tolower dalam validasi
  * - pos.h    : Header file modul ini
  * - file.h   : Untuk operasi penyimpanan dan pembacaan file pos
- * - tui.h    : Untuk tampilan antarmuka pengguna
  * - utils.h  : Untuk fungsi utilitas string dan formatting
+ * - pekerja.h   : Untuk sinkronisasi pos di latar belakang
+ * - periode.h   : Untuk realisasi akhir bulan yang ditutup dan penolakan perubahannya
+ * - instrumen.h : Untuk timer perhitungan pos dan akuntansi aksi pengguna
  *
  * CATATAN:
  * Fungsi validasi pos telah dipindahkan dari validator.c ke modul ini.
+ * Layar TUI pos anggaran berada di layar_pos.c.
  * Setiap pos anggaran memiliki batas nominal dan status yang otomatis
  * dikalkulasi berdasarkan transaksi pengeluaran yang terkait.
  * =============================================================================
@@ -37,17 +39,10 @@
 #include <ctype.h>
 #include "pos.h"
 #include "file.h"
-#include "tui.h"
 #include "utils.h"
-
-/* ===== KONSTANTA LOKAL ===== */
-/* Aksi Menu */
-#define ACT_VIEW    1
-#define ACT_TAMBAH  2
-#define ACT_EDIT    3
-#define ACT_HAPUS   4
-#define ACT_BULAN   5
-#define ACT_KEMBALI 0
+#include "pekerja.h"
+#include "periode.h"
+#include "instrumen.h"
 
 /* ===== FUNGSI HELPER INTERNAL ===== */
 
@@ -62,27 +57,96 @@ static void atur_pesan_error(char *error_msg, const char *msg) {
     }
 }
 
+/**
+ * Helper: Konteks kalkulasi semua pos selama penelusuran transaksi
+ */
+typedef struct {
+    PosAnggaran *list;
+    int count;
+} KonteksKalkulasiPos;
+
+/**
+ * Helper: Pengunjung yang menambahkan satu transaksi ke pos yang sesuai
+ */
+static int kunjungi_kalkulasi_pos(const Transaksi *trx, void *konteks) {
+    KonteksKalkulasiPos *k = (KonteksKalkulasiPos *)konteks;
+    akumulasi_transaksi(trx, k->list, k->count, NULL);
+    return 1;
+}
+
+/**
+ * Helper: Menghitung kalkulasi semua pos dari transaksi bulan
+ * (satu kali baca file untuk seluruh pos, bukan dua kali per pos)
+ */
+static void hitung_kalkulasi_dari_transaksi(PosAnggaran *list, int count, int bulan) {
+    INSTRUMEN_FUNGSI();
+    for (int i = 0; i < count; i++) {
+        list[i].realisasi = 0;
+        list[i].jumlah_transaksi = 0;
+    }
+
+    /* Bulan yang ditutup: realisasi akhir dari snapshot tanpa membaca transaksi */
+    RingkasanPeriode periode;
+    if (ambil_ringkasan_periode(bulan, &periode)) {
+        for (int i = 0; i < count; i++) {
+            for (int j = 0; j < periode.jumlah_pos; j++) {
+                if (banding_string_tanpa_case(list[i].nama, periode.pos[j].nama) != 0) continue;
+                list[i].realisasi = periode.pos[j].realisasi;
+                list[i].jumlah_transaksi = periode.pos[j].jumlah_transaksi;
+                break;
+            }
+        }
+    } else {
+        KonteksKalkulasiPos k = { list, count };
+        telusuri_transaksi(bulan, kunjungi_kalkulasi_pos, &k);
+    }
+
+    for (int i = 0; i < count; i++) {
+        list[i].sisa = hitung_sisa_pos(list[i].nominal, list[i].realisasi);
+        list[i].status = tentukan_status_pos(list[i].sisa);
+    }
+}
+
 /* ===== IMPLEMENTASI PERHITUNGAN POS ===== */
 
 /**
  * Menghitung realisasi pos dari transaksi
  */
 unsigned long long hitung_realisasi_pos(const char *nama_pos, int bulan) {
+    INSTRUMEN_FUNGSI();
     if (!nama_pos || bulan < 1 || bulan > 12) return 0;
 
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi_bulan(list, MAX_TRANSAKSI, bulan);
+    /* Realisasi hanya menghitung pengeluaran untuk pos yang sesuai */
+    PosAnggaran pos;
+    memset(&pos, 0, sizeof(PosAnggaran));
+    salin_string_aman(pos.nama, nama_pos, sizeof(pos.nama));
+    hitung_kalkulasi_dari_transaksi(&pos, 1, bulan);
 
-    unsigned long long total = 0;
-    for (int i = 0; i < count; i++) {
-        /* Hanya hitung pengeluaran untuk pos yang sesuai */
-        if (list[i].jenis == JENIS_PENGELUARAN &&
-            banding_string_tanpa_case(list[i].pos, nama_pos) == 0) {
-            total += list[i].nominal;
+    return pos.realisasi;
+}
+
+/**
+ * Menambahkan satu transaksi ke ringkasan dan pos yang sesuai
+ */
+void akumulasi_transaksi(const Transaksi *trx, PosAnggaran *pos, int count, RingkasanTransaksi *ringkasan) {
+    if (!trx) return;
+
+    if (ringkasan) {
+        if (trx->jenis == JENIS_PEMASUKAN) {
+            ringkasan->total_pemasukan += trx->nominal;
+            ringkasan->jumlah_pemasukan++;
+        } else if (trx->jenis == JENIS_PENGELUARAN) {
+            ringkasan->total_pengeluaran += trx->nominal;
+            ringkasan->jumlah_pengeluaran++;
         }
     }
 
-    return total;
+    for (int i = 0; i < count; i++) {
+        if (banding_string_tanpa_case(trx->pos, pos[i].nama) != 0) continue;
+        pos[i].jumlah_transaksi++;
+        if (trx->jenis == JENIS_PENGELUARAN) pos[i].realisasi += trx->nominal;
+        break;
+    }
 }
 
 /**
@@ -103,25 +167,18 @@ int tentukan_status_pos(long long sisa) {
  * Mengupdate kalkulasi untuk satu pos
  */
 void update_kalkulasi_pos(PosAnggaran *pos, int bulan) {
+    INSTRUMEN_FUNGSI();
     if (!pos || bulan < 1 || bulan > 12) return;
 
-    /* Hitung realisasi dari transaksi */
-    pos->realisasi = hitung_realisasi_pos(pos->nama, bulan);
-
-    /* Hitung sisa */
-    pos->sisa = hitung_sisa_pos(pos->nominal, pos->realisasi);
-
-    /* Tentukan status */
-    pos->status = tentukan_status_pos(pos->sisa);
-
-    /* Hitung jumlah transaksi */
-    pos->jumlah_transaksi = hitung_jumlah_transaksi_pos(pos->nama, bulan);
+    /* Realisasi, jumlah transaksi, sisa, dan status dari satu lintasan file */
+    hitung_kalkulasi_dari_transaksi(pos, 1, bulan);
 }
 
 /**
  * Mengupdate kalkulasi untuk semua pos dalam bulan
  */
 int update_semua_pos_bulan(int bulan) {
+    INSTRUMEN_FUNGSI();
     if (bulan < 1 || bulan > 12) return 0;
 
     PosAnggaran list[MAX_POS];
@@ -129,10 +186,8 @@ int update_semua_pos_bulan(int bulan) {
 
     if (count == 0) return 1;  /* Tidak ada pos, sukses */
 
-    /* Update kalkulasi untuk setiap pos */
-    for (int i = 0; i < count; i++) {
-        update_kalkulasi_pos(&list[i], bulan);
-    }
+    /* Update kalkulasi semua pos dari satu kali baca transaksi */
+    hitung_kalkulasi_dari_transaksi(list, count, bulan);
 
     /* Simpan kembali */
     return simpan_pos_bulan(list, count, bulan);
@@ -142,25 +197,22 @@ int update_semua_pos_bulan(int bulan) {
  * Menghitung jumlah transaksi untuk pos dalam bulan
  */
 int hitung_jumlah_transaksi_pos(const char *nama_pos, int bulan) {
+    INSTRUMEN_FUNGSI();
     if (!nama_pos || bulan < 1 || bulan > 12) return 0;
 
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi_bulan(list, MAX_TRANSAKSI, bulan);
-
-    int total = 0;
-    for (int i = 0; i < count; i++) {
-        if (banding_string_tanpa_case(list[i].pos, nama_pos) == 0) {
-            total++;
-        }
-    }
+    PosAnggaran pos;
+    memset(&pos, 0, sizeof(PosAnggaran));
+    salin_string_aman(pos.nama, nama_pos, sizeof(pos.nama));
+    hitung_kalkulasi_dari_transaksi(&pos, 1, bulan);
 
-    return total;
+    return pos.jumlah_transaksi;
 }
 
 /**
  * Menghitung total anggaran semua pos dalam bulan
  */
 unsigned long long hitung_total_anggaran(int bulan) {
+    INSTRUMEN_FUNGSI();
     if (bulan < 1 || bulan > 12) return 0;
 
     PosAnggaran list[MAX_POS];
@@ -178,15 +230,14 @@ unsigned long long hitung_total_anggaran(int bulan) {
  * Menghitung total realisasi semua pos dalam bulan
  */
 unsigned long long hitung_total_realisasi(int bulan) {
+    INSTRUMEN_FUNGSI();
     if (bulan < 1 || bulan > 12) return 0;
 
     PosAnggaran list[MAX_POS];
     int count = muat_pos_bulan(list, MAX_POS, bulan);
 
     /* Update kalkulasi dulu */
-    for (int i = 0; i < count; i++) {
-        update_kalkulasi_pos(&list[i], bulan);
-    }
+    hitung_kalkulasi_dari_transaksi(list, count, bulan);
 
     unsigned long long total = 0;
     for (int i = 0; i < count; i++) {
@@ -196,16 +247,30 @@ unsigned long long hitung_total_realisasi(int bulan) {
     return total;
 }
 
+/**
+ * Menyinkronisasi kalkulasi pos dengan transaksi
+ */
+int sinkronisasi_pos_transaksi(int bulan) {
+    INSTRUMEN_FUNGSI();
+    return update_semua_pos_bulan(bulan);
+}
+
 /* ===== IMPLEMENTASI CRUD POS ===== */
 
 /**
  * Menambahkan pos anggaran baru dengan validasi
  */
 int tambah_pos(const char *nama, unsigned long long nominal, int bulan, char *error_msg) {
+    INSTRUMEN_FUNGSI();
+    INSTRUMEN_AKSI(AKSI_TAMBAH_POS);
     if (!nama || bulan < 1 || bulan > 12) {
         atur_pesan_error(error_msg, "Parameter tidak valid");
         return 0;
     }
+    if (cek_periode_tertutup(bulan)) {
+        atur_pesan_error(error_msg, "Bulan sudah ditutup");
+        return 0;
+    }
 
     /* Validasi nama */
     if (!validasi_tidak_kosong(nama)) {
@@ -249,6 +314,7 @@ int tambah_pos(const char *nama, unsigned long long nominal, int bulan, char *er
         return 0;
     }
 
+    INSTRUMEN_AKSI_SELESAI(AKSI_TAMBAH_POS, ukuran_baris_pos(&pos));
     return 1;
 }
 
@@ -256,10 +322,16 @@ int tambah_pos(const char *nama, unsigned long long nominal, int bulan, char *er
  * Mengedit pos anggaran dengan validasi
  */
 int ubah_pos(int no, const char *nama_baru, unsigned long long nominal_baru, int bulan, char *error_msg) {
+    INSTRUMEN_FUNGSI();
+    INSTRUMEN_AKSI(AKSI_UBAH_POS);
     if (no <= 0 || bulan < 1 || bulan > 12) {
         atur_pesan_error(error_msg, "Parameter tidak valid");
         return 0;
     }
+    if (cek_periode_tertutup(bulan)) {
+        atur_pesan_error(error_msg, "Bulan sudah ditutup");
+        return 0;
+    }
 
     /* Load pos yang akan diedit */
     PosAnggaran pos;
@@ -305,6 +377,7 @@ int ubah_pos(int no, const char *nama_baru, unsigned long long nominal_baru, int
         return 0;
     }
 
+    INSTRUMEN_AKSI_SELESAI(AKSI_UBAH_POS, ukuran_baris_pos(&pos));
     return 1;
 }
 
@@ -312,10 +385,16 @@ int ubah_pos(int no, const char *nama_baru, unsigned long long nominal_baru, int
  * Menghapus pos anggaran dengan validasi
  */
 int hapus_pos(int no, int bulan, char *error_msg) {
+    INSTRUMEN_FUNGSI();
+    INSTRUMEN_AKSI(AKSI_HAPUS_POS);
     if (no <= 0 || bulan < 1 || bulan > 12) {
         atur_pesan_error(error_msg, "Parameter tidak valid");
         return 0;
     }
+    if (cek_periode_tertutup(bulan)) {
+        atur_pesan_error(error_msg, "Bulan sudah ditutup");
+        return 0;
+    }
 
     /* Load pos yang akan dihapus */
     PosAnggaran pos;
@@ -351,6 +430,7 @@ int hapus_pos(int no, int bulan, char *error_msg) {
         return 0;
     }
 
+    INSTRUMEN_AKSI_SELESAI(AKSI_HAPUS_POS, ukuran_baris_pos(&pos));
     return 1;
 }
 
@@ -358,14 +438,14 @@ int hapus_pos(int no, int bulan, char *error_msg) {
  * Mengambil daftar pos untuk bulan dengan kalkulasi terbaru
  */
 int ambil_daftar_pos(PosAnggaran *list, int max_count, int bulan) {
+    INSTRUMEN_FUNGSI();
     if (!list || max_count <= 0 || bulan < 1 || bulan > 12) return 0;
 
     int count = muat_pos_bulan(list, max_count, bulan);
+    if (count == 0) return 0;
 
-    /* Update kalkulasi untuk setiap pos */
-    for (int i = 0; i < count; i++) {
-        update_kalkulasi_pos(&list[i], bulan);
-    }
+    /* Update kalkulasi semua pos dari satu kali baca transaksi */
+    hitung_kalkulasi_dari_transaksi(list, count, bulan);
 
     return count;
 }
@@ -384,6 +464,25 @@ int ambil_pos_berdasarkan_nomor(int no, int bulan, PosAnggaran *result) {
     return 1;
 }
 
+/**
+ * Mengambil snapshot pos beserta total ringkasannya
+ */
+int ambil_snapshot_pos(SnapshotPos *snap, int bulan) {
+    INSTRUMEN_FUNGSI();
+    if (!snap || bulan < 1 || bulan > 12) return 0;
+
+    memset(snap, 0, sizeof(SnapshotPos));
+    snap->bulan = bulan;
+    snap->count = ambil_daftar_pos(snap->list, MAX_POS, bulan);
+
+    for (int i = 0; i < snap->count; i++) {
+        snap->total_anggaran += snap->list[i].nominal;
+        snap->total_realisasi += snap->list[i].realisasi;
+    }
+
+    return 1;
+}
+
 /**
  * Mengambil daftar nama pos untuk dropdown/pilihan
  */
@@ -416,533 +515,10 @@ int cek_pos_ada(const char *nama, int bulan) {
  * Me-refresh kalkulasi semua pos untuk bulan
  */
 int segarkan_pos(int bulan) {
+    INSTRUMEN_FUNGSI();
     return update_semua_pos_bulan(bulan);
 }
 
-/* ===== IMPLEMENTASI TAMPILAN POS ===== */
-
-int tampilkan_daftar_pos(int bulan, int selected) {
-    PosAnggaran list[MAX_POS];
-    int count = ambil_daftar_pos(list, MAX_POS, bulan);
-
-    /* Tampilkan header bulan */
-    char title[64];
-    snprintf(title, sizeof(title), "Pos Anggaran - %s", dapatkan_nama_bulan(bulan));
-
-    tui_aktifkan_warna(COLOR_PAIR_CYAN);
-    tui_aktifkan_tebal();
-    tui_cetak(4, 2, title);
-    tui_nonaktifkan_tebal();
-    tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
-
-    return tampilkan_tabel_pos(list, count, 6, selected);
-}
-
-int tampilkan_detail_pos(PosAnggaran *pos, int start_y) {
-    if (!pos) return start_y;
-
-    int y = start_y;
-    char buffer[64];
-
-    tui_aktifkan_tebal();
-    tui_aktifkan_warna(COLOR_PAIR_CYAN);
-    tui_cetak(y++, 2, "Detail Pos Anggaran");
-    tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
-    tui_nonaktifkan_tebal();
-
-    tui_gambar_garis_horizontal(y++, 2, 50, '-');
-
-    tui_cetakf(y++, 2, "Nomor       : %d", pos->no);
-    tui_cetakf(y++, 2, "Nama        : %s", pos->nama);
-
-    format_rupiah(pos->nominal, buffer);
-    tui_cetakf(y++, 2, "Anggaran    : %s", buffer);
-
-    format_rupiah(pos->realisasi, buffer);
-    tui_cetakf(y++, 2, "Realisasi   : %s", buffer);
-
-    format_saldo(pos->sisa, buffer);
-    tui_cetak(y, 2, "Sisa        : ");
-    if (pos->sisa < 0) {
-        tui_aktifkan_warna(COLOR_PAIR_RED);
-    } else {
-        tui_aktifkan_warna(COLOR_PAIR_GREEN);
-    }
-    tui_cetak(y++, 16, buffer);
-    tui_nonaktifkan_warna(pos->sisa < 0 ? COLOR_PAIR_RED : COLOR_PAIR_GREEN);
-
-    tui_cetakf(y++, 2, "Transaksi   : %d", pos->jumlah_transaksi);
-
-    tui_cetak(y, 2, "Status      : ");
-    if (pos->status == STATUS_AMAN) {
-        tui_aktifkan_warna(COLOR_PAIR_GREEN);
-        tui_cetak(y++, 16, "AMAN");
-    } else {
-        tui_aktifkan_warna(COLOR_PAIR_RED);
-        tui_cetak(y++, 16, "TIDAK AMAN");
-    }
-    tui_reset_atribut();
-
-    return y + 1;
-}
-
-int tampilkan_ringkasan_pos(int bulan, int start_y) {
-    int y = start_y;
-    char buffer[64];
-
-    unsigned long long total_anggaran = hitung_total_anggaran(bulan);
-    unsigned long long total_realisasi = hitung_total_realisasi(bulan);
-    long long total_sisa = (long long)total_anggaran - (long long)total_realisasi;
-
-    tui_gambar_garis_horizontal(y++, 2, 60, '=');
-
-    tui_aktifkan_tebal();
-    tui_cetak(y++, 2, "RINGKASAN:");
-    tui_nonaktifkan_tebal();
-
-    format_rupiah(total_anggaran, buffer);
-    tui_cetakf(y++, 2, "Total Anggaran  : %s", buffer);
-
-    format_rupiah(total_realisasi, buffer);
-    tui_cetakf(y++, 2, "Total Realisasi : %s", buffer);
-
-    format_saldo(total_sisa, buffer);
-    tui_cetak(y, 2, "Total Sisa      : ");
-    if (total_sisa < 0) {
-        tui_aktifkan_warna(COLOR_PAIR_RED);
-    } else {
-        tui_aktifkan_warna(COLOR_PAIR_GREEN);
-    }
-    tui_cetak(y++, 20, buffer);
-    tui_reset_atribut();
-
-    return y + 1;
-}
-
-int tampilkan_form_tambah_pos(int bulan) {
-    tui_hapus_layar();
-    tampilkan_header("TAMBAH POS ANGGARAN");
-
-    char nama[MAX_POS_LENGTH + 1];
-    unsigned long long nominal;
-
-    int y = 5;
-
-    char bulan_info[64];
-    snprintf(bulan_info, sizeof(bulan_info), "Bulan: %s", dapatkan_nama_bulan(bulan));
-    tui_cetak(y++, 2, bulan_info);
-    y++;
-
-    /* Input nama */
-    if (!masukan_string_wajib(y++, 2, "Nama Pos: ", nama, sizeof(nama))) {
-        return 0;
-    }
-
-    /* Input nominal */
-    if (!masukan_angka_min(y++, 2, "Anggaran: Rp ", &nominal, 1)) {
-        return 0;
-    }
-
-    /* Konfirmasi */
-    y++;
-    if (!masukan_konfirmasi(y, 2, "Simpan pos anggaran?")) {
-        tampilkan_info("Dibatalkan");
-        return 0;
-    }
-
-    /* Simpan */
-    char error_msg[100];
-    if (tambah_pos(nama, nominal, bulan, error_msg)) {
-        tampilkan_sukses("Pos anggaran berhasil ditambahkan");
-        return 1;
-    } else {
-        tampilkan_error("%s", error_msg);
-        return 0;
-    }
-}
-
-int tampilkan_form_edit_pos(int no, int bulan) {
-    PosAnggaran pos;
-    if (!ambil_pos_berdasarkan_nomor(no, bulan, &pos)) {
-        tampilkan_error("Pos tidak ditemukan");
-        return 0;
-    }
-
-    tui_hapus_layar();
-    tampilkan_header("EDIT POS ANGGARAN");
-
-    int y = 5;
-
-    /* Tampilkan data saat ini */
-    tui_cetak(y++, 2, "Data saat ini:");
-    tui_cetakf(y++, 2, "  Nama    : %s", pos.nama);
-    char nominal_str[30];
-    format_rupiah(pos.nominal, nominal_str);
-    tui_cetakf(y++, 2, "  Anggaran: %s", nominal_str);
-    y++;
-
-    tui_cetak(y++, 2, "Masukkan data baru (kosongkan jika tidak diubah):");
-    y++;
-
-    char nama_baru[MAX_POS_LENGTH + 1];
-    unsigned long long nominal_baru = 0;
-
-    /* Input nama baru */
-    if (!masukan_string(y++, 2, "Nama baru: ", nama_baru, sizeof(nama_baru))) {
-        return 0;
-    }
-
-    /* Input nominal baru */
-    char nominal_input[32];
-    if (!masukan_string(y++, 2, "Anggaran baru: Rp ", nominal_input, sizeof(nominal_input))) {
-        return 0;
-    }
-    if (strlen(nominal_input) > 0) {
-        urai_nominal(nominal_input, &nominal_baru);
-    }
-
-    /* Cek apakah ada perubahan */
-    if (strlen(nama_baru) == 0 && nominal_baru == 0) {
-        tampilkan_info("Tidak ada perubahan");
-        return 0;
-    }
-
-    /* Konfirmasi */
-    y++;
-    if (!masukan_konfirmasi(y, 2, "Simpan perubahan?")) {
-        tampilkan_info("Dibatalkan");
-        return 0;
-    }
-
-    /* Simpan */
-    char error_msg[100];
-    const char *nama_param = strlen(nama_baru) > 0 ? nama_baru : NULL;
-
-    if (ubah_pos(no, nama_param, nominal_baru, bulan, error_msg)) {
-        tampilkan_sukses("Pos anggaran berhasil diupdate");
-        return 1;
-    } else {
-        tampilkan_error("%s", error_msg);
-        return 0;
-    }
-}
-
-int tampilkan_konfirmasi_hapus_pos(int no, int bulan) {
-    PosAnggaran pos;
-    if (!ambil_pos_berdasarkan_nomor(no, bulan, &pos)) {
-        tampilkan_error("Pos tidak ditemukan");
-        return 0;
-    }
-
-    /* Cek apakah bisa dihapus */
-    if (pos.jumlah_transaksi > 0) {
-        tampilkan_error("Pos tidak bisa dihapus karena masih ada %d transaksi", pos.jumlah_transaksi);
-        return 0;
-    }
-
-    char msg[100];
-    snprintf(msg, sizeof(msg), "Hapus pos '%s'?", pos.nama);
-
-    if (!tampilkan_konfirmasi(msg)) {
-        tampilkan_info("Dibatalkan");
-        return 0;
-    }
-
-    char error_msg[100];
-    if (hapus_pos(no, bulan, error_msg)) {
-        tampilkan_sukses("Pos anggaran berhasil dihapus");
-        return 1;
-    } else {
-        tampilkan_error("%s", error_msg);
-        return 0;
-    }
-}
-
-int tampilkan_pilih_pos(int bulan, char *result) {
-    if (!result) return 0;
-
-    PosAnggaran list[MAX_POS];
-    int count = ambil_daftar_pos(list, MAX_POS, bulan);
-
-    if (count == 0) {
-        tampilkan_peringatan("Belum ada pos anggaran untuk bulan ini");
-        return 0;
-    }
-
-    Menu menu;
-    menu_inisialisasi(&menu, "Pilih Pos Anggaran");
-
-    for (int i = 0; i < count; i++) {
-        menu_tambah_item(&menu, list[i].nama, i + 1);
-    }
-
-    int pilihan = menu_navigasi(&menu);
-
-    if (pilihan == CANCEL || pilihan <= 0) {
-        return 0;
-    }
-
-    salin_string_aman(result, list[pilihan - 1].nama, MAX_POS_LENGTH + 1);
-    return 1;
-}
-
-/* ===== IMPLEMENTASI HANDLER POS ===== */
-
-/**
- * Jalankan modul pos anggaran
- */
-void jalankan_modul_pos(int bulan_awal) {
-    int bulan = bulan_awal;
-
-    /* Inisialisasi pos untuk bulan jika belum ada */
-    inisialisasi_pos_untuk_bulan(bulan);
-
-    while (1) {
-        /* Sinkronisasi kalkulasi */
-        sinkronisasi_pos_transaksi(bulan);
-
-        int action = menu_pos_utama(bulan);
-
-        switch (action) {
-            case ACT_VIEW:
-                penanganan_lihat_pos(bulan);
-                break;
-
-            case ACT_TAMBAH:
-                penanganan_tambah_pos(bulan);
-                break;
-
-            case ACT_EDIT:
-                penanganan_ubah_pos(bulan);
-                break;
-
-            case ACT_HAPUS:
-                penanganan_hapus_pos(bulan);
-                break;
-
-            case ACT_KEMBALI:
-            case CANCEL:
-                return;
-        }
-    }
-}
-
-/**
- * Inisialisasi data pos untuk bulan baru
- */
-int inisialisasi_pos_untuk_bulan(int bulan) {
-    if (bulan < 1 || bulan > 12) return 0;
-
-    /* Cek apakah sudah ada file */
-    if (cek_file_pos_ada(bulan)) {
-        return 1;  /* Sudah ada */
-    }
-
-    /* Cek bulan sebelumnya */
-    int bulan_sebelum = (bulan == 1) ? 12 : bulan - 1;
-
-    if (cek_file_pos_ada(bulan_sebelum)) {
-        /* Tanyakan apakah mau copy dari bulan sebelumnya */
-        char msg[100];
-        snprintf(msg, sizeof(msg),
-                 "Copy pos dari %s ke %s?",
-                 dapatkan_nama_bulan(bulan_sebelum),
-                 dapatkan_nama_bulan(bulan));
-
-        if (tampilkan_konfirmasi(msg)) {
-            if (salin_pos_dari_bulan(bulan, bulan_sebelum)) {
-                tampilkan_sukses("Pos berhasil dicopy");
-                return 1;
-            } else {
-                tampilkan_error("Gagal copy pos");
-            }
-        }
-    }
-
-    /* Buat file pos kosong */
-    return inisialisasi_pos_bulan(bulan);
-}
-
-/**
- * Menyinkronisasi kalkulasi pos dengan transaksi
- */
-int sinkronisasi_pos_transaksi(int bulan) {
-    return update_semua_pos_bulan(bulan);
-}
-
-/**
- * Menampilkan menu utama pos anggaran
- */
-int menu_pos_utama(int bulan) {
-    char title[64];
-    snprintf(title, sizeof(title), "Menu Pos Anggaran - %s", dapatkan_nama_bulan(bulan));
-
-    Menu menu;
-    menu_inisialisasi(&menu, title);
-
-    menu_tambah_item(&menu, "Lihat Daftar Pos", ACT_VIEW);
-    menu_tambah_item(&menu, "Tambah Pos Baru", ACT_TAMBAH);
-    menu_tambah_item(&menu, "Edit Pos", ACT_EDIT);
-    menu_tambah_item(&menu, "Hapus Pos", ACT_HAPUS);
-
-    return menu_navigasi(&menu);
-}
-
-/**
- * Menampilkan menu pilih bulan
- */
-int menu_pilih_bulan(int bulan_saat_ini) {
-    Menu menu;
-    menu_inisialisasi(&menu, "Pilih Bulan");
-
-    for (int i = 1; i <= 12; i++) {
-        char item[32];
-        if (i == bulan_saat_ini) {
-            snprintf(item, sizeof(item), "%s (aktif)", dapatkan_nama_bulan(i));
-        } else {
-            snprintf(item, sizeof(item), "%s", dapatkan_nama_bulan(i));
-        }
-        menu_tambah_item(&menu, item, i);
-    }
-
-    int pilihan = menu_navigasi(&menu);
-
-    if (pilihan == CANCEL) {
-        return bulan_saat_ini;  /* Tetap di bulan sekarang */
-    }
-
-    return pilihan;
-}
-
-/**
- * Handler untuk view daftar pos dengan navigasi
- */
-void penanganan_lihat_pos(int bulan) {
-    int selected = 0;
-    PosAnggaran list[MAX_POS];
-    int count = ambil_daftar_pos(list, MAX_POS, bulan);
-
-    while (1) {
-        tui_hapus_layar();
-        tampilkan_header("DAFTAR POS ANGGARAN");
-
-        int next_y = tampilkan_daftar_pos(bulan, selected);
-        next_y = tampilkan_ringkasan_pos(bulan, next_y);
-
-        tampilkan_footer("ATAS/BAWAH: Navigasi | ENTER: Detail | ESC: Kembali");
-        tui_segarkan();
-
-        int ch = tui_ambil_karakter();
-
-        switch (ch) {
-            case KEY_UP:
-            case 'k':
-                if (selected > 0) selected--;
-                break;
-
-            case KEY_DOWN:
-            case 'j':
-                if (selected < count - 1) selected++;
-                break;
-
-            case KEY_ENTER:
-            case '\n':
-            case '\r':
-                if (count > 0) {
-                    tui_hapus_layar();
-                    tampilkan_header("DETAIL POS ANGGARAN");
-                    tampilkan_detail_pos(&list[selected], 5);
-                    tampilkan_footer("Tekan sembarang tombol untuk kembali");
-                    tui_segarkan();
-                    tui_ambil_karakter();
-
-                    /* Reload list */
-                    count = ambil_daftar_pos(list, MAX_POS, bulan);
-                    if (selected >= count) selected = count - 1;
-                    if (selected < 0) selected = 0;
-                }
-                break;
-
-            case 27:  /* ESC */
-                return;
-        }
-    }
-}
-
-/**
- * Handler untuk tambah pos baru
- */
-void penanganan_tambah_pos(int bulan) {
-    tampilkan_form_tambah_pos(bulan);
-}
-
-/**
- * Handler untuk edit pos
- */
-void penanganan_ubah_pos(int bulan) {
-    PosAnggaran list[MAX_POS];
-    int count = ambil_daftar_pos(list, MAX_POS, bulan);
-
-    if (count == 0) {
-        tampilkan_peringatan("Belum ada pos anggaran");
-        return;
-    }
-
-    /* Pilih pos untuk diedit */
-    Menu menu;
-    menu_inisialisasi(&menu, "Pilih Pos untuk Diedit");
-
-    for (int i = 0; i < count; i++) {
-        char item[64];
-        snprintf(item, sizeof(item), "%d. %s", list[i].no, list[i].nama);
-        menu_tambah_item(&menu, item, list[i].no);
-    }
-
-    int pilihan = menu_navigasi(&menu);
-
-    if (pilihan == CANCEL || pilihan <= 0) {
-        return;
-    }
-
-    tampilkan_form_edit_pos(pilihan, bulan);
-}
-
-/**
- * Handler untuk hapus pos
- */
-void penanganan_hapus_pos(int bulan) {
-    PosAnggaran list[MAX_POS];
-    int count = ambil_daftar_pos(list, MAX_POS, bulan);
-
-    if (count == 0) {
-        tampilkan_peringatan("Belum ada pos anggaran");
-        return;
-    }
-
-    /* Pilih pos untuk dihapus */
-    Menu menu;
-    menu_inisialisasi(&menu, "Pilih Pos untuk Dihapus");
-
-    for (int i = 0; i < count; i++) {
-        char item[64];
-        if (list[i].jumlah_transaksi > 0) {
-            snprintf(item, sizeof(item), "%d. %s (ada %d transaksi)",
-                     list[i].no, list[i].nama, list[i].jumlah_transaksi);
-        } else {
-            snprintf(item, sizeof(item), "%d. %s", list[i].no, list[i].nama);
-        }
-        menu_tambah_item(&menu, item, list[i].no);
-    }
-
-    int pilihan = menu_navigasi(&menu);
-
-    if (pilihan == CANCEL || pilihan <= 0) {
-        return;
-    }
-
-    tampilkan_konfirmasi_hapus_pos(pilihan, bulan);
-}
-
 /* ===== IMPLEMENTASI FUNGSI VALIDASI POS (dipindahkan dari validator.c) ===== */
 
 /**
@@ -0,0 +1,269 @@
+/*
+ * =============================================================================
+ * File        : rekap.c
+ * Deskripsi   : Implementasi modul rekap tahunan (agregasi paralel)
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * Modul ini mengimplementasikan perhitungan ulang seluruh bulan dengan kolam
+ * thread. Pekerjaan dipecah menjadi tiga batch:
+ * 1. Memuat pos 12 bulan (satu tugas per bulan)
+ * 2. Mengagregasi potongan transaksi ke hasil parsial milik potongan itu
+ * 3. Menyimpan pos dan analisis per bulan (satu tugas per bulan)
+ * Di antara batch 2 dan 3, hasil parsial digabung berurutan di thread
+ * pemanggil.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdlib.h, string.h : Untuk calloc dan memset
+ * - rekap.h     : Header file modul ini
+ * - transaksi.h : Untuk ListTransaksi dan RingkasanTransaksi
+ * - file.h      : Untuk muat/simpan pos, simpan analisis, dan muat transaksi
+ * - pos.h       : Untuk akumulasi_transaksi (lewat file.h)
+ * - utils.h     : Untuk urai_tanggal_struct dan salin_string_aman
+ * - kolam.h     : Untuk menjalankan batch tugas
+ * - periode.h   : Untuk agregat akhir bulan yang ditutup
+ * - instrumen.h : Untuk timer fungsi
+ *
+ * CATATAN:
+ * Setiap transaksi diagregasi dengan akumulasi_transaksi (pos.c) ke salinan
+ * pos milik potongan. Bulan transaksi diambil dengan urai_tanggal_struct
+ * seperti filter bulan telusuri_transaksi.
+ * =============================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "rekap.h"
+#include "transaksi.h"
+#include "file.h"
+#include "utils.h"
+#include "kolam.h"
+#include "periode.h"
+#include "instrumen.h"
+
+/* ===== STRUKTUR DATA LOKAL ===== */
+
+/**
+ * Struct hasil parsial satu potongan transaksi
+ */
+typedef struct {
+    RingkasanTransaksi ringkasan[12];               /* Ringkasan per bulan */
+    PosAnggaran pos[12][MAX_POS];                   /* Salinan pos dengan realisasi potongan */
+} ParsialRekap;
+
+/**
+ * Struct konteks bersama untuk tugas rekap
+ */
+typedef struct {
+    RekapTahunan *rekap;
+    const ListTransaksi *transaksi;
+    ParsialRekap *parsial;          /* Satu per potongan */
+    int jumlah_potongan;
+    const int *dipilih;             /* Bulan yang disimpan (indeks 1-12) */
+    int *status;                    /* Status simpan per bulan (indeks 1-12) */
+} KonteksRekap;
+
+/* ===== FUNGSI HELPER INTERNAL ===== */
+
+/**
+ * Helper: Tugas batch 1, memuat pos satu bulan
+ */
+static void tugas_muat_pos(void *konteks, int indeks) {
+    KonteksRekap *k = (KonteksRekap *)konteks;
+    k->rekap->jumlah_pos[indeks] = muat_pos_bulan(k->rekap->pos[indeks], MAX_POS, indeks + 1);
+}
+
+/**
+ * Helper: Tugas batch 2, mengagregasi satu potongan transaksi
+ */
+static void tugas_agregasi(void *konteks, int indeks) {
+    KonteksRekap *k = (KonteksRekap *)konteks;
+    const RekapTahunan *rekap = k->rekap;
+    ParsialRekap *p = &k->parsial[indeks];
+    int n = k->transaksi->count;
+    int awal = (int)((long long)n * indeks / k->jumlah_potongan);
+    int akhir = (int)((long long)n * (indeks + 1) / k->jumlah_potongan);
+
+    /* Nama pos disalin agar pencocokan tidak menyentuh rekap bersama */
+    for (int b = 0; b < 12; b++) {
+        for (int j = 0; j < rekap->jumlah_pos[b]; j++) {
+            salin_string_aman(p->pos[b][j].nama, rekap->pos[b][j].nama, sizeof(p->pos[b][j].nama));
+        }
+    }
+
+    for (int i = awal; i < akhir; i++) {
+        const Transaksi *trx = &k->transaksi->data[i];
+        Tanggal tgl;
+        if (!urai_tanggal_struct(trx->tanggal, &tgl) || tgl.bulan < 1 || tgl.bulan > 12) continue;
+        int b = tgl.bulan - 1;
+
+        akumulasi_transaksi(trx, p->pos[b], rekap->jumlah_pos[b], &p->ringkasan[b]);
+    }
+}
+
+/**
+ * Helper: Tugas batch 3, menyimpan pos dan analisis satu bulan
+ */
+static void tugas_simpan_bulan(void *konteks, int indeks) {
+    KonteksRekap *k = (KonteksRekap *)konteks;
+    int bulan = indeks + 1;
+    if (!k->dipilih[bulan]) return;
+
+    int ok = 1;
+    /* Sama dengan update_semua_pos_bulan: bulan tanpa pos tidak ditulis */
+    if (k->rekap->jumlah_pos[indeks] > 0) {
+        ok = simpan_pos_bulan(k->rekap->pos[indeks], k->rekap->jumlah_pos[indeks], bulan);
+    }
+    if (!simpan_analisis_bulan(bulan, &k->rekap->analisis[indeks])) ok = 0;
+
+    k->status[bulan] = ok ? REKAP_OK : REKAP_GAGAL;
+}
+
+/**
+ * Helper: Menggabung hasil parsial ke rekap sesuai urutan potongan
+ */
+static void gabung_parsial(RekapTahunan *rekap, const ParsialRekap *parsial, int jumlah_potongan) {
+    RingkasanTransaksi ringkasan[12];
+    memset(ringkasan, 0, sizeof(ringkasan));
+
+    for (int b = 0; b < 12; b++) {
+        for (int j = 0; j < rekap->jumlah_pos[b]; j++) {
+            rekap->pos[b][j].realisasi = 0;
+            rekap->pos[b][j].jumlah_transaksi = 0;
+        }
+    }
+
+    for (int i = 0; i < jumlah_potongan; i++) {
+        const ParsialRekap *p = &parsial[i];
+        for (int b = 0; b < 12; b++) {
+            ringkasan[b].total_pemasukan += p->ringkasan[b].total_pemasukan;
+            ringkasan[b].total_pengeluaran += p->ringkasan[b].total_pengeluaran;
+            ringkasan[b].jumlah_pemasukan += p->ringkasan[b].jumlah_pemasukan;
+            ringkasan[b].jumlah_pengeluaran += p->ringkasan[b].jumlah_pengeluaran;
+
+            for (int j = 0; j < rekap->jumlah_pos[b]; j++) {
+                rekap->pos[b][j].realisasi += p->pos[b][j].realisasi;
+                rekap->pos[b][j].jumlah_transaksi += p->pos[b][j].jumlah_transaksi;
+            }
+        }
+    }
+
+    for (int b = 0; b < 12; b++) {
+        /* Bulan yang ditutup memakai agregat snapshot, bukan hasil agregasi */
+        RingkasanPeriode periode;
+        if (ambil_ringkasan_periode(b + 1, &periode)) {
+            rekap->analisis[b] = periode.analisis;
+            memcpy(rekap->pos[b], periode.pos, (size_t)periode.jumlah_pos * sizeof(PosAnggaran));
+            rekap->jumlah_pos[b] = periode.jumlah_pos;
+            continue;
+        }
+
+        isi_analisis_dari_ringkasan(&ringkasan[b], &rekap->analisis[b]);
+        for (int j = 0; j < rekap->jumlah_pos[b]; j++) {
+            PosAnggaran *pos = &rekap->pos[b][j];
+            pos->sisa = hitung_sisa_pos(pos->nominal, pos->realisasi);
+            pos->status = tentukan_status_pos(pos->sisa);
+        }
+    }
+}
+
+/* ===== IMPLEMENTASI FUNGSI PUBLIK ===== */
+
+/**
+ * Menghitung analisis dan kalkulasi pos seluruh bulan secara paralel
+ */
+int hitung_rekap_tahunan(RekapTahunan *rekap) {
+    INSTRUMEN_FUNGSI();
+    if (!rekap) return 0;
+
+    memset(rekap, 0, sizeof(RekapTahunan));
+    KonteksRekap k;
+    memset(&k, 0, sizeof(k));
+    k.rekap = rekap;
+
+    kolam_jalankan(tugas_muat_pos, &k, 12);
+
+    ListTransaksi transaksi;
+    if (!inisialisasi_list_transaksi(&transaksi, 1024)) return 0;
+    if (muat_transaksi_ke_list(&transaksi, 0) < 0) {
+        bebaskan_list_transaksi(&transaksi);
+        return 0;
+    }
+    k.transaksi = &transaksi;
+
+    /* Potongan kecil tidak sebanding dengan biaya penjadwalan */
+    int jumlah = transaksi.count / REKAP_TRANSAKSI_PER_TUGAS;
+    int maks_potongan = kolam_ambil_thread() * REKAP_TUGAS_PER_THREAD;
+    if (jumlah > maks_potongan) jumlah = maks_potongan;
+    if (jumlah < 1) jumlah = 1;
+
+    k.parsial = (ParsialRekap *)calloc((size_t)jumlah, sizeof(ParsialRekap));
+    if (k.parsial == NULL) {
+        bebaskan_list_transaksi(&transaksi);
+        return 0;
+    }
+    k.jumlah_potongan = jumlah;
+
+    kolam_jalankan(tugas_agregasi, &k, jumlah);
+    gabung_parsial(rekap, k.parsial, jumlah);
+
+    free(k.parsial);
+    bebaskan_list_transaksi(&transaksi);
+    return 1;
+}
+
+/**
+ * Menghitung ulang dan menyimpan pos serta analisis bulan terpilih
+ */
+int refresh_rekap_bulan(const int dipilih[13], int status[13]) {
+    INSTRUMEN_FUNGSI();
+    int status_lokal[13];
+    if (!status) status = status_lokal;
+
+    int ada = 0;
+    status[0] = REKAP_DILEWATI;
+    for (int b = 1; b <= 12; b++) {
+        status[b] = dipilih[b] ? REKAP_GAGAL : REKAP_DILEWATI;
+        if (dipilih[b]) ada = 1;
+    }
+    /* Tidak ada bulan dipilih: file transaksi tidak perlu dimuat */
+    if (!ada) return 1;
+
+    RekapTahunan *rekap = (RekapTahunan *)malloc(sizeof(RekapTahunan));
+    if (rekap == NULL) return 0;
+    if (!hitung_rekap_tahunan(rekap)) {
+        free(rekap);
+        return 0;
+    }
+
+    KonteksRekap k;
+    memset(&k, 0, sizeof(k));
+    k.rekap = rekap;
+    k.dipilih = dipilih;
+    k.status = status;
+    kolam_jalankan(tugas_simpan_bulan, &k, 12);
+
+    free(rekap);
+
+    for (int b = 1; b <= 12; b++) {
+        if (status[b] == REKAP_GAGAL) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Menghitung ulang dan menyimpan pos serta analisis seluruh bulan
+ */
+int refresh_rekap_tahunan(int hanya_berdata, int status[13]) {
+    int dipilih[13];
+
+    /* Bulan dipilih sebelum menulis agar file yang baru dibuat tidak ikut menentukan */
+    dipilih[0] = 0;
+    for (int b = 1; b <= 12; b++) {
+        dipilih[b] = !hanya_berdata || cek_file_pos_ada(b) || cek_file_analisis_ada(b);
+    }
+    return refresh_rekap_bulan(dipilih, status);
+}
@@ -14,7 +14,6 @@
  * - Pencatatan transaksi pemasukan dan pengeluaran
  * - Perhitungan total pemasukan, pengeluaran, dan jumlah transaksi
  * - Generate ID transaksi unik secara otomatis
- * - Tampilan interaktif untuk manajemen transaksi
  * - Validasi data transaksi
  *
  * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
@@ -24,12 +23,17 @@
  * - transaksi.h : Header file modul ini
  * - file.h      : Untuk operasi penyimpanan dan pembacaan file transaksi
  * - pos.h       : Untuk integrasi dengan pos anggaran
- * - tui.h       : Untuk tampilan antarmuka pengguna
  * - utils.h     : Untuk fungsi utilitas string dan formatting
+ * - pekerja.h   : Untuk perhitungan ulang pos dan analisis di latar belakang
+ * - arsip.h     : Untuk menolak perubahan pada tahun yang disegel
+ * - periode.h   : Untuk ringkasan bulan yang ditutup dan penolakan perubahannya
+ * - instrumen.h : Untuk timer perhitungan ringkasan dan akuntansi aksi pengguna
  *
  * CATATAN:
  * Fungsi validasi transaksi telah dipindahkan dari validator.c ke modul ini.
- * Setiap transaksi memiliki ID unik dengan format T0001-T9999.
+ * Layar TUI transaksi berada di layar_transaksi.c.
+ * Setiap transaksi memiliki ID unik dengan format T0001, T0002, dst.
+ * (minimal 4 digit, bertambah digit setelah T9999).
  * =============================================================================
  */
 
@@ -39,19 +43,24 @@
 #include "transaksi.h"
 #include "file.h"
 #include "pos.h"
-#include "tui.h"
 #include "utils.h"
-
-/* ===== KONSTANTA LOKAL ===== */
-/* Aksi Menu */
-#define ACT_VIEW    1
-#define ACT_TAMBAH  2
-#define ACT_EDIT    3
-#define ACT_HAPUS   4
-#define ACT_KEMBALI 0
+#include "pekerja.h"
+#include "arsip.h"
+#include "periode.h"
+#include "instrumen.h"
 
 /* ===== FUNGSI HELPER INTERNAL ===== */
 
+/**
+ * Helper untuk menjadwalkan perhitungan ulang pos dan analisis bulan
+ * setelah file transaksi berubah. Dikerjakan thread pekerja secara berurutan.
+ */
+static void jadwalkan_perhitungan_bulan(int bulan) {
+    if (bulan < 1 || bulan > 12) return;
+    pekerja_kirim(PEKERJA_HITUNG_POS, bulan);
+    pekerja_kirim(PEKERJA_REFRESH_ANALISIS, bulan);
+}
+
 /**
  * Helper untuk mengatur pesan error
  * I.S.: error_msg buffer, msg pesan
@@ -71,11 +80,30 @@ static void atur_pesan_error(char *error_msg, const char *msg) {
 int tambah_transaksi(const char *tanggal, int jenis, const char *pos,
                      unsigned long long nominal, const char *deskripsi,
                      char *error_msg) {
+    return tambah_transaksi_dengan_id(tanggal, jenis, pos, nominal, deskripsi, NULL, error_msg);
+}
+
+/**
+ * Menambah transaksi baru dan mengembalikan ID yang diberikan
+ */
+int tambah_transaksi_dengan_id(const char *tanggal, int jenis, const char *pos,
+                               unsigned long long nominal, const char *deskripsi,
+                               char *id_baru, char *error_msg) {
+    INSTRUMEN_AKSI(AKSI_TAMBAH_TRANSAKSI);
+
     /* Validasi tanggal */
     if (!tanggal || !validasi_tanggal_lengkap(tanggal)) {
         atur_pesan_error(error_msg, "Tanggal tidak valid");
         return 0;
     }
+    if (cek_tanggal_tersegel(tanggal)) {
+        atur_pesan_error(error_msg, "Tahun transaksi sudah disegel");
+        return 0;
+    }
+    if (cek_tanggal_tertutup(tanggal)) {
+        atur_pesan_error(error_msg, "Bulan transaksi sudah ditutup");
+        return 0;
+    }
 
     /* Validasi jenis */
     if (!validasi_jenis_transaksi(jenis)) {
@@ -88,6 +116,14 @@ int tambah_transaksi(const char *tanggal, int jenis, const char *pos,
         atur_pesan_error(error_msg, "Pos anggaran harus dipilih");
         return 0;
     }
+    if (!validasi_panjang_pos(pos)) {
+        atur_pesan_error(error_msg, "Nama pos terlalu panjang (max 20 karakter)");
+        return 0;
+    }
+    if (!validasi_tidak_ada_pipe(pos)) {
+        atur_pesan_error(error_msg, "Pos tidak boleh mengandung karakter |");
+        return 0;
+    }
 
     /* Validasi nominal */
     if (!validasi_nominal_positif(nominal)) {
@@ -111,7 +147,10 @@ int tambah_transaksi(const char *tanggal, int jenis, const char *pos,
     Transaksi trx;
     memset(&trx, 0, sizeof(Transaksi));
 
-    buat_id_transaksi(trx.id);
+    if (!buat_id_transaksi(trx.id, sizeof(trx.id))) {
+        atur_pesan_error(error_msg, "Nomor ID transaksi sudah habis");
+        return 0;
+    }
     salin_string_aman(trx.tanggal, tanggal, sizeof(trx.tanggal));
     trx.jenis = jenis;
     salin_string_aman(trx.pos, pos, sizeof(trx.pos));
@@ -124,13 +163,12 @@ int tambah_transaksi(const char *tanggal, int jenis, const char *pos,
         atur_pesan_error(error_msg, "Gagal menyimpan transaksi");
         return 0;
     }
+    if (id_baru) salin_string_aman(id_baru, trx.id, sizeof(trx.id));
 
-    /* Update kalkulasi pos */
-    int bulan = ekstrak_bulan(tanggal);
-    if (bulan > 0) {
-        update_semua_pos_bulan(bulan);
-    }
+    /* Update kalkulasi pos di latar belakang */
+    jadwalkan_perhitungan_bulan(ekstrak_bulan(tanggal));
 
+    INSTRUMEN_AKSI_SELESAI(AKSI_TAMBAH_TRANSAKSI, ukuran_baris_transaksi(&trx));
     return 1;
 }
 
@@ -140,6 +178,7 @@ int tambah_transaksi(const char *tanggal, int jenis, const char *pos,
 int ubah_transaksi(const char *id, const char *tanggal, int jenis,
                    const char *pos, unsigned long long nominal,
                    const char *deskripsi, char *error_msg) {
+    INSTRUMEN_AKSI(AKSI_UBAH_TRANSAKSI);
     if (!id) {
         atur_pesan_error(error_msg, "ID transaksi tidak valid");
         return 0;
@@ -152,6 +191,16 @@ int ubah_transaksi(const char *id, const char *tanggal, int jenis,
         return 0;
     }
 
+    /* Transaksi di arsip hanya bisa diubah setelah segel tahunnya dibuka */
+    if (cek_tanggal_tersegel(trx.tanggal)) {
+        atur_pesan_error(error_msg, "Tahun transaksi sudah disegel");
+        return 0;
+    }
+    if (cek_tanggal_tertutup(trx.tanggal)) {
+        atur_pesan_error(error_msg, "Bulan transaksi sudah ditutup");
+        return 0;
+    }
+
     int old_bulan = ekstrak_bulan(trx.tanggal);
 
     /* Update tanggal jika diubah */
@@ -160,6 +209,14 @@ int ubah_transaksi(const char *id, const char *tanggal, int jenis,
             atur_pesan_error(error_msg, "Tanggal tidak valid");
             return 0;
         }
+        if (cek_tanggal_tersegel(tanggal)) {
+            atur_pesan_error(error_msg, "Tahun tujuan sudah disegel");
+            return 0;
+        }
+        if (cek_tanggal_tertutup(tanggal)) {
+            atur_pesan_error(error_msg, "Bulan tujuan sudah ditutup");
+            return 0;
+        }
         salin_string_aman(trx.tanggal, tanggal, sizeof(trx.tanggal));
     }
 
@@ -174,6 +231,14 @@ int ubah_transaksi(const char *id, const char *tanggal, int jenis,
 
     /* Update pos jika diubah */
     if (pos && strlen(pos) > 0) {
+        if (!validasi_panjang_pos(pos)) {
+            atur_pesan_error(error_msg, "Nama pos terlalu panjang (max 20 karakter)");
+            return 0;
+        }
+        if (!validasi_tidak_ada_pipe(pos)) {
+            atur_pesan_error(error_msg, "Pos tidak boleh mengandung karakter |");
+            return 0;
+        }
         salin_string_aman(trx.pos, pos, sizeof(trx.pos));
     }
 
@@ -188,6 +253,10 @@ int ubah_transaksi(const char *id, const char *tanggal, int jenis,
             atur_pesan_error(error_msg, "Deskripsi terlalu panjang");
             return 0;
         }
+        if (!validasi_tidak_ada_pipe(deskripsi)) {
+            atur_pesan_error(error_msg, "Deskripsi tidak boleh mengandung karakter |");
+            return 0;
+        }
         salin_string_aman(trx.deskripsi, deskripsi, sizeof(trx.deskripsi));
     }
 
@@ -196,11 +265,12 @@ int ubah_transaksi(const char *id, const char *tanggal, int jenis,
         return 0;
     }
 
-    /* Update kalkulasi pos untuk bulan lama dan baru */
+    /* Update kalkulasi pos untuk bulan lama dan baru di latar belakang */
     int new_bulan = ekstrak_bulan(trx.tanggal);
-    if (old_bulan > 0) update_semua_pos_bulan(old_bulan);
-    if (new_bulan > 0 && new_bulan != old_bulan) update_semua_pos_bulan(new_bulan);
+    jadwalkan_perhitungan_bulan(old_bulan);
+    if (new_bulan != old_bulan) jadwalkan_perhitungan_bulan(new_bulan);
 
+    INSTRUMEN_AKSI_SELESAI(AKSI_UBAH_TRANSAKSI, ukuran_baris_transaksi(&trx));
     return 1;
 }
 
@@ -208,6 +278,7 @@ int ubah_transaksi(const char *id, const char *tanggal, int jenis,
  * Menghapus transaksi dengan validasi
  */
 int hapus_transaksi(const char *id, char *error_msg) {
+    INSTRUMEN_AKSI(AKSI_HAPUS_TRANSAKSI);
     if (!id) {
         atur_pesan_error(error_msg, "ID transaksi tidak valid");
         return 0;
@@ -220,6 +291,15 @@ int hapus_transaksi(const char *id, char *error_msg) {
         return 0;
     }
 
+    if (cek_tanggal_tersegel(trx.tanggal)) {
+        atur_pesan_error(error_msg, "Tahun transaksi sudah disegel");
+        return 0;
+    }
+    if (cek_tanggal_tertutup(trx.tanggal)) {
+        atur_pesan_error(error_msg, "Bulan transaksi sudah ditutup");
+        return 0;
+    }
+
     int bulan = ekstrak_bulan(trx.tanggal);
 
     if (!hapus_transaksi_dari_file(id)) {
@@ -227,11 +307,10 @@ int hapus_transaksi(const char *id, char *error_msg) {
         return 0;
     }
 
-    /* Update kalkulasi pos */
-    if (bulan > 0) {
-        update_semua_pos_bulan(bulan);
-    }
+    /* Update kalkulasi pos di latar belakang */
+    jadwalkan_perhitungan_bulan(bulan);
 
+    INSTRUMEN_AKSI_SELESAI(AKSI_HAPUS_TRANSAKSI, ukuran_baris_transaksi(&trx));
     return 1;
 }
 
@@ -255,572 +334,153 @@ int ambil_transaksi_berdasarkan_id(const char *id, Transaksi *result) {
     return cari_transaksi_berdasarkan_id(id, result);
 }
 
-/* ===== IMPLEMENTASI PERHITUNGAN TRANSAKSI ===== */
-
 /**
- * Menghitung total pemasukan untuk bulan tertentu
+ * Mengambil snapshot transaksi dan total turunannya (satu kali baca file)
  */
-unsigned long long hitung_total_pemasukan_transaksi(int bulan) {
-    if (bulan < 1 || bulan > 12) return 0;
+int ambil_snapshot_transaksi(SnapshotTransaksi *snap, int bulan) {
+    INSTRUMEN_FUNGSI();
+    if (!snap || bulan < 0 || bulan > 12) return 0;
 
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi_bulan(list, MAX_TRANSAKSI, bulan);
+    memset(snap, 0, sizeof(SnapshotTransaksi));
+    snap->bulan = bulan;
 
-    unsigned long long total = 0;
-    for (int i = 0; i < count; i++) {
-        if (list[i].jenis == JENIS_PEMASUKAN) {
-            total += list[i].nominal;
-        }
+    if (!inisialisasi_list_transaksi(&snap->list, 64)) return 0;
+    if (muat_transaksi_ke_list(&snap->list, bulan) < 0) {
+        bebaskan_list_transaksi(&snap->list);
+        return 0;
     }
 
-    return total;
-}
-
-/**
- * Menghitung total pengeluaran untuk bulan tertentu
- */
-unsigned long long hitung_total_pengeluaran_transaksi(int bulan) {
-    if (bulan < 1 || bulan > 12) return 0;
-
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi_bulan(list, MAX_TRANSAKSI, bulan);
-
-    unsigned long long total = 0;
-    for (int i = 0; i < count; i++) {
-        if (list[i].jenis == JENIS_PENGELUARAN) {
-            total += list[i].nominal;
+    for (int i = 0; i < snap->list.count; i++) {
+        const Transaksi *trx = &snap->list.data[i];
+        if (trx->jenis == JENIS_PEMASUKAN) {
+            snap->total_pemasukan += trx->nominal;
+            snap->jumlah_pemasukan++;
+        } else if (trx->jenis == JENIS_PENGELUARAN) {
+            snap->total_pengeluaran += trx->nominal;
+            snap->jumlah_pengeluaran++;
         }
     }
 
-    return total;
+    return 1;
 }
 
 /**
- * Menghitung jumlah transaksi untuk bulan tertentu
+ * Membebaskan snapshot transaksi
  */
-int hitung_jumlah_transaksi(int bulan, int jenis) {
-    if (bulan < 1 || bulan > 12) return 0;
-
-    Transaksi list[MAX_TRANSAKSI];
-    int count = muat_transaksi_bulan(list, MAX_TRANSAKSI, bulan);
-
-    if (jenis < 0) return count;
-
-    int total = 0;
-    for (int i = 0; i < count; i++) {
-        if (list[i].jenis == jenis) {
-            total++;
-        }
-    }
-
-    return total;
+void bebaskan_snapshot_transaksi(SnapshotTransaksi *snap) {
+    if (!snap) return;
+    bebaskan_list_transaksi(&snap->list);
+    memset(snap, 0, sizeof(SnapshotTransaksi));
 }
 
-/* ===== IMPLEMENTASI TAMPILAN TRANSAKSI ===== */
-
-int tampilkan_daftar_transaksi(int bulan, int selected) {
-    Transaksi list[MAX_TRANSAKSI];
-    int count = ambil_daftar_transaksi(list, MAX_TRANSAKSI, bulan);
-
-    char title[64];
-    snprintf(title, sizeof(title), "Transaksi - %s", dapatkan_nama_bulan(bulan));
-
-    tui_aktifkan_warna(COLOR_PAIR_CYAN);
-    tui_aktifkan_tebal();
-    tui_cetak(4, 2, title);
-    tui_nonaktifkan_tebal();
-    tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
-
-    return tampilkan_tabel_transaksi(list, count, 6, selected);
-}
-
-int tampilkan_detail_transaksi(Transaksi *trx, int start_y) {
-    if (!trx) return start_y;
-
-    int y = start_y;
-    char buffer[64];
-
-    tui_aktifkan_tebal();
-    tui_aktifkan_warna(COLOR_PAIR_CYAN);
-    tui_cetak(y++, 2, "Detail Transaksi");
-    tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
-    tui_nonaktifkan_tebal();
-
-    tui_gambar_garis_horizontal(y++, 2, 50, '-');
-
-    tui_cetakf(y++, 2, "ID          : %s", trx->id);
-    tui_cetakf(y++, 2, "Tanggal     : %s", trx->tanggal);
-
-    tui_cetak(y, 2, "Jenis       : ");
-    if (trx->jenis == JENIS_PENGELUARAN) {
-        tui_aktifkan_warna(COLOR_PAIR_RED);
-        tui_cetak(y++, 16, "Pengeluaran");
-    } else {
-        tui_aktifkan_warna(COLOR_PAIR_GREEN);
-        tui_cetak(y++, 16, "Pemasukan");
-    }
-    tui_reset_atribut();
-
-    tui_cetakf(y++, 2, "Pos         : %s", trx->pos);
-
-    format_rupiah(trx->nominal, buffer);
-    tui_cetakf(y++, 2, "Nominal     : %s", buffer);
-
-    tui_cetakf(y++, 2, "Deskripsi   : %s",
-               strlen(trx->deskripsi) > 0 ? trx->deskripsi : "-");
-
-    return y + 1;
-}
-
-int tampilkan_ringkasan_transaksi(int bulan, int start_y) {
-    int y = start_y;
-    char buffer[64];
-
-    unsigned long long pemasukan = hitung_total_pemasukan_transaksi(bulan);
-    unsigned long long pengeluaran = hitung_total_pengeluaran_transaksi(bulan);
-    long long saldo = (long long)pemasukan - (long long)pengeluaran;
-    int jml_masuk = hitung_jumlah_transaksi(bulan, JENIS_PEMASUKAN);
-    int jml_keluar = hitung_jumlah_transaksi(bulan, JENIS_PENGELUARAN);
-
-    tui_gambar_garis_horizontal(y++, 2, 60, '=');
-
-    tui_aktifkan_tebal();
-    tui_cetak(y++, 2, "RINGKASAN:");
-    tui_nonaktifkan_tebal();
-
-    format_rupiah(pemasukan, buffer);
-    tui_cetakf(y++, 2, "Total Pemasukan   : %s (%d transaksi)", buffer, jml_masuk);
-
-    format_rupiah(pengeluaran, buffer);
-    tui_cetakf(y++, 2, "Total Pengeluaran : %s (%d transaksi)", buffer, jml_keluar);
-
-    format_saldo(saldo, buffer);
-    tui_cetak(y, 2, "Saldo             : ");
-    if (saldo < 0) {
-        tui_aktifkan_warna(COLOR_PAIR_RED);
-    } else {
-        tui_aktifkan_warna(COLOR_PAIR_GREEN);
-    }
-    tui_cetak(y++, 22, buffer);
-    tui_reset_atribut();
+/* ===== IMPLEMENTASI PERHITUNGAN TRANSAKSI ===== */
 
-    return y + 1;
+/**
+ * Helper: Pengunjung yang mengakumulasi ringkasan transaksi
+ */
+static int kunjungi_ringkasan(const Transaksi *trx, void *konteks) {
+    akumulasi_transaksi(trx, NULL, 0, (RingkasanTransaksi *)konteks);
+    return 1;
 }
 
-int tampilkan_form_tambah_transaksi(int bulan) {
-    tui_hapus_layar();
-    tampilkan_header("TAMBAH TRANSAKSI");
-
-    int y = 5;
-    char tanggal[12], pos[MAX_POS_LENGTH + 1], deskripsi[MAX_DESKRIPSI_LENGTH + 1];
-    unsigned long long nominal;
-    int jenis;
-
-    /* Info bulan */
-    char bulan_info[64];
-    snprintf(bulan_info, sizeof(bulan_info), "Bulan: %s", dapatkan_nama_bulan(bulan));
-    tui_cetak(y++, 2, bulan_info);
-    y++;
-
-    /* Input tanggal dengan validasi bulan */
-    while (1) {
-        if (!masukan_tanggal(y, 2, "Tanggal", tanggal)) {
-            return 0;
-        }
-        /* Validasi bulan sesuai */
-        if (!validasi_bulan_sesuai(tanggal, bulan)) {
-            char error_msg[128];
-            snprintf(error_msg, sizeof(error_msg),
-                     "Anda memasukkan %s yang berbeda dari bulan terpilih! Input tidak valid!",
-                     tanggal);
-            tampilkan_error(error_msg);
-            /* Gambar ulang form */
-            tui_hapus_layar();
-            tampilkan_header("TAMBAH TRANSAKSI");
-            y = 5;
-            tui_cetak(y++, 2, bulan_info);
-            y++;
-            continue;
-        }
-        y++;
-        break;
-    }
-
-    /* Input jenis */
-    if (!masukan_jenis_transaksi(y++, 2, &jenis)) {
-        return 0;
-    }
-    y++;
-
-    /* Pilih pos (otomatis untuk Pemasukan) */
-    if (jenis == JENIS_PENGELUARAN) {
-        tui_cetak(y++, 2, "Pilih Pos Anggaran:");
-        if (!tampilkan_pilih_pos(bulan, pos)) {
-            tampilkan_peringatan("Pos anggaran harus dipilih");
-            return 0;
-        }
-    } else {
-        /* Untuk pemasukan, pos otomatis "Pemasukan" */
-        strcpy(pos, "Pemasukan");
-    }
-
-    /* Kembali ke form */
-    tui_hapus_layar();
-    tampilkan_header("TAMBAH TRANSAKSI");
-    y = 5;
-    tui_cetakf(y++, 2, "Tanggal : %s", tanggal);
-    tui_cetakf(y++, 2, "Jenis   : %s", dapatkan_label_jenis(jenis));
-    if (jenis == JENIS_PENGELUARAN) {
-        tui_cetakf(y++, 2, "Pos     : %s", pos);
-    } else {
-        tui_cetakf(y++, 2, "Pos     : %s (Otomatis)", pos);
-    }
-    y++;
-
-    /* Input nominal */
-    if (!masukan_angka_min(y++, 2, "Nominal: Rp ", &nominal, 1)) {
-        return 0;
-    }
-
-    /* Input deskripsi (opsional) */
-    if (!masukan_string(y++, 2, "Deskripsi (opsional): ", deskripsi, sizeof(deskripsi))) {
-        return 0;
-    }
-
-    /* Konfirmasi */
-    y++;
-    if (!masukan_konfirmasi(y, 2, "Simpan transaksi?")) {
-        tampilkan_info("Dibatalkan");
-        return 0;
-    }
-
-    /* Simpan */
-    char error_msg[100];
-    if (tambah_transaksi(tanggal, jenis, pos, nominal, deskripsi, error_msg)) {
-        tampilkan_sukses("Transaksi berhasil ditambahkan");
-        return 1;
-    } else {
-        tampilkan_error("%s", error_msg);
-        return 0;
-    }
+/**
+ * Helper: Mengisi ringkasan dari snapshot bulan yang ditutup.
+ * Mengembalikan 1 jika bulan ditutup, 0 jika ringkasan harus dihitung dari transaksi.
+ */
+static int ambil_ringkasan_tertutup(int bulan, RingkasanTransaksi *hasil) {
+    RingkasanPeriode periode;
+    if (!ambil_ringkasan_periode(bulan, &periode)) return 0;
+
+    hasil->total_pemasukan = periode.analisis.total_pemasukan;
+    hasil->total_pengeluaran = periode.analisis.total_pengeluaran;
+    hasil->jumlah_pemasukan = periode.analisis.total_trx_pemasukan;
+    hasil->jumlah_pengeluaran = periode.analisis.total_trx_pengeluaran;
+    return 1;
 }
 
-int tampilkan_form_edit_transaksi(const char *id) {
-    Transaksi trx;
-    if (!ambil_transaksi_berdasarkan_id(id, &trx)) {
-        tampilkan_error("Transaksi tidak ditemukan");
-        return 0;
-    }
-
-    /* Ambil bulan dari transaksi yang ada untuk validasi */
-    int bulan_trx = ekstrak_bulan(trx.tanggal);
-
-    char tanggal_baru[12], deskripsi_baru[MAX_DESKRIPSI_LENGTH + 1], nominal_input[32];
-    unsigned long long nominal_baru = 0;
-
-    while (1) {
-        tui_hapus_layar();
-        tampilkan_header("EDIT TRANSAKSI");
-
-        int y = 5;
-        char nominal_str[64];
-        format_rupiah(trx.nominal, nominal_str);
-
-        /* Tampilkan data saat ini */
-        tui_cetak(y++, 2, "Data saat ini:");
-        tui_cetakf(y++, 2, "  ID        : %s", trx.id);
-        tui_cetakf(y++, 2, "  Tanggal   : %s", trx.tanggal);
-        tui_cetakf(y++, 2, "  Jenis     : %s", dapatkan_label_jenis(trx.jenis));
-        tui_cetakf(y++, 2, "  Pos       : %s", trx.pos);
-        tui_cetakf(y++, 2, "  Nominal   : %s", nominal_str);
-        tui_cetakf(y++, 2, "  Deskripsi : %s", trx.deskripsi);
-        y++;
-
-        tui_cetak(y++, 2, "Masukkan data baru (kosongkan jika tidak diubah):");
-        y++;
-
-        /* Input tanggal baru dengan validasi langsung */
-        if (!masukan_string(y++, 2, "Tanggal baru (dd-mm-YYYY): ", tanggal_baru, sizeof(tanggal_baru))) {
-            return 0;
-        }
-
-        /* Validasi langsung setelah input tanggal */
-        if (strlen(tanggal_baru) > 0) {
-            if (!validasi_tanggal_lengkap(tanggal_baru)) {
-                tampilkan_error("Format tanggal tidak valid! Gunakan format dd-mm-YYYY");
-                continue;
-            }
-            /* Validasi bulan sesuai dengan transaksi asli */
-            if (!validasi_bulan_sesuai(tanggal_baru, bulan_trx)) {
-                char error_msg[128];
-                snprintf(error_msg, sizeof(error_msg),
-                         "Anda memasukkan %s yang berbeda dari bulan terpilih! Input tidak valid!",
-                         tanggal_baru);
-                tampilkan_error(error_msg);
-                continue;
-            }
-        }
-
-        /* Input nominal baru dengan validasi langsung */
-        if (!masukan_string(y++, 2, "Nominal baru: Rp ", nominal_input, sizeof(nominal_input))) {
-            return 0;
-        }
-        if (strlen(nominal_input) > 0) {
-            if (!urai_nominal(nominal_input, &nominal_baru) || nominal_baru == 0) {
-                tampilkan_error("Nominal tidak valid! Harus berupa angka lebih dari 0");
-                continue;
-            }
-        }
-
-        /* Input deskripsi baru dengan validasi langsung */
-        if (!masukan_string(y++, 2, "Deskripsi baru: ", deskripsi_baru, sizeof(deskripsi_baru))) {
-            return 0;
-        }
-        if (strlen(deskripsi_baru) > MAX_DESKRIPSI_LENGTH) {
-            tampilkan_error("Deskripsi terlalu panjang (max 50 karakter)");
-            continue;
-        }
-
-        break; /* Semua validasi berhasil */
-    }
-
-    /* Cek perubahan */
-    if (strlen(tanggal_baru) == 0 && nominal_baru == 0 && strlen(deskripsi_baru) == 0) {
-        tampilkan_info("Tidak ada perubahan");
-        return 0;
-    }
+/**
+ * Menghitung ringkasan transaksi bulan dalam satu lintasan file
+ */
+int hitung_ringkasan_transaksi(int bulan, RingkasanTransaksi *hasil) {
+    INSTRUMEN_FUNGSI();
+    if (!hasil) return 0;
 
-    /* Konfirmasi */
-    if (!tampilkan_konfirmasi("Simpan perubahan?")) {
-        tampilkan_info("Dibatalkan");
-        return 0;
-    }
+    memset(hasil, 0, sizeof(RingkasanTransaksi));
+    if (bulan < 1 || bulan > 12) return 0;
 
-    /* Simpan */
-    char error_msg[100];
-    const char *tgl_param = strlen(tanggal_baru) > 0 ? tanggal_baru : NULL;
-    const char *desk_param = strlen(deskripsi_baru) > 0 ? deskripsi_baru : NULL;
+    /* Bulan yang ditutup: total akhir dari snapshot tanpa membaca transaksi */
+    if (ambil_ringkasan_tertutup(bulan, hasil)) return 1;
 
-    if (ubah_transaksi(id, tgl_param, -1, NULL, nominal_baru, desk_param, error_msg)) {
-        tampilkan_sukses("Transaksi berhasil diupdate");
-        return 1;
-    } else {
-        tampilkan_error("%s", error_msg);
-        return 0;
-    }
+    telusuri_transaksi(bulan, kunjungi_ringkasan, hasil);
+    return 1;
 }
 
-int tampilkan_konfirmasi_hapus_transaksi(const char *id) {
-    Transaksi trx;
-    if (!ambil_transaksi_berdasarkan_id(id, &trx)) {
-        tampilkan_error("Transaksi tidak ditemukan");
-        return 0;
-    }
-
-    char nominal_str[30];
-    format_rupiah(trx.nominal, nominal_str);
-
-    char msg[128];
-    snprintf(msg, sizeof(msg), "Hapus transaksi %s (%s %s)?",
-             trx.id, dapatkan_label_jenis(trx.jenis), nominal_str);
-
-    if (!tampilkan_konfirmasi(msg)) {
-        tampilkan_info("Dibatalkan");
-        return 0;
-    }
+/**
+ * Helper: Pengunjung yang mengakumulasi ringkasan ke bulan masing-masing
+ */
+static int kunjungi_ringkasan_per_bulan(const Transaksi *trx, void *konteks) {
+    RingkasanTransaksi *hasil = (RingkasanTransaksi *)konteks;
+    int bulan = ekstrak_bulan(trx->tanggal);
 
-    char error_msg[100];
-    if (hapus_transaksi(id, error_msg)) {
-        tampilkan_sukses("Transaksi berhasil dihapus");
-        return 1;
-    } else {
-        tampilkan_error("%s", error_msg);
-        return 0;
-    }
+    kunjungi_ringkasan(trx, &hasil[0]);
+    if (bulan >= 1 && bulan <= 12) kunjungi_ringkasan(trx, &hasil[bulan]);
+    return 1;
 }
 
-/* ===== IMPLEMENTASI HANDLER TRANSAKSI ===== */
-
 /**
- * Jalankan modul transaksi
+ * Menghitung ringkasan seluruh bulan dalam satu lintasan file
  */
-void jalankan_modul_transaksi(int bulan_awal) {
-    int bulan = bulan_awal;
-
-    /* Pastikan pos anggaran ada untuk bulan ini */
-    inisialisasi_pos_untuk_bulan(bulan);
-
-    while (1) {
-        int action = menu_transaksi_utama(bulan);
-
-        switch (action) {
-            case ACT_VIEW:
-                penanganan_lihat_transaksi(bulan);
-                break;
+void hitung_ringkasan_semua_bulan(RingkasanTransaksi hasil[13]) {
+    INSTRUMEN_FUNGSI();
+    if (!hasil) return;
 
-            case ACT_TAMBAH:
-                penanganan_tambah_transaksi(bulan);
-                break;
+    memset(hasil, 0, 13 * sizeof(RingkasanTransaksi));
+    telusuri_transaksi(0, kunjungi_ringkasan_per_bulan, hasil);
 
-            case ACT_EDIT:
-                penanganan_ubah_transaksi(bulan);
-                break;
+    /* Bulan yang ditutup memakai total snapshot; total keseluruhan ikut disesuaikan */
+    for (int bulan = 1; bulan <= 12; bulan++) {
+        RingkasanTransaksi beku;
+        if (!ambil_ringkasan_tertutup(bulan, &beku)) continue;
 
-            case ACT_HAPUS:
-                penanganan_hapus_transaksi(bulan);
-                break;
-
-            case ACT_KEMBALI:
-            case CANCEL:
-                return;
-        }
+        RingkasanTransaksi *r = &hasil[bulan];
+        hasil[0].total_pemasukan += beku.total_pemasukan - r->total_pemasukan;
+        hasil[0].total_pengeluaran += beku.total_pengeluaran - r->total_pengeluaran;
+        hasil[0].jumlah_pemasukan += beku.jumlah_pemasukan - r->jumlah_pemasukan;
+        hasil[0].jumlah_pengeluaran += beku.jumlah_pengeluaran - r->jumlah_pengeluaran;
+        *r = beku;
     }
 }
 
-int menu_transaksi_utama(int bulan) {
-    char title[64];
-    snprintf(title, sizeof(title), "Menu Transaksi - %s", dapatkan_nama_bulan(bulan));
-
-    Menu menu;
-    menu_inisialisasi(&menu, title);
-
-    menu_tambah_item(&menu, "Lihat Daftar Transaksi", ACT_VIEW);
-    menu_tambah_item(&menu, "Tambah Transaksi", ACT_TAMBAH);
-    menu_tambah_item(&menu, "Edit Transaksi", ACT_EDIT);
-    menu_tambah_item(&menu, "Hapus Transaksi", ACT_HAPUS);
-
-    return menu_navigasi(&menu);
-}
-
 /**
- * Handler untuk view daftar transaksi
+ * Menghitung total pemasukan untuk bulan tertentu
  */
-void penanganan_lihat_transaksi(int bulan) {
-    int selected = 0;
-    Transaksi list[MAX_TRANSAKSI];
-    int count = ambil_daftar_transaksi(list, MAX_TRANSAKSI, bulan);
-
-    while (1) {
-        tui_hapus_layar();
-        tampilkan_header("DAFTAR TRANSAKSI");
-
-        int next_y = tampilkan_daftar_transaksi(bulan, selected);
-        next_y = tampilkan_ringkasan_transaksi(bulan, next_y);
-
-        tampilkan_footer("ATAS/BAWAH: Navigasi | ENTER: Detail | ESC: Kembali");
-        tui_segarkan();
-
-        int ch = tui_ambil_karakter();
-
-        switch (ch) {
-            case KEY_UP:
-            case 'k':
-                if (selected > 0) selected--;
-                break;
-
-            case KEY_DOWN:
-            case 'j':
-                if (selected < count - 1) selected++;
-                break;
-
-            case KEY_ENTER:
-            case '\n':
-            case '\r':
-                if (count > 0) {
-                    tui_hapus_layar();
-                    tampilkan_header("DETAIL TRANSAKSI");
-                    tampilkan_detail_transaksi(&list[selected], 5);
-                    tampilkan_footer("Tekan sembarang tombol untuk kembali");
-                    tui_segarkan();
-                    tui_ambil_karakter();
-
-                    count = ambil_daftar_transaksi(list, MAX_TRANSAKSI, bulan);
-                    if (selected >= count) selected = count - 1;
-                    if (selected < 0) selected = 0;
-                }
-                break;
-
-            case 27:
-                return;
-        }
-    }
-}
+unsigned long long hitung_total_pemasukan_transaksi(int bulan) {
+    RingkasanTransaksi r;
+    if (!hitung_ringkasan_transaksi(bulan, &r)) return 0;
 
-/**
- * Handler untuk tambah transaksi
- */
-void penanganan_tambah_transaksi(int bulan) {
-    tampilkan_form_tambah_transaksi(bulan);
+    return r.total_pemasukan;
 }
 
 /**
- * Handler untuk edit transaksi
+ * Menghitung total pengeluaran untuk bulan tertentu
  */
-void penanganan_ubah_transaksi(int bulan) {
-    Transaksi list[MAX_TRANSAKSI];
-    int count = ambil_daftar_transaksi(list, MAX_TRANSAKSI, bulan);
-
-    if (count == 0) {
-        tampilkan_peringatan("Belum ada transaksi");
-        return;
-    }
-
-    Menu menu;
-    menu_inisialisasi(&menu, "Pilih Transaksi untuk Diedit");
-
-    char nominal_str[30];
-    for (int i = 0; i < count && i < 15; i++) {
-        char item[80];
-        format_rupiah(list[i].nominal, nominal_str);
-        snprintf(item, sizeof(item), "%s | %s | %s | %s",
-                 list[i].id, list[i].tanggal,
-                 list[i].jenis == JENIS_PENGELUARAN ? "Out" : "In",
-                 nominal_str);
-        menu_tambah_item(&menu, item, i);
-    }
-
-    int pilihan = menu_navigasi(&menu);
-
-    if (pilihan == CANCEL || pilihan < 0) {
-        return;
-    }
+unsigned long long hitung_total_pengeluaran_transaksi(int bulan) {
+    RingkasanTransaksi r;
+    if (!hitung_ringkasan_transaksi(bulan, &r)) return 0;
 
-    tampilkan_form_edit_transaksi(list[pilihan].id);
+    return r.total_pengeluaran;
 }
 
 /**
- * Handler untuk hapus transaksi
+ * Menghitung jumlah transaksi untuk bulan tertentu
  */
-void penanganan_hapus_transaksi(int bulan) {
-    Transaksi list[MAX_TRANSAKSI];
-    int count = ambil_daftar_transaksi(list, MAX_TRANSAKSI, bulan);
-
-    if (count == 0) {
-        tampilkan_peringatan("Belum ada transaksi");
-        return;
-    }
-
-    Menu menu;
-    menu_inisialisasi(&menu, "Pilih Transaksi untuk Dihapus");
-
-    char nominal_str[30];
-    for (int i = 0; i < count && i < 15; i++) {
-        char item[80];
-        format_rupiah(list[i].nominal, nominal_str);
-        snprintf(item, sizeof(item), "%s | %s | %s | %s",
-                 list[i].id, list[i].tanggal,
-                 list[i].jenis == JENIS_PENGELUARAN ? "Out" : "In",
-                 nominal_str);
-        menu_tambah_item(&menu, item, i);
-    }
-
-    int pilihan = menu_navigasi(&menu);
-
-    if (pilihan == CANCEL || pilihan < 0) {
-        return;
-    }
+int hitung_jumlah_transaksi(int bulan, int jenis) {
+    RingkasanTransaksi r;
+    if (!hitung_ringkasan_transaksi(bulan, &r)) return 0;
 
-    tampilkan_konfirmasi_hapus_transaksi(list[pilihan].id);
+    if (jenis == JENIS_PEMASUKAN) return r.jumlah_pemasukan;
+    if (jenis == JENIS_PENGELUARAN) return r.jumlah_pengeluaran;
+    return r.jumlah_pemasukan + r.jumlah_pengeluaran;
 }
 
 /* ===== IMPLEMENTASI FUNGSI VALIDASI TRANSAKSI (dipindahkan dari validator.c) ===== */
@@ -842,21 +502,21 @@ int validasi_panjang_deskripsi(const char *deskripsi) {
 }
 
 /**
- * Validasi format ID transaksi (T0001-T9999)
+ * Validasi format ID transaksi (T diikuti 4-9 digit)
  */
 int validasi_format_id(const char *id) {
     if (id == NULL) return 0;
 
     int len = strlen(id);
 
-    /* ID harus 5 karakter (T + 4 digit) */
-    if (len != 5) return 0;
+    /* ID minimal 5 karakter (T + 4 digit), maksimal T + 9 digit */
+    if (len < 5 || len > MAX_ID_LENGTH) return 0;
 
     /* Karakter pertama harus 'T' */
     if (id[0] != 'T') return 0;
 
-    /* 4 karakter berikutnya harus digit */
-    for (int i = 1; i < 5; i++) {
+    /* Karakter berikutnya harus digit */
+    for (int i = 1; i < len; i++) {
         if (!isdigit((unsigned char)id[i])) {
             return 0;
         }
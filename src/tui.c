@@ -12,6 +12,7 @@
  * berbasis teks (TUI) menggunakan library ncurses, termasuk:
  * - Inisialisasi dan pembersihan terminal ncurses
  * - Manajemen warna dan atribut tampilan
+ * - Frame buffer off-screen yang dikirim ke ncurses per run sel berubah
  * - Sistem menu navigasi dengan keyboard
  * - Sistem tabel untuk menampilkan data
  * - Komponen UI (header, footer, pesan, dialog)
@@ -29,6 +30,7 @@
  * - transaksi.h : Untuk tampilan tabel transaksi
  * - pos.h       : Untuk tampilan tabel pos anggaran
  * - file.h      : Untuk konstanta path file
+ * - pekerja.h   : Untuk menunggu pekerja latar belakang
  *
  * CATATAN:
  * Modul ini mengabstraksi penggunaan ncurses agar modul lain tidak perlu
@@ -48,9 +50,205 @@
 #include "transaksi.h"
 #include "pos.h"
 #include "file.h"
+#include "pekerja.h"
 
 /* ===== KONSTANTA LOKAL ===== */
 #define MSG_LINE (LINES - 4)    /* Baris untuk menampilkan pesan */
+#define JEDA_SPINNER 1          /* Interval spinner dalam persepuluhan detik (halfdelay) */
+#define MAX_TOMBOL_TERTUNDA 8   /* Tombol yang disimpan selama menunggu pekerja */
+
+/* ===== FRAME BUFFER ===== */
+
+/*
+ * Semua fungsi gambar menulis ke buffer sel off-screen (fb_belakang). Saat
+ * layar disegarkan, buffer dibandingkan dengan salinan isi stdscr terakhir
+ * (fb_depan) dan hanya rentang sel yang berubah dikirim ke ncurses, satu
+ * panggilan per run beratribut sama, bukan satu panggilan per karakter.
+ */
+#define FB_SEL_KOSONG   ((chtype)' ')   /* Sel kosong tanpa atribut */
+#define FB_SEL_INVALID  ((chtype)0)     /* Penanda sel depan yang tidak diketahui */
+#define FB_CELAH_GABUNG 4               /* Celah sel sama yang tetap digabung dalam satu run */
+
+static chtype *fb_belakang = NULL;      /* Isi frame yang sedang disusun */
+static chtype *fb_depan = NULL;         /* Isi stdscr hasil penyegaran terakhir */
+static int fb_baris = 0, fb_kolom = 0;  /* Ukuran buffer saat ini */
+static attr_t fb_atribut = A_NORMAL;    /* Atribut aktif untuk tulisan berikutnya */
+static int fb_kursor_y = 0, fb_kursor_x = 0;
+static StatistikFrame fb_statistik;     /* Statistik penyegaran terakhir */
+
+/**
+ * Helper: Menyesuaikan ukuran buffer dengan ukuran terminal
+ */
+static int fb_pastikan_ukuran(void) {
+    if (fb_belakang && fb_baris == LINES && fb_kolom == COLS) return 1;
+
+    int total = LINES * COLS;
+    if (total <= 0) return 0;
+
+    chtype *belakang = realloc(fb_belakang, (size_t)total * sizeof(chtype));
+    if (!belakang) return 0;
+    fb_belakang = belakang;
+
+    chtype *depan = realloc(fb_depan, (size_t)total * sizeof(chtype));
+    if (!depan) return 0;
+    fb_depan = depan;
+
+    fb_baris = LINES;
+    fb_kolom = COLS;
+    for (int i = 0; i < total; i++) {
+        fb_belakang[i] = FB_SEL_KOSONG;
+        fb_depan[i] = FB_SEL_INVALID;  /* Paksa seluruh layar dikirim ulang */
+    }
+    return 1;
+}
+
+/**
+ * Helper: Mengisi length sel mulai (y, x) dengan sel yang sama, dipotong di tepi layar
+ */
+static void fb_isi_sel(int y, int x, int length, chtype sel) {
+    if (!fb_pastikan_ukuran() || y < 0 || y >= fb_baris) return;
+    if (x < 0) { length += x; x = 0; }
+    if (x + length > fb_kolom) length = fb_kolom - x;
+
+    chtype *baris = fb_belakang + (size_t)y * fb_kolom;
+    for (int i = 0; i < length; i++) baris[x + i] = sel;
+
+    fb_kursor_y = y;
+    fb_kursor_x = (length > 0) ? x + length : x;
+}
+
+/**
+ * Helper: Menulis teks dengan atribut aktif mulai (y, x), dipotong di tepi layar
+ */
+static void fb_tulis(int y, int x, const char *text, int len) {
+    if (!fb_pastikan_ukuran() || y < 0 || y >= fb_baris) return;
+
+    chtype *baris = fb_belakang + (size_t)y * fb_kolom;
+    int i = 0;
+    if (x < 0) { i = -x; }
+    for (; i < len && x + i < fb_kolom; i++) {
+        unsigned char c = (unsigned char)text[i];
+        if (c < ' ') c = ' ';
+        baris[x + i] = (chtype)c | fb_atribut;
+    }
+
+    fb_kursor_y = y;
+    fb_kursor_x = (x + len < fb_kolom) ? x + len : fb_kolom - 1;
+}
+
+/**
+ * Helper: Mengirim satu run sel beratribut sama ke stdscr
+ */
+static void fb_kirim_run(int y, int x, const chtype *sel, int len, attr_t *atribut_terakhir) {
+    attr_t atribut = sel[0] & (A_ATTRIBUTES & ~A_ALTCHARSET);
+
+    if (atribut != *atribut_terakhir) {
+        attrset(atribut);
+        *atribut_terakhir = atribut;
+        fb_statistik.panggilan_ncurses++;
+    }
+
+    if (sel[0] & A_ALTCHARSET) {
+        /* Karakter garis ACS dikirim per sel agar pemetaan terminal tetap berlaku */
+        for (int i = 0; i < len; i++) {
+            mvaddch(y, x + i, sel[i]);
+            fb_statistik.panggilan_ncurses++;
+        }
+    } else {
+        char teks[len + 1];
+        for (int i = 0; i < len; i++) teks[i] = (char)(sel[i] & A_CHARTEXT);
+        teks[len] = '\0';
+        mvaddnstr(y, x, teks, len);
+        fb_statistik.panggilan_ncurses++;
+    }
+    fb_statistik.sel_dikirim += len;
+}
+
+/**
+ * Helper: Mengirim rentang [awal, akhir] pada satu baris sebagai run-run beratribut sama
+ */
+static void fb_kirim_rentang(int y, int awal, int akhir, attr_t *atribut_terakhir) {
+    const chtype *baris = fb_belakang + (size_t)y * fb_kolom;
+
+    /* Jika rentang mencapai ekor baris yang kosong, ekor cukup dihapus dengan clrtoeol */
+    int ekor = fb_kolom;
+    while (ekor > awal && baris[ekor - 1] == FB_SEL_KOSONG) ekor--;
+    if (ekor > akhir) ekor = fb_kolom;
+
+    int x = awal;
+    int batas = (ekor < fb_kolom) ? ekor : akhir + 1;
+    while (x < batas) {
+        attr_t atribut = baris[x] & A_ATTRIBUTES;
+        int len = 1;
+        while (x + len < batas && (baris[x + len] & A_ATTRIBUTES) == atribut) len++;
+        fb_kirim_run(y, x, baris + x, len, atribut_terakhir);
+        x += len;
+    }
+
+    if (ekor < fb_kolom) {
+        if (*atribut_terakhir != A_NORMAL) {
+            attrset(A_NORMAL);
+            *atribut_terakhir = A_NORMAL;
+            fb_statistik.panggilan_ncurses++;
+        }
+        move(y, ekor);
+        clrtoeol();
+        fb_statistik.panggilan_ncurses += 2;
+    }
+}
+
+/**
+ * Helper: Menyalin perubahan frame buffer ke stdscr (belum ke terminal).
+ * Mengembalikan 1 jika ada sel yang dikirim; statistik hanya dicatat untuk frame tersebut.
+ */
+static int fb_kirim_ke_layar(void) {
+    if (!fb_pastikan_ukuran()) return 0;
+
+    StatistikFrame simpan = fb_statistik;
+    StatistikFrame stat = {0, 0, 0};
+    fb_statistik = stat;
+    attr_t atribut_terakhir = (attr_t)-1;
+
+    for (int y = 0; y < fb_baris; y++) {
+        chtype *belakang = fb_belakang + (size_t)y * fb_kolom;
+        chtype *depan = fb_depan + (size_t)y * fb_kolom;
+
+        int x = 0, baris_berubah = 0;
+        while (x < fb_kolom) {
+            while (x < fb_kolom && belakang[x] == depan[x]) x++;
+            if (x >= fb_kolom) break;
+
+            /* Perluas rentang selama celah sel yang sama masih pendek */
+            int awal = x, akhir = x, celah = 0;
+            for (x++; x < fb_kolom; x++) {
+                if (belakang[x] != depan[x]) { akhir = x; celah = 0; }
+                else if (++celah > FB_CELAH_GABUNG) break;
+            }
+
+            fb_kirim_rentang(y, awal, akhir, &atribut_terakhir);
+            baris_berubah = 1;
+            x = akhir + 1;
+        }
+
+        if (baris_berubah) {
+            memcpy(depan, belakang, (size_t)fb_kolom * sizeof(chtype));
+            fb_statistik.baris_dikirim++;
+        }
+    }
+
+    if (atribut_terakhir != A_NORMAL && atribut_terakhir != (attr_t)-1) {
+        attrset(A_NORMAL);
+        fb_statistik.panggilan_ncurses++;
+    }
+    move(fb_kursor_y, fb_kursor_x);
+    fb_statistik.panggilan_ncurses++;
+
+    if (fb_statistik.baris_dikirim == 0) {
+        fb_statistik = simpan;
+        return 0;
+    }
+    return 1;
+}
 
 /* ===== FUNGSI HELPER INTERNAL ===== */
 
@@ -62,8 +260,7 @@ static void tampilkan_pesan_berwarna(int color_pair, const char *prefix, const c
     vsnprintf(buffer, sizeof(buffer), fmt, args);
     snprintf(full_msg, sizeof(full_msg), "%s%s", prefix, buffer);
 
-    move(MSG_LINE, 0);
-    clrtoeol();
+    tui_bersihkan_baris(MSG_LINE, 0);
 
     tui_aktifkan_warna(color_pair);
     tui_cetak_tengah(MSG_LINE, full_msg);
@@ -72,8 +269,7 @@ static void tampilkan_pesan_berwarna(int color_pair, const char *prefix, const c
     tui_segarkan();
     tui_ambil_karakter();
 
-    move(MSG_LINE, 0);
-    clrtoeol();
+    tui_bersihkan_baris(MSG_LINE, 0);
 }
 
 /* ===== IMPLEMENTASI TAMPILAN & WARNA ===== */
@@ -88,33 +284,36 @@ void tui_inisialisasi_warna(void) {
     init_pair(COLOR_PAIR_YELLOW, COLOR_YELLOW, COLOR_BLACK);
 }
 
-void tui_aktifkan_warna(int pair_id) { if (has_colors()) attron(COLOR_PAIR(pair_id)); }
-void tui_nonaktifkan_warna(int pair_id) { if (has_colors()) attroff(COLOR_PAIR(pair_id)); }
-void tui_aktifkan_tebal(void) { attron(A_BOLD); }
-void tui_nonaktifkan_tebal(void) { attroff(A_BOLD); }
-void tui_aktifkan_terbalik(void) { attron(A_REVERSE); }
-void tui_nonaktifkan_terbalik(void) { attroff(A_REVERSE); }
-void tui_aktifkan_garis_bawah(void) { attron(A_UNDERLINE); }
-void tui_nonaktifkan_garis_bawah(void) { attroff(A_UNDERLINE); }
+/* Atribut disimpan di frame buffer; semantik sama dengan attron/attroff */
+void tui_aktifkan_warna(int pair_id) {
+    if (has_colors()) fb_atribut = (fb_atribut & ~A_COLOR) | COLOR_PAIR(pair_id);
+}
+void tui_nonaktifkan_warna(int pair_id) {
+    (void)pair_id;
+    if (has_colors()) fb_atribut &= ~A_COLOR;
+}
+void tui_aktifkan_tebal(void) { fb_atribut |= A_BOLD; }
+void tui_nonaktifkan_tebal(void) { fb_atribut &= ~A_BOLD; }
+void tui_aktifkan_terbalik(void) { fb_atribut |= A_REVERSE; }
+void tui_nonaktifkan_terbalik(void) { fb_atribut &= ~A_REVERSE; }
+void tui_aktifkan_garis_bawah(void) { fb_atribut |= A_UNDERLINE; }
+void tui_nonaktifkan_garis_bawah(void) { fb_atribut &= ~A_UNDERLINE; }
 
 void tui_cetak_berwarna(int y, int x, int pair_id, const char *text) {
     if (!text) return;
     tui_aktifkan_warna(pair_id);
-    mvprintw(y, x, "%s", text);
+    tui_cetak(y, x, text);
     tui_nonaktifkan_warna(pair_id);
 }
 
 void tui_cetak_tengah_berwarna(int y, int pair_id, const char *text) {
     if (!text) return;
-    int len = strlen(text);
-    int x = (COLS - len) / 2;
-    if (x < 0) x = 0;
     tui_aktifkan_warna(pair_id);
-    mvprintw(y, x, "%s", text);
+    tui_cetak_tengah(y, text);
     tui_nonaktifkan_warna(pair_id);
 }
 
-void tui_reset_atribut(void) { attrset(A_NORMAL); }
+void tui_reset_atribut(void) { fb_atribut = A_NORMAL; }
 
 int tui_inisialisasi(void) {
     if (initscr() == NULL) return 0;
@@ -129,58 +328,139 @@ int tui_inisialisasi(void) {
     return 1;
 }
 
-void tui_bersihkan(void) { curs_set(1); endwin(); }
-void tui_hapus_layar(void) { clear(); }
-void tui_segarkan(void) { refresh(); }
+void tui_bersihkan(void) {
+    curs_set(1);
+    endwin();
+    free(fb_belakang);
+    free(fb_depan);
+    fb_belakang = fb_depan = NULL;
+    fb_baris = fb_kolom = 0;
+}
+
+/* Hanya mengosongkan frame buffer; sel yang memang berubah dikirim saat segarkan */
+void tui_hapus_layar(void) {
+    if (!fb_pastikan_ukuran()) return;
+    for (int i = 0; i < fb_baris * fb_kolom; i++) fb_belakang[i] = FB_SEL_KOSONG;
+    fb_kursor_y = fb_kursor_x = 0;
+}
+
+void tui_segarkan(void) {
+#ifdef DEBUG
+    /* Tampilkan jumlah panggilan ncurses frame sebelumnya di pojok kanan atas */
+    char info[48];
+    int len = snprintf(info, sizeof(info), "[ncurses: %5d panggilan]", fb_statistik.panggilan_ncurses);
+    attr_t simpan = fb_atribut;
+    fb_atribut = A_NORMAL;
+    fb_tulis(0, COLS - len - 1, info, len);
+    fb_atribut = simpan;
+#endif
+    int terkirim = fb_kirim_ke_layar();
+    wnoutrefresh(stdscr);
+    doupdate();
+    if (terkirim) fb_statistik.panggilan_ncurses += 2;
+}
+
+void tui_paksa_gambar_ulang(void) {
+    if (fb_pastikan_ukuran()) {
+        for (int i = 0; i < fb_baris * fb_kolom; i++) fb_depan[i] = FB_SEL_INVALID;
+    }
+    clearok(curscr, TRUE);
+}
+
+void tui_ambil_statistik_frame(StatistikFrame *stat) {
+    if (stat) *stat = fb_statistik;
+}
+
 int tui_ambil_lebar(void) { return COLS; }
 int tui_ambil_tinggi(void) { return LINES; }
 
 /* ===== IMPLEMENTASI PENCETAKAN & GAMBAR ===== */
 
 void tui_cetak(int y, int x, const char *text) {
-    if (text) mvprintw(y, x, "%s", text);
+    if (text) fb_tulis(y, x, text, (int)strlen(text));
 }
 
 void tui_cetakf(int y, int x, const char *fmt, ...) {
     if (!fmt) return;
+    char buffer[512];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    if (len < 0) return;
+    if (len >= (int)sizeof(buffer)) len = sizeof(buffer) - 1;
+    fb_tulis(y, x, buffer, len);
+}
+
+void tui_cetak_baris(int y, int x, int width, const char *fmt, ...) {
+    if (!fmt) return;
+    if (width <= 0) width = COLS - x;
+    if (width <= 0) return;
+
+    char buffer[512];
     va_list args;
     va_start(args, fmt);
-    move(y, x);
-    vw_printw(stdscr, fmt, args);
+    int len = vsnprintf(buffer, sizeof(buffer), fmt, args);
     va_end(args);
+    if (len < 0) len = 0;
+    if (len >= (int)sizeof(buffer)) len = sizeof(buffer) - 1;
+    if (len > width) len = width;
+
+    fb_tulis(y, x, buffer, len);
+    /* Sisa lebar dipad dengan spasi beratribut sama */
+    if (len < width) fb_isi_sel(y, x + len, width - len, (chtype)' ' | fb_atribut);
 }
 
 void tui_cetak_tengah(int y, const char *text) {
     if (!text) return;
-    int x = (COLS - (int)strlen(text)) / 2;
+    int len = (int)strlen(text);
+    int x = (COLS - len) / 2;
     if (x < 0) x = 0;
-    mvprintw(y, x, "%s", text);
+    fb_tulis(y, x, text, len);
+}
+
+void tui_isi_rentang(int y, int x, int length, char ch) {
+    if (length <= 0) return;
+    fb_isi_sel(y, x, length, (chtype)(unsigned char)ch | fb_atribut);
+}
+
+void tui_isi_rentang_berwarna(int y, int x, int length, char ch, int pair_id) {
+    tui_aktifkan_warna(pair_id);
+    tui_isi_rentang(y, x, length, ch);
+    tui_nonaktifkan_warna(pair_id);
+}
+
+void tui_bersihkan_baris(int y, int x) {
+    if (!fb_pastikan_ukuran()) return;
+    fb_isi_sel(y, x, fb_kolom - x, FB_SEL_KOSONG);
+    fb_kursor_y = y;
+    fb_kursor_x = (x < 0) ? 0 : x;
 }
 
 void tui_gambar_garis_horizontal(int y, int x, int length, char ch) {
     if (ch == 0) ch = '-';
-    move(y, x);
-    for (int i = 0; i < length; i++) addch(ch);
+    tui_isi_rentang(y, x, length, ch);
 }
 
 void tui_gambar_kotak(int y, int x, int height, int width) {
-    mvaddch(y, x, ACS_ULCORNER);
-    for (int i = 1; i < width - 1; i++) addch(ACS_HLINE);
-    addch(ACS_URCORNER);
+    fb_isi_sel(y, x, 1, ACS_ULCORNER | fb_atribut);
+    fb_isi_sel(y, x + 1, width - 2, ACS_HLINE | fb_atribut);
+    fb_isi_sel(y, x + width - 1, 1, ACS_URCORNER | fb_atribut);
     for (int i = 1; i < height - 1; i++) {
-        mvaddch(y + i, x, ACS_VLINE);
-        mvaddch(y + i, x + width - 1, ACS_VLINE);
+        fb_isi_sel(y + i, x, 1, ACS_VLINE | fb_atribut);
+        fb_isi_sel(y + i, x + width - 1, 1, ACS_VLINE | fb_atribut);
     }
-    mvaddch(y + height - 1, x, ACS_LLCORNER);
-    for (int i = 1; i < width - 1; i++) addch(ACS_HLINE);
-    addch(ACS_LRCORNER);
+    fb_isi_sel(y + height - 1, x, 1, ACS_LLCORNER | fb_atribut);
+    fb_isi_sel(y + height - 1, x + 1, width - 2, ACS_HLINE | fb_atribut);
+    fb_isi_sel(y + height - 1, x + width - 1, 1, ACS_LRCORNER | fb_atribut);
 }
 
 /* ===== IMPLEMENTASI INPUT & KURSOR ===== */
 
-int tui_ambil_karakter(void) { return getch(); }
+/* getch() menyegarkan stdscr, jadi isi frame buffer dikirim lebih dulu */
+int tui_ambil_karakter(void) { fb_kirim_ke_layar(); return getch(); }
 void tui_atur_kursor(int visible) { curs_set(visible ? 1 : 0); }
-void tui_pindah(int y, int x) { move(y, x); }
+void tui_pindah(int y, int x) { fb_kursor_y = y; fb_kursor_x = x; }
 
 void tui_jeda(int y) {
     tui_cetak_tengah(y, "Tekan sembarang tombol untuk melanjutkan...");
@@ -189,8 +469,7 @@ void tui_jeda(int y) {
 }
 
 void bersihkan_baris_input(int y) {
-    move(y, 0);
-    clrtoeol();
+    tui_bersihkan_baris(y, 0);
 }
 
 int masukan_string(int y, int x, const char *prompt, char *buffer, int max_len) {
@@ -199,22 +478,22 @@ int masukan_string(int y, int x, const char *prompt, char *buffer, int max_len)
     tui_atur_kursor(1);
 
     int input_x = x + strlen(prompt);
-    move(y, input_x);
+    tui_pindah(y, input_x);
 
     char temp[256];
     memset(temp, 0, sizeof(temp));
     int pos = 0, ch;
 
     while (1) {
-        ch = getch();
+        ch = tui_ambil_karakter();
         if (ch == 27) { tui_atur_kursor(0); buffer[0] = '\0'; return 0; }
         if (ch == '\n' || ch == '\r' || ch == KEY_ENTER) break;
         if (ch == KEY_BACKSPACE || ch == 127 || ch == 8) {
-            if (pos > 0) { pos--; temp[pos] = '\0'; mvaddch(y, input_x + pos, ' '); move(y, input_x + pos); }
+            if (pos > 0) { pos--; temp[pos] = '\0'; tui_cetak(y, input_x + pos, " "); tui_pindah(y, input_x + pos); }
         } else if (isprint(ch) && pos < max_len - 1 && pos < 254) {
-            temp[pos] = ch; mvaddch(y, input_x + pos, ch); pos++; temp[pos] = '\0';
+            temp[pos] = ch; tui_cetakf(y, input_x + pos, "%c", ch); pos++; temp[pos] = '\0';
         }
-        refresh();
+        tui_segarkan();
     }
     tui_atur_kursor(0);
 
@@ -332,12 +611,37 @@ int menu_tambah_item(Menu *menu, const char *text, int value) {
     return 1;
 }
 
+void menu_atur_tombol_tersembunyi(Menu *menu, int tombol, int value) {
+    if (!menu) return;
+    menu->tombol_tersembunyi = tombol;
+    menu->nilai_tersembunyi = value;
+}
+
 void menu_atur_posisi(Menu *menu, int y, int x) {
     if (!menu) return;
     menu->start_y = y;
     menu->start_x = x;
 }
 
+/**
+ * Helper: Menggambar satu item menu pada posisinya
+ */
+static void gambar_item_menu(Menu *menu, int i) {
+    if (i < 0 || i >= menu->item_count) return;
+    int y = menu->start_y + (strlen(menu->title) > 0 ? 2 : 0) + i;
+    int x = menu->start_x;
+
+    if (i == menu->selected) {
+        tui_aktifkan_tebal();
+        tui_aktifkan_warna(COLOR_PAIR_HIGHLIGHT);
+        tui_cetakf(y, x, "> %d. %s  ", i + 1, menu->items[i].text);
+        tui_nonaktifkan_warna(COLOR_PAIR_HIGHLIGHT);
+        tui_nonaktifkan_tebal();
+    } else {
+        tui_cetakf(y, x, "  %d. %s  ", i + 1, menu->items[i].text);
+    }
+}
+
 void menu_tampilkan(Menu *menu) {
     if (!menu) return;
     int y = menu->start_y, x = menu->start_x;
@@ -348,19 +652,10 @@ void menu_tampilkan(Menu *menu) {
         tui_cetak(y, x, menu->title);
         tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
         tui_nonaktifkan_tebal();
-        y += 2;
     }
 
     for (int i = 0; i < menu->item_count; i++) {
-        if (i == menu->selected) {
-            tui_aktifkan_tebal();
-            tui_aktifkan_warna(COLOR_PAIR_HIGHLIGHT);
-            tui_cetakf(y + i, x, "> %d. %s  ", i + 1, menu->items[i].text);
-            tui_nonaktifkan_warna(COLOR_PAIR_HIGHLIGHT);
-            tui_nonaktifkan_tebal();
-        } else {
-            tui_cetakf(y + i, x, "  %d. %s  ", i + 1, menu->items[i].text);
-        }
+        gambar_item_menu(menu, i);
     }
 }
 
@@ -382,11 +677,22 @@ void menu_tampilkan_tengah(Menu *menu) {
 int menu_navigasi(Menu *menu) {
     if (!menu || menu->item_count == 0) return -1;
 
+    int gambar_penuh = 1;
+    int prev_selected = menu->selected;
+
     while (1) {
-        tui_hapus_layar();
-        tampilkan_header("APLIKASI KEUANGAN MAHASISWA");
-        menu_tampilkan_tengah(menu);
-        tampilkan_footer("ATAS/BAWAH: Navigasi | ENTER: Pilih | ESC: Kembali");
+        if (gambar_penuh) {
+            tui_hapus_layar();
+            tampilkan_header("APLIKASI KEUANGAN MAHASISWA");
+            menu_tampilkan_tengah(menu);
+            tampilkan_footer("ATAS/BAWAH: Navigasi | ENTER: Pilih | ESC: Kembali");
+            gambar_penuh = 0;
+        } else if (prev_selected != menu->selected) {
+            /* Hanya item lama dan item baru yang berubah */
+            gambar_item_menu(menu, prev_selected);
+            gambar_item_menu(menu, menu->selected);
+        }
+        prev_selected = menu->selected;
         tui_segarkan();
 
         int ch = tui_ambil_karakter();
@@ -401,7 +707,13 @@ int menu_navigasi(Menu *menu) {
                 return menu->items[menu->selected].value;
             case 27:
                 return CANCEL;
+            case KEY_RESIZE:
+                gambar_penuh = 1;
+                break;
             default:
+                if (menu->tombol_tersembunyi && ch == menu->tombol_tersembunyi) {
+                    return menu->nilai_tersembunyi;
+                }
                 if (ch >= '1' && ch <= '9') {
                     int idx = ch - '1';
                     if (idx < menu->item_count) {
@@ -471,16 +783,15 @@ void tampilkan_peringatan(const char *fmt, ...) {
 int tampilkan_konfirmasi(const char *message) {
     char full_msg[256];
     snprintf(full_msg, sizeof(full_msg), "%s (y/n)", message);
-    move(MSG_LINE, 0);
-    clrtoeol();
+    tui_bersihkan_baris(MSG_LINE, 0);
     tui_aktifkan_warna(COLOR_PAIR_YELLOW);
     tui_cetak_tengah(MSG_LINE, full_msg);
     tui_nonaktifkan_warna(COLOR_PAIR_YELLOW);
     tui_segarkan();
     while (1) {
         int ch = tui_ambil_karakter();
-        if (ch == 'y' || ch == 'Y') { move(MSG_LINE, 0); clrtoeol(); return 1; }
-        if (ch == 'n' || ch == 'N' || ch == 27) { move(MSG_LINE, 0); clrtoeol(); return 0; }
+        if (ch == 'y' || ch == 'Y') { tui_bersihkan_baris(MSG_LINE, 0); return 1; }
+        if (ch == 'n' || ch == 'N' || ch == 27) { tui_bersihkan_baris(MSG_LINE, 0); return 0; }
     }
 }
 
@@ -503,27 +814,57 @@ void tampilkan_kotak_pesan(const char *title, const char *message, int color_pai
 
 void tampilkan_status(const char *message) {
     if (!message) return;
-    move(LINES - 3, 0);
-    clrtoeol();
+    tui_bersihkan_baris(LINES - 3, 0);
     tui_aktifkan_warna(COLOR_PAIR_CYAN);
-    mvprintw(LINES - 3, 2, "%s", message);
+    tui_cetak(LINES - 3, 2, message);
     tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
     tui_segarkan();
 }
 
 void tampilkan_memuat(const char *message) {
     if (!message) return;
-    move(MSG_LINE, 0);
-    clrtoeol();
+    tui_bersihkan_baris(MSG_LINE, 0);
     tui_aktifkan_warna(COLOR_PAIR_YELLOW);
     tui_cetak_tengah(MSG_LINE, message);
     tui_nonaktifkan_warna(COLOR_PAIR_YELLOW);
     tui_segarkan();
 }
 
+int tui_tunggu_pekerja(const char *message) {
+    if (pekerja_sibuk()) {
+        static const char putaran[] = "|/-\\";
+        int tertunda[MAX_TOMBOL_TERTUNDA];
+        int jumlah_tertunda = 0, frame = 0;
+        char buffer[128];
+
+        /* Input tidak memblokir selama menunggu, layar tetap hidup */
+        halfdelay(JEDA_SPINNER);
+        while (pekerja_sibuk()) {
+            snprintf(buffer, sizeof(buffer), "%c %s", putaran[frame++ % 4],
+                     message ? message : "Memproses data...");
+            tampilkan_memuat(buffer);
+
+            int ch = tui_ambil_karakter();
+            if (ch != ERR && ch != KEY_RESIZE && jumlah_tertunda < MAX_TOMBOL_TERTUNDA) {
+                tertunda[jumlah_tertunda++] = ch;
+            }
+        }
+        cbreak();
+        bersihkan_area_pesan();
+
+        /* ungetch bersifat tumpukan, jadi dikembalikan dari yang terakhir */
+        for (int i = jumlah_tertunda - 1; i >= 0; i--) ungetch(tertunda[i]);
+    }
+
+    if (pekerja_ambil_jumlah_gagal() > 0) {
+        tampilkan_error("Sebagian perhitungan latar belakang gagal");
+        return 0;
+    }
+    return 1;
+}
+
 void bersihkan_area_pesan(void) {
-    move(MSG_LINE, 0);
-    clrtoeol();
+    tui_bersihkan_baris(MSG_LINE, 0);
     tui_segarkan();
 }
 
@@ -559,7 +900,7 @@ int tabel_gambar_header(Table *table) {
     tui_aktifkan_tebal();
     tui_aktifkan_warna(COLOR_PAIR_CYAN);
     for (int i = 0; i < table->col_count; i++) {
-        mvprintw(y, x, "%*s", table->columns[i].width, table->columns[i].header);
+        tui_cetakf(y, x, "%*s", table->columns[i].width, table->columns[i].header);
         x += table->columns[i].width + 1;
     }
     tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
@@ -587,16 +928,16 @@ void tabel_gambar_baris(Table *table, int row, int selected, const char **values
 
         switch (table->columns[i].align) {
             case ALIGN_RIGHT:
-                mvprintw(y, x, "%*s", w, val);
+                tui_cetakf(y, x, "%*s", w, val);
                 break;
             case ALIGN_CENTER: {
                 int pad = (w - (int)strlen(val)) / 2;
                 if (pad < 0) pad = 0;
-                mvprintw(y, x + pad, "%*s", w - pad, val);
+                tui_cetakf(y, x + pad, "%*s", w - pad, val);
                 break;
             }
             default:
-                mvprintw(y, x, "%*s", w, val);
+                tui_cetakf(y, x, "%*s", w, val);
                 break;
         }
         x += w + 1;
@@ -617,48 +958,257 @@ void tabel_gambar_pemisah(Table *table, int y) {
     tui_gambar_garis_horizontal(y, table->start_x, total_width - 1, '-');
 }
 
-int tampilkan_tabel_transaksi(Transaksi *list, int count, int start_y, int selected) {
-    Table table;
-    tabel_inisialisasi(&table);
-    tabel_atur_posisi(&table, start_y, 2);
+int tabel_hitung_baris_muat(int start_y, int reserved_bottom) {
+    /* Header dan pemisah tabel memakan dua baris */
+    int rows = tui_ambil_tinggi() - (start_y + 2) - reserved_bottom;
+    return (rows < TABLE_MIN_ROWS) ? TABLE_MIN_ROWS : rows;
+}
 
-    tabel_tambah_kolom(&table, "No", 4, ALIGN_RIGHT);
-    tabel_tambah_kolom(&table, "ID", 6, ALIGN_LEFT);
-    tabel_tambah_kolom(&table, "Tanggal", 12, ALIGN_CENTER);
-    tabel_tambah_kolom(&table, "Jenis", 12, ALIGN_LEFT);
-    tabel_tambah_kolom(&table, "Pos", 15, ALIGN_LEFT);
-    tabel_tambah_kolom(&table, "Nominal", 15, ALIGN_RIGHT);
-    tabel_tambah_kolom(&table, "Deskripsi", 20, ALIGN_LEFT);
+void tabel_viewport_inisialisasi(TableViewport *view, int max_rows) {
+    if (!view) return;
+    view->offset = 0;
+    view->max_rows = (max_rows < 1) ? 1 : max_rows;
+    for (int i = 0; i < KAPASITAS_CACHE_TAMPILAN; i++) {
+        view->cache[i].indeks = -1;
+    }
+    tabel_viewport_invalidasi(view);
+}
+
+void tabel_viewport_invalidasi(TableViewport *view) {
+    if (!view) return;
+    view->drawn_offset = -1;
+    view->drawn_selected = -1;
+    view->drawn_count = -1;
+}
+
+int tabel_viewport_sudah_digambar(const TableViewport *view) {
+    return view && view->drawn_count >= 0;
+}
+
+void tabel_viewport_ikuti(TableViewport *view, int selected, int count) {
+    if (!view) return;
+    if (view->max_rows < 1) view->max_rows = 1;
+
+    if (selected >= 0 && selected < count) {
+        if (selected < view->offset) {
+            view->offset = selected;
+        } else if (selected >= view->offset + view->max_rows) {
+            view->offset = selected - view->max_rows + 1;
+        }
+    }
+
+    /* Jangan sisakan baris kosong di bawah selama data masih cukup */
+    if (view->offset > count - view->max_rows) view->offset = count - view->max_rows;
+    if (view->offset < 0) view->offset = 0;
+}
+
+int tabel_navigasi(int ch, int *selected, int count, int page) {
+    if (!selected || count <= 0) return 0;
+    if (page < 1) page = 1;
+
+    int baru = *selected;
+    switch (ch) {
+        case KEY_UP: case 'k':      baru--; break;
+        case KEY_DOWN: case 'j':    baru++; break;
+        case KEY_PPAGE:             baru -= page; break;
+        case KEY_NPAGE:             baru += page; break;
+        case KEY_HOME: case 'g':    baru = 0; break;
+        case KEY_END: case 'G':     baru = count - 1; break;
+        default:
+            return 0;
+    }
+
+    if (baru < 0) baru = 0;
+    if (baru > count - 1) baru = count - 1;
+    *selected = baru;
+    return 1;
+}
+
+/**
+ * Helper: Menentukan rentang data yang terlihat, mengembalikan jumlah baris
+ */
+static int tentukan_jendela_tabel(TableViewport *view, int start_y, int selected, int count, int *first) {
+    TableViewport lokal;
+    if (!view) {
+        tabel_viewport_inisialisasi(&lokal, tabel_hitung_baris_muat(start_y, 4));
+        view = &lokal;
+    }
+    tabel_viewport_ikuti(view, selected, count);
+
+    *first = view->offset;
+    int rows = count - view->offset;
+    return (rows > view->max_rows) ? view->max_rows : rows;
+}
+
+/**
+ * Helper: Menampilkan posisi jendela jika data lebih panjang dari layar
+ */
+static void gambar_indikator_gulir(int y, int first, int rows, int count) {
+    if (rows >= count) return;
+    char buffer[64];
+    /* Dipad agar sisa teks indikator sebelumnya ikut tertimpa */
+    snprintf(buffer, sizeof(buffer), "Baris %d-%d dari %d", first + 1, first + rows, count);
+    tui_aktifkan_warna(COLOR_PAIR_CYAN);
+    tui_cetakf(y, 4, "%-40s", buffer);
+    tui_nonaktifkan_warna(COLOR_PAIR_CYAN);
+}
+
+/* Callback untuk menggambar baris data ke-index pada baris layar row */
+typedef void (*PenggambarBaris)(Table *table, const void *list, int index, int row, int selected,
+                                TableViewport *view);
+
+/**
+ * Helper: Mengambil entri cache tampilan untuk baris data index.
+ * Jika entri belum ada atau nilai sumbernya berubah, entri diambil alih dan
+ * *baru diisi 1 agar pemanggil memformat ulang sel. Tanpa viewport, entri
+ * cadangan milik pemanggil yang dipakai.
+ */
+static EntriTampilan *ambil_entri_tampilan(TableViewport *view, EntriTampilan *cadangan, int index,
+                                           const unsigned long long *kunci, int *baru) {
+    EntriTampilan *e = view ? &view->cache[index % KAPASITAS_CACHE_TAMPILAN] : cadangan;
+
+    if (view && e->indeks == index && memcmp(e->kunci, kunci, sizeof(e->kunci)) == 0) {
+        *baru = 0;
+        return e;
+    }
 
-    int row_y = tabel_gambar_header(&table);
+    e->indeks = index;
+    memcpy(e->kunci, kunci, sizeof(e->kunci));
+    *baru = 1;
+    return e;
+}
+
+/**
+ * Helper: Menggambar tabel di dalam viewport dengan pelacakan area rusak.
+ * Jika jendela tidak bergeser, hanya baris sorotan lama dan baru yang digambar.
+ */
+static int gambar_tabel_viewport(Table *table, const void *list, int count, int selected,
+                                 TableViewport *view, PenggambarBaris gambar,
+                                 const char *pesan_kosong) {
+    int row_y = table->start_y + 2;
 
     if (count == 0) {
-        tui_cetak(row_y, 4, "(Tidak ada transaksi)");
+        if (!tabel_viewport_sudah_digambar(view) || view->drawn_count != 0) {
+            tabel_gambar_header(table);
+            tui_cetak(row_y, 4, pesan_kosong);
+        }
+        if (view) {
+            view->drawn_offset = 0;
+            view->drawn_selected = -1;
+            view->drawn_count = 0;
+        }
         return row_y + 2;
     }
 
-    char no_str[16], nominal_str[30];
+    int first;
+    int rows = tentukan_jendela_tabel(view, table->start_y, selected, count, &first);
+
+    int sebagian = tabel_viewport_sudah_digambar(view) &&
+                   view->drawn_count == count && view->drawn_offset == first;
+
+    if (sebagian) {
+        int lama = view->drawn_selected;
+        if (lama != selected) {
+            if (lama >= first && lama < first + rows) gambar(table, list, lama, lama - first, 0, view);
+            if (selected >= first && selected < first + rows) gambar(table, list, selected, selected - first, 1, view);
+        }
+    } else {
+        tabel_gambar_header(table);
+        /* Hanya baris di dalam jendela yang diformat dan digambar */
+        for (int i = first; i < first + rows; i++) {
+            gambar(table, list, i, i - first, (i == selected), view);
+        }
+        gambar_indikator_gulir(row_y + rows, first, rows, count);
+    }
+
+    if (view) {
+        view->drawn_offset = first;
+        view->drawn_selected = selected;
+        view->drawn_count = count;
+    }
+
+    return row_y + rows + 1;
+}
+
+/**
+ * Helper: Menggambar satu baris transaksi
+ */
+static void gambar_baris_transaksi(Table *table, const void *data, int i, int row, int selected,
+                                   TableViewport *view) {
+    const Transaksi *list = (const Transaksi *)data;
     const char *values[7];
 
-    for (int i = 0; i < count; i++) {
-        snprintf(no_str, sizeof(no_str), "%d", i + 1);
-        format_rupiah(list[i].nominal, nominal_str);
+    /* Nomor baris cukup dari index; hanya nominal yang menjadi kunci */
+    unsigned long long kunci[MAX_SEL_TAMPILAN] = { list[i].nominal, 0, 0, 0 };
+    EntriTampilan cadangan;
+    int baru;
+    EntriTampilan *e = ambil_entri_tampilan(view, &cadangan, i, kunci, &baru);
+    if (baru) {
+        snprintf(e->sel[0], UKURAN_SEL_TAMPILAN, "%d", i + 1);
+        format_rupiah(list[i].nominal, e->sel[1]);
+    }
+
+    values[0] = e->sel[0];
+    values[1] = list[i].id;
+    values[2] = list[i].tanggal;
+    values[3] = dapatkan_label_jenis(list[i].jenis);
+    values[4] = list[i].pos;
+    values[5] = e->sel[1];
+    values[6] = list[i].deskripsi;
+
+    tabel_gambar_baris(table, row, selected, values);
+}
 
-        values[0] = no_str;
-        values[1] = list[i].id;
-        values[2] = list[i].tanggal;
-        values[3] = dapatkan_label_jenis(list[i].jenis);
-        values[4] = list[i].pos;
-        values[5] = nominal_str;
-        values[6] = list[i].deskripsi;
+/**
+ * Helper: Menggambar satu baris pos anggaran
+ */
+static void gambar_baris_pos(Table *table, const void *data, int i, int row, int selected,
+                             TableViewport *view) {
+    const PosAnggaran *list = (const PosAnggaran *)data;
+    const char *values[6];
 
-        tabel_gambar_baris(&table, i, (i == selected), values);
+    unsigned long long kunci[MAX_SEL_TAMPILAN] = {
+        (unsigned long long)list[i].no, list[i].nominal,
+        list[i].realisasi, (unsigned long long)list[i].sisa
+    };
+    EntriTampilan cadangan;
+    int baru;
+    EntriTampilan *e = ambil_entri_tampilan(view, &cadangan, i, kunci, &baru);
+    if (baru) {
+        snprintf(e->sel[0], UKURAN_SEL_TAMPILAN, "%d", list[i].no);
+        format_rupiah(list[i].nominal, e->sel[1]);
+        format_rupiah(list[i].realisasi, e->sel[2]);
+        format_saldo(list[i].sisa, e->sel[3]);
     }
 
-    return row_y + count + 1;
+    values[0] = e->sel[0];
+    values[1] = list[i].nama;
+    values[2] = e->sel[1];
+    values[3] = e->sel[2];
+    values[4] = e->sel[3];
+    values[5] = (list[i].status == STATUS_AMAN) ? "Aman" : "Tidak Aman";
+
+    tabel_gambar_baris(table, row, selected, values);
 }
 
-int tampilkan_tabel_pos(PosAnggaran *list, int count, int start_y, int selected) {
+int tampilkan_tabel_transaksi(const Transaksi *list, int count, int start_y, int selected, TableViewport *view) {
+    Table table;
+    tabel_inisialisasi(&table);
+    tabel_atur_posisi(&table, start_y, 2);
+
+    tabel_tambah_kolom(&table, "No", 4, ALIGN_RIGHT);
+    tabel_tambah_kolom(&table, "ID", 6, ALIGN_LEFT);
+    tabel_tambah_kolom(&table, "Tanggal", 12, ALIGN_CENTER);
+    tabel_tambah_kolom(&table, "Jenis", 12, ALIGN_LEFT);
+    tabel_tambah_kolom(&table, "Pos", 15, ALIGN_LEFT);
+    tabel_tambah_kolom(&table, "Nominal", 15, ALIGN_RIGHT);
+    tabel_tambah_kolom(&table, "Deskripsi", 20, ALIGN_LEFT);
+
+    return gambar_tabel_viewport(&table, list, count, selected, view,
+                                 gambar_baris_transaksi, "(Tidak ada transaksi)");
+}
+
+int tampilkan_tabel_pos(const PosAnggaran *list, int count, int start_y, int selected, TableViewport *view) {
     Table table;
     tabel_inisialisasi(&table);
     tabel_atur_posisi(&table, start_y, 2);
@@ -670,31 +1220,6 @@ int tampilkan_tabel_pos(PosAnggaran *list, int count, int start_y, int selected)
     tabel_tambah_kolom(&table, "Sisa", 15, ALIGN_RIGHT);
     tabel_tambah_kolom(&table, "Status", 12, ALIGN_CENTER);
 
-    int row_y = tabel_gambar_header(&table);
-
-    if (count == 0) {
-        tui_cetak(row_y, 4, "(Tidak ada pos anggaran)");
-        return row_y + 2;
-    }
-
-    char no_str[16], anggaran_str[30], realisasi_str[30], sisa_str[30];
-    const char *values[6];
-
-    for (int i = 0; i < count; i++) {
-        snprintf(no_str, sizeof(no_str), "%d", list[i].no);
-        format_rupiah(list[i].nominal, anggaran_str);
-        format_rupiah(list[i].realisasi, realisasi_str);
-        format_saldo(list[i].sisa, sisa_str);
-
-        values[0] = no_str;
-        values[1] = list[i].nama;
-        values[2] = anggaran_str;
-        values[3] = realisasi_str;
-        values[4] = sisa_str;
-        values[5] = (list[i].status == STATUS_AMAN) ? "Aman" : "Tidak Aman";
-
-        tabel_gambar_baris(&table, i, (i == selected), values);
-    }
-
-    return row_y + count + 1;
+    return gambar_tabel_viewport(&table, list, count, selected, view,
+                                 gambar_baris_pos, "(Tidak ada pos anggaran)");
 }
@@ -23,6 +23,8 @@
  * - ctype.h     : Untuk pengecekan dan konversi karakter (isdigit, tolower)
  * - time.h      : Untuk mendapatkan tanggal/waktu sistem (localtime)
  * - errno.h     : Untuk penanganan error pada konversi numerik
+ * - limits.h    : Untuk batas tipe pada konversi angka cepat
+ * - sys/stat.h  : Untuk struct stat pada stat_sama
  * - utils.h     : Header file modul ini
  * - pos.h       : Untuk definisi struct PosAnggaran
  * - transaksi.h : Untuk definisi struct Transaksi
@@ -40,6 +42,8 @@
 #include <ctype.h>
 #include <time.h>
 #include <errno.h>
+#include <limits.h>
+#include <sys/stat.h>
 #include "utils.h"
 #include "pos.h"
 #include "transaksi.h"
@@ -93,6 +97,19 @@ static const int days_in_month[] = {
     0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
 };
 
+/* Tabel pasangan digit "00".."99" untuk menulis dua digit sekaligus */
+static const char PASANGAN_DIGIT[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
 /* ===== FUNGSI HELPER INTERNAL ===== */
 
 /**
@@ -126,6 +143,56 @@ static int banding_str_nocase(const char *s1, const char *s2) {
     return tolower((unsigned char)*s1) - tolower((unsigned char)*s2);
 }
 
+/**
+ * Helper: Membaca tanda dan digit desimal dari rentang (aturan strtoull/strtoll)
+ * I.S.: rentang berisi teks angka, boleh diawali whitespace dan tanda +/-
+ * F.S.: nilai berisi besaran angka (jenuh di ULLONG_MAX), negatif berisi 1 jika bertanda '-'
+ * Mengembalikan 1 jika besaran melebihi unsigned long long, 0 jika tidak
+ */
+static int urai_desimal(RentangTeks rentang, unsigned long long *nilai, int *negatif) {
+    const char *p = rentang.ptr;
+    const char *akhir = (p != NULL && rentang.len > 0) ? p + rentang.len : p;
+    unsigned long long hasil = 0;
+    int luber = 0;
+
+    *negatif = 0;
+    while (p < akhir && isspace((unsigned char)*p)) p++;
+    if (p < akhir && (*p == '+' || *p == '-')) {
+        *negatif = (*p == '-');
+        p++;
+    }
+
+    for (; p < akhir && *p >= '0' && *p <= '9'; p++) {
+        unsigned int digit = (unsigned int)(*p - '0');
+        if (hasil > (ULLONG_MAX - digit) / 10) {
+            luber = 1;
+            hasil = ULLONG_MAX;
+            continue;
+        }
+        hasil = hasil * 10 + digit;
+    }
+
+    *nilai = hasil;
+    return luber;
+}
+
+/**
+ * Helper: Konversi rentang ke long long dengan batas min/maks (aturan strtoll/strtol)
+ */
+static long long urai_desimal_bertanda(RentangTeks rentang, long long min, long long maks) {
+    unsigned long long besaran;
+    int negatif;
+    int luber = urai_desimal(rentang, &besaran, &negatif);
+
+    if (negatif) {
+        unsigned long long batas = (unsigned long long)maks + 1;   /* |min| */
+        if (luber || besaran >= batas) return min;
+        return -(long long)besaran;
+    }
+    if (luber || besaran > (unsigned long long)maks) return maks;
+    return (long long)besaran;
+}
+
 /* ===== IMPLEMENTASI MANAJEMEN MEMORI ===== */
 
 /**
@@ -468,6 +535,37 @@ int dapatkan_jumlah_hari_bulan(int month, int year) {
     return days_in_month[month];
 }
 
+/**
+ * Mengubah tanggal menjadi nomor hari sejak 01-01-1970 (kalender Gregorian proleptik)
+ */
+long long tanggal_ke_nomor_hari(int d, int m, int y) {
+    /* Tahun dimulai Maret agar hari kabisat jatuh di akhir tahun */
+    long long tahun = (m <= 2) ? (long long)y - 1 : y;
+    long long era = (tahun >= 0 ? tahun : tahun - 399) / 400;
+    long long tahun_era = tahun - era * 400;
+    long long hari_tahun = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    long long hari_era = tahun_era * 365 + tahun_era / 4 - tahun_era / 100 + hari_tahun;
+
+    return era * 146097 + hari_era - 719468;
+}
+
+/**
+ * Mengubah nomor hari sejak 01-01-1970 kembali menjadi tanggal
+ */
+void nomor_hari_ke_tanggal(long long nomor, int *d, int *m, int *y) {
+    nomor += 719468;
+    long long era = (nomor >= 0 ? nomor : nomor - 146096) / 146097;
+    long long hari_era = nomor - era * 146097;
+    long long tahun_era = (hari_era - hari_era / 1460 + hari_era / 36524 - hari_era / 146096) / 365;
+    long long hari_tahun = hari_era - (365 * tahun_era + tahun_era / 4 - tahun_era / 100);
+    long long mp = (5 * hari_tahun + 2) / 153;
+    int bulan = (int)(mp < 10 ? mp + 3 : mp - 9);
+
+    if (d) *d = (int)(hari_tahun - (153 * mp + 2) / 5 + 1);
+    if (m) *m = bulan;
+    if (y) *y = (int)(tahun_era + era * 400 + (bulan <= 2));
+}
+
 /**
  * Mengekstrak bulan dari string tanggal
  */
@@ -540,6 +638,43 @@ void format_angka_pemisah(unsigned long long nominal, char *result) {
     strcpy(result, formatted);
 }
 
+/**
+ * Menulis angka desimal tanpa tanda, dua digit per langkah
+ */
+int tulis_desimal_ull(unsigned long long nilai, char *buf) {
+    char tmp[20];
+    int pos = 20;
+
+    while (nilai >= 100) {
+        unsigned int dua = (unsigned int)(nilai % 100) * 2;
+        nilai /= 100;
+        tmp[--pos] = PASANGAN_DIGIT[dua + 1];
+        tmp[--pos] = PASANGAN_DIGIT[dua];
+    }
+    if (nilai >= 10) {
+        unsigned int dua = (unsigned int)nilai * 2;
+        tmp[--pos] = PASANGAN_DIGIT[dua + 1];
+        tmp[--pos] = PASANGAN_DIGIT[dua];
+    } else {
+        tmp[--pos] = (char)('0' + nilai);
+    }
+
+    memcpy(buf, tmp + pos, 20 - pos);
+    return 20 - pos;
+}
+
+/**
+ * Menulis angka desimal bertanda
+ */
+int tulis_desimal_ll(long long nilai, char *buf) {
+    if (nilai < 0) {
+        buf[0] = '-';
+        /* Negasi lewat unsigned agar LLONG_MIN tidak luber */
+        return 1 + tulis_desimal_ull(0ULL - (unsigned long long)nilai, buf + 1);
+    }
+    return tulis_desimal_ull((unsigned long long)nilai, buf);
+}
+
 /**
  * Memformat nominal ke format Rupiah dengan separator ribuan
  */
@@ -751,6 +886,90 @@ int pisah_string(char *str, char delim, char **result, int max_parts) {
     return count;
 }
 
+/**
+ * Memisahkan string menjadi rentang field yang sudah dipangkas
+ * Catatan: Tidak memodifikasi string dan tidak memakai state global,
+ * sehingga aman dipanggil dari beberapa thread sekaligus
+ */
+int pisah_rentang(const char *str, char delim, RentangTeks *hasil, int maks) {
+    if (str == NULL || hasil == NULL || maks <= 0) return 0;
+
+    int count = 0;
+    const char *awal = str;
+
+    while (count < maks) {
+        /* Cari akhir field: delimiter berikutnya atau akhir string */
+        const char *akhir = awal;
+        while (*akhir != '\0' && *akhir != delim) {
+            akhir++;
+        }
+
+        /* Pangkas whitespace di kedua sisi tanpa menyalin */
+        const char *kiri = awal;
+        const char *kanan = akhir;
+        while (kiri < kanan && isspace((unsigned char)*kiri)) kiri++;
+        while (kanan > kiri && isspace((unsigned char)*(kanan - 1))) kanan--;
+
+        hasil[count].ptr = kiri;
+        hasil[count].len = (int)(kanan - kiri);
+        count++;
+
+        if (*akhir == '\0') break;
+        awal = akhir + 1;
+    }
+
+    return count;
+}
+
+/**
+ * Menyalin rentang teks ke buffer dengan batasan ukuran
+ */
+void salin_rentang(char *dst, RentangTeks rentang, int max) {
+    if (dst == NULL || max <= 0) return;
+
+    int len = rentang.len < max - 1 ? rentang.len : max - 1;
+    if (len < 0 || rentang.ptr == NULL) len = 0;
+    if (len > 0) memcpy(dst, rentang.ptr, len);
+    dst[len] = '\0';
+}
+
+/**
+ * Konversi rentang teks ke unsigned long long
+ * Catatan: Hasil sama dengan strtoull basis 10, termasuk jenuh saat luber
+ * dan negasi modular untuk tanda '-'
+ */
+unsigned long long rentang_ke_ull(RentangTeks rentang) {
+    unsigned long long besaran;
+    int negatif;
+
+    if (urai_desimal(rentang, &besaran, &negatif)) return ULLONG_MAX;
+    return negatif ? (0ULL - besaran) : besaran;
+}
+
+/**
+ * Konversi rentang teks ke long long
+ */
+long long rentang_ke_ll(RentangTeks rentang) {
+    return urai_desimal_bertanda(rentang, LLONG_MIN, LLONG_MAX);
+}
+
+/**
+ * Konversi rentang teks ke int
+ * Catatan: Sama seperti atoi (strtol lalu dipotong ke int)
+ */
+int rentang_ke_int(RentangTeks rentang) {
+    return (int)urai_desimal_bertanda(rentang, LONG_MIN, LONG_MAX);
+}
+
+/**
+ * Konversi rentang teks ke double
+ */
+double rentang_ke_double(RentangTeks rentang) {
+    char buf[64];
+    salin_rentang(buf, rentang, sizeof(buf));
+    return atof(buf);
+}
+
 /**
  * Memeriksa apakah string kosong (hanya whitespace atau NULL)
  */
@@ -798,6 +1017,35 @@ void hapus_newline_string(char *str) {
     }
 }
 
+/**
+ * Menghitung hash FNV-1a 64-bit, bisa dilanjutkan dari hash sebelumnya
+ */
+unsigned long long hash_fnv1a(const void *data, unsigned long panjang, unsigned long long hash) {
+    const unsigned char *p = (const unsigned char *)data;
+
+    for (unsigned long i = 0; i < panjang; i++) {
+        hash ^= p[i];
+        hash *= HASH_FNV_PRIMA;
+    }
+    return hash;
+}
+
+/**
+ * Menambahkan satu baris beserta newline ke hash berjalan
+ */
+unsigned long long hash_baris(unsigned long long hash, const char *line) {
+    hash = hash_fnv1a(line, strlen(line), hash);
+    return hash_fnv1a("\n", 1, hash);
+}
+
+/**
+ * Membandingkan identitas dan versi file dari dua hasil stat
+ */
+int stat_sama(const struct stat *a, const struct stat *b) {
+    return a->st_ino == b->st_ino && a->st_dev == b->st_dev && a->st_size == b->st_size &&
+           a->st_mtim.tv_sec == b->st_mtim.tv_sec && a->st_mtim.tv_nsec == b->st_mtim.tv_nsec;
+}
+
 /* ===== IMPLEMENTASI FUNGSI VALIDASI (dipindahkan dari validator.c) ===== */
 
 /**
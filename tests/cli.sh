@@ -0,0 +1,247 @@
+#!/bin/sh
+# ============================================================
+# tests/cli.sh - Uji perintah CLI keuangan
+# Kelompok B11 - Dasar Pemrograman 2025
+# ============================================================
+#
+# Menjalankan binary keuangan di direktori kerja sementara (data asli tidak
+# disentuh) dan memeriksa kode keluar serta isi data/transaksi.txt.
+# Penggunaan: tests/cli.sh [keuangan] [keuangan_gen] [pos_tertutup]   (dipanggil oleh make test)
+
+KEUANGAN=$(cd "$(dirname "${1:-./keuangan}")" && pwd)/$(basename "${1:-./keuangan}")
+GEN=$(cd "$(dirname "${2:-./keuangan_gen}")" && pwd)/$(basename "${2:-./keuangan_gen}")
+POS_TERTUTUP=$(cd "$(dirname "${3:-./build/pos_tertutup}")" && pwd)/$(basename "${3:-./build/pos_tertutup}")
+KERJA=$(mktemp -d)
+trap 'rm -rf "$KERJA"' EXIT
+cd "$KERJA" || exit 1
+
+GAGAL=0
+
+# Helper: jalankan perintah dan bandingkan kode keluarnya
+harap_keluar() {
+    harapan=$1
+    nama=$2
+    shift 2
+    "$KEUANGAN" "$@" >/dev/null 2>&1
+    kode=$?
+    if [ "$kode" -eq "$harapan" ]; then
+        echo "OK    $nama"
+    else
+        echo "GAGAL $nama (kode keluar $kode, harapan $harapan)"
+        GAGAL=1
+    fi
+}
+
+# Helper: pastikan jumlah baris data/transaksi.txt sesuai harapan
+harap_baris() {
+    harapan=$1
+    nama=$2
+    baris=0
+    [ -f data/transaksi.txt ] && baris=$(wc -l < data/transaksi.txt)
+    if [ "$baris" -eq "$harapan" ]; then
+        echo "OK    $nama"
+    else
+        echo "GAGAL $nama ($baris baris, harapan $harapan)"
+        GAGAL=1
+    fi
+}
+
+# Helper: cek kondisi sembarang (perintah shell) dengan nama uji
+periksa() {
+    nama=$1
+    shift
+    if "$@" >/dev/null 2>&1; then
+        echo "OK    $nama"
+    else
+        echo "GAGAL $nama"
+        GAGAL=1
+    fi
+}
+
+# Helper: mulai bagian uji dengan direktori data kosong
+data_baru() {
+    rm -rf data
+    mkdir data
+}
+
+# ===== add: validasi pos =====
+
+harap_keluar 1 "add menolak pos berisi |" \
+    add --tanggal 01-03-2026 --jenis pengeluaran --pos 'Makan|X' --nominal 1000
+harap_keluar 1 "add menolak pos lebih dari 20 karakter" \
+    add --tanggal 01-03-2026 --jenis pengeluaran --pos 'PosDenganNamaSangatPanjang' --nominal 1000
+harap_baris 0 "transaksi ditolak tidak ditulis"
+
+harap_keluar 0 "add pos valid" \
+    add --tanggal 01-03-2026 --jenis pengeluaran --pos Makan --nominal 1000
+harap_baris 1 "transaksi valid ditulis"
+
+# ===== add/import: nomor ID habis =====
+
+echo 'T999999999|02-03-2026|Pengeluaran|Makan|1000|' >> data/transaksi.txt
+harap_keluar 1 "add menolak saat nomor ID habis" \
+    add --tanggal 03-03-2026 --jenis pengeluaran --pos Makan --nominal 1000
+printf '03-03-2026,pengeluaran,Makan,1000,\n' > impor.csv
+harap_keluar 1 "import menolak saat nomor ID habis" import impor.csv
+harap_baris 2 "tidak ada transaksi dengan ID terpotong"
+
+# ===== import/export: kutip CSV, CRLF, penolakan, dan semua-atau-tidak-sama-sekali =====
+
+data_baru
+printf 'tanggal,jenis,pos,nominal,deskripsi\r\n' > impor.csv
+printf '01-03-2026,pengeluaran,Makan,1000,"Nasi, ""padang"""\r\n' >> impor.csv
+printf '02-03-2026,pemasukan,Gaji,50000,\r\n' >> impor.csv
+harap_keluar 0 "import CSV berkutip dan CRLF" import impor.csv
+harap_baris 2 "baris header dilewati"
+periksa "field berkutip berisi koma dan kutip ganda" grep -qF '|Nasi, "padang"' data/transaksi.txt
+periksa "CR tidak ikut tersimpan" sh -c "! grep -q \"$(printf '\r')\" data/transaksi.txt"
+periksa "nominal baris CRLF terbaca" grep -q '|Gaji|50000|' data/transaksi.txt
+
+"$KEUANGAN" export transaksi --format csv > ekspor_stdout.csv 2>/dev/null
+harap_keluar 0 "export ke file" export transaksi --format csv --keluar ekspor.csv
+periksa "export ke file sama dengan stdout" cmp ekspor_stdout.csv ekspor.csv
+periksa "export CSV mengutip koma dan kutip ganda" grep -qF '"Nasi, ""padang"""' ekspor.csv
+periksa "export tidak meninggalkan file sementara" test ! -e ekspor.csv.tmp
+
+mkdir ekspor.csv.tmp
+harap_keluar 1 "export gagal jika file sementara tidak bisa ditulis" export transaksi --keluar ekspor.csv
+periksa "export gagal tidak mengubah file tujuan" cmp ekspor_stdout.csv ekspor.csv
+rmdir ekspor.csv.tmp
+
+printf '03-03-2026,pengeluaran,Makan,2000,\n32-03-2026,pengeluaran,Makan,2000,\n' > impor.csv
+"$KEUANGAN" import impor.csv > /dev/null 2> impor.err
+periksa "import dengan baris ditolak keluar 1" test $? -eq 1
+periksa "baris ditolak dilaporkan dengan nomornya" grep -q '^error: baris 2:' impor.err
+harap_baris 3 "baris valid tetap masuk, baris ditolak tidak"
+
+mkdir data/transaksi.txt.tmp
+printf '04-03-2026,pengeluaran,Makan,3000,\n' > impor.csv
+harap_keluar 1 "import gagal jika file sementara tidak bisa ditulis" import impor.csv
+harap_baris 3 "import gagal tidak mengubah file transaksi"
+rmdir data/transaksi.txt.tmp
+
+echo 'T999999998|05-03-2026|Pengeluaran|Makan|1000|' >> data/transaksi.txt
+printf '06-03-2026,pengeluaran,Makan,1000,\n07-03-2026,pengeluaran,Makan,1000,\n' > impor.csv
+harap_keluar 1 "import dibatalkan seluruhnya saat ID habis di tengah" import impor.csv
+harap_baris 4 "tidak ada baris impor yang tertulis sebagian"
+
+# ===== compact: baris rusak dipindah, bukan dihapus =====
+
+data_baru
+printf 'T0001|01-03-2026|Pengeluaran|Makan|1000|\nbaris rusak\n\n' > data/transaksi.txt
+harap_keluar 0 "compact berhasil" compact
+harap_baris 1 "baris rusak dan kosong keluar dari transaksi.txt"
+periksa "baris rusak tersimpan di transaksi.txt.rusak" grep -qx 'baris rusak' data/transaksi.txt.rusak
+
+# ===== close: hanya bulan yang sudah lewat =====
+
+data_baru
+BULAN_INI=$(date +%m | sed 's/^0//')
+harap_keluar 1 "close menolak bulan berjalan" close --bulan "$BULAN_INI"
+harap_keluar 1 "close menolak bulan mendatang" close --bulan 12
+periksa "close bulan mendatang tidak menulis snapshot" test ! -e data/tutup_12.txt
+harap_keluar 0 "add di bulan mendatang tetap bisa" \
+    add --tanggal 05-12-2026 --jenis pengeluaran --pos Makan --nominal 1000
+
+# ===== close: laporan dan ekspor memakai agregat snapshot =====
+
+# Bulan tertutup harus sudah lewat; di bulan Januari bagian ini dilewati
+BULAN_LALU=$((BULAN_INI - 1))
+TGL_LALU=$(printf '03-%02d-2026' "$BULAN_LALU")
+
+if [ "$BULAN_LALU" -ge 1 ]; then
+    data_baru
+    "$KEUANGAN" add --tanggal "$TGL_LALU" --jenis pengeluaran --pos Makan --nominal 12000 >/dev/null 2>&1
+    harap_keluar 0 "close bulan lalu" close --bulan "$BULAN_LALU"
+    echo "T0099|$TGL_LALU|Pengeluaran|Makan|1000|" >> data/transaksi.txt
+    "$KEUANGAN" report --bulan "$BULAN_LALU" > report.tsv 2>/dev/null
+    "$KEUANGAN" export analisis --bulan "$BULAN_LALU" > analisis.tsv 2>/dev/null
+    "$KEUANGAN" export analisis > analisis_semua.tsv 2>/dev/null
+    periksa "report memakai total snapshot" grep -qx 'total_pengeluaran	12000' report.tsv
+    periksa "export analisis bulan memakai total snapshot" grep -q "^$BULAN_LALU	0	12000	" analisis.tsv
+    periksa "export analisis semua bulan memakai total snapshot" grep -q "^$BULAN_LALU	0	12000	" analisis_semua.tsv
+else
+    echo "LEWAT close bulan lalu (bulan berjalan Januari)"
+fi
+
+# ===== close/verify/reopen: perubahan ditolak, perubahan diam-diam terdeteksi =====
+
+if [ "$BULAN_LALU" -ge 1 ]; then
+    data_baru
+    "$KEUANGAN" add --tanggal "$TGL_LALU" --jenis pengeluaran --pos Makan --nominal 12000 >/dev/null 2>&1
+    harap_keluar 0 "close bulan lalu (verify)" close --bulan "$BULAN_LALU"
+    periksa "close menulis snapshot" test -f "data/tutup_$(printf '%02d' "$BULAN_LALU").txt"
+    harap_keluar 1 "close bulan yang sudah ditutup ditolak" close --bulan "$BULAN_LALU"
+    "$KEUANGAN" verify --bulan "$BULAN_LALU" > verify.tsv 2>/dev/null
+    periksa "verify bulan ditutup: tertutup" grep -qx "$BULAN_LALU	tertutup" verify.tsv
+
+    harap_keluar 1 "add di bulan ditutup ditolak" \
+        add --tanggal "$TGL_LALU" --jenis pemasukan --pos Gaji --nominal 5000
+    printf '%s,pengeluaran,Makan,1000,\n' "$TGL_LALU" > impor.csv
+    harap_keluar 1 "import di bulan ditutup ditolak" import impor.csv
+    harap_baris 1 "transaksi bulan ditutup tidak bertambah"
+    periksa "CRUD pos di bulan ditutup ditolak" "$POS_TERTUTUP" "$BULAN_LALU"
+
+    echo "T0099|$TGL_LALU|Pengeluaran|Makan|1000|" >> data/transaksi.txt
+    harap_keluar 1 "verify gagal setelah file transaksi diubah" verify --bulan "$BULAN_LALU"
+    "$KEUANGAN" verify --bulan "$BULAN_LALU" > verify.tsv 2>/dev/null
+    periksa "verify melaporkan berubah" grep -qx "$BULAN_LALU	berubah" verify.tsv
+
+    harap_keluar 0 "reopen bulan lalu" reopen --bulan "$BULAN_LALU"
+    harap_keluar 1 "reopen bulan yang tidak ditutup ditolak" reopen --bulan "$BULAN_LALU"
+    "$KEUANGAN" verify --bulan "$BULAN_LALU" > verify.tsv 2>/dev/null
+    periksa "verify setelah reopen: terbuka" grep -qx "$BULAN_LALU	terbuka" verify.tsv
+    harap_keluar 0 "add setelah reopen bisa" \
+        add --tanggal "$TGL_LALU" --jenis pemasukan --pos Gaji --nominal 5000
+    harap_baris 3 "transaksi setelah reopen tertulis"
+else
+    echo "LEWAT close/verify/reopen (bulan berjalan Januari)"
+fi
+
+# ===== seal/unseal: keluaran tetap sama dan data kembali utuh =====
+
+data_baru
+TAHUN_INI=$(date +%Y)
+TAHUN_LALU=$((TAHUN_INI - 1))
+"$GEN" --dir . --baris 3000 --tahun 2 --tahun-akhir "$TAHUN_INI" >/dev/null 2>&1
+cp data/transaksi.txt transaksi_asli.txt
+"$KEUANGAN" export transaksi > ekspor_awal.tsv 2>/dev/null
+"$KEUANGAN" report > report_awal.tsv 2>/dev/null
+periksa "data sintetis mencakup tahun lalu" grep -q -- "-$TAHUN_LALU|" transaksi_asli.txt
+
+harap_keluar 0 "seal tahun lalu" seal --tahun "$TAHUN_LALU"
+periksa "seal menulis arsip" test -f "data/arsip_$TAHUN_LALU.bin"
+periksa "seal membuang baris tahun itu dari file teks" sh -c "! grep -q -- '-$TAHUN_LALU|' data/transaksi.txt"
+"$KEUANGAN" export transaksi > ekspor_segel.tsv 2>/dev/null
+"$KEUANGAN" report > report_segel.tsv 2>/dev/null
+periksa "export sama setelah seal" cmp ekspor_awal.tsv ekspor_segel.tsv
+periksa "report sama setelah seal" cmp report_awal.tsv report_segel.tsv
+harap_keluar 1 "add di tahun yang disegel ditolak" \
+    add --tanggal "01-03-$TAHUN_LALU" --jenis pengeluaran --pos Makan --nominal 1000
+
+harap_keluar 0 "unseal tahun lalu" unseal --tahun "$TAHUN_LALU"
+periksa "unseal menghapus arsip" test ! -e "data/arsip_$TAHUN_LALU.bin"
+sort transaksi_asli.txt > asli_urut.txt
+sort data/transaksi.txt > kini_urut.txt
+periksa "unseal mengembalikan semua baris" cmp asli_urut.txt kini_urut.txt
+
+# Proses mati setelah arsip ditulis tetapi sebelum file teks diganti
+"$KEUANGAN" seal --tahun "$TAHUN_LALU" >/dev/null 2>&1
+cp transaksi_asli.txt data/transaksi.txt
+echo "SEGEL $TAHUN_LALU" > data/segel.jurnal
+"$KEUANGAN" export transaksi > ekspor_pulih.tsv 2>/dev/null
+periksa "segel terhenti tidak menggandakan transaksi" cmp ekspor_awal.tsv ekspor_pulih.tsv
+periksa "pemulihan menghapus jurnal" test ! -e data/segel.jurnal
+
+# Proses mati setelah file teks diganti tetapi sebelum arsip dihapus
+cp "data/arsip_$TAHUN_LALU.bin" arsip_cadangan.bin
+"$KEUANGAN" unseal --tahun "$TAHUN_LALU" >/dev/null 2>&1
+cp arsip_cadangan.bin "data/arsip_$TAHUN_LALU.bin"
+echo "BUKA $TAHUN_LALU" > data/segel.jurnal
+"$KEUANGAN" export transaksi > ekspor_pulih.tsv 2>/dev/null
+periksa "buka segel terhenti tidak menggandakan transaksi" cmp ekspor_awal.tsv ekspor_pulih.tsv
+periksa "pemulihan buka segel menghapus arsip" test ! -e "data/arsip_$TAHUN_LALU.bin"
+sort data/transaksi.txt > kini_urut.txt
+periksa "pemulihan buka segel mengembalikan semua baris" cmp asli_urut.txt kini_urut.txt
+
+exit $GAGAL
@@ -0,0 +1,73 @@
+/*
+ * =============================================================================
+ * File        : pos_tertutup.c
+ * Deskripsi   : Program uji penolakan CRUD pos pada bulan yang ditutup
+ * Author      : Hafiz Fauzan Syafrudin
+ * Version     : v1.0
+ * Tanggal     : 19 Oktober 2026
+ * =============================================================================
+ *
+ * TUJUAN MODUL:
+ * CLI tidak punya perintah pos, jadi tests/cli.sh memanggil program ini untuk
+ * memastikan tambah, ubah, hapus, dan salin pos ditolak pada bulan yang
+ * sudah ditutup. Dijalankan di direktori kerja yang berisi data/.
+ *
+ * MODUL YANG DIBUTUHKAN (DEPENDENCIES):
+ * - stdio.h, stdlib.h, string.h : Untuk keluaran, atoi, dan strcmp
+ * - pos.h       : Untuk tambah_pos, ubah_pos, dan hapus_pos
+ * - file.h      : Untuk salin_pos_dari_bulan
+ *
+ * CATATAN:
+ * Penggunaan: pos_tertutup BULAN. Kode keluar 0 jika semua operasi ditolak
+ * dengan pesan "Bulan sudah ditutup", 1 jika ada yang lolos, 2 jika salah pakai.
+ * =============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pos.h"
+#include "file.h"
+
+/* ===== FUNGSI HELPER ===== */
+
+/**
+ * Helper: Memeriksa satu operasi ditolak karena bulan ditutup
+ */
+static int harap_ditolak(const char *nama, int hasil, const char *error_msg) {
+    if (hasil == 0 && strcmp(error_msg, "Bulan sudah ditutup") == 0) return 1;
+
+    fprintf(stderr, "%s tidak ditolak (hasil %d, pesan \"%s\")\n", nama, hasil, error_msg);
+    return 0;
+}
+
+/* ===== PROGRAM UTAMA ===== */
+
+int main(int argc, char *argv[]) {
+    int bulan = (argc == 2) ? atoi(argv[1]) : 0;
+    if (bulan < 1 || bulan > 12) {
+        fprintf(stderr, "Penggunaan: %s BULAN\n", argv[0]);
+        return 2;
+    }
+
+    int ok = 1;
+    char error_msg[100];
+
+    error_msg[0] = '\0';
+    ok &= harap_ditolak("tambah_pos", tambah_pos("PosBaru", 1000, bulan, error_msg), error_msg);
+
+    error_msg[0] = '\0';
+    ok &= harap_ditolak("ubah_pos", ubah_pos(1, "PosUbah", 2000, bulan, error_msg), error_msg);
+
+    error_msg[0] = '\0';
+    ok &= harap_ditolak("hapus_pos", hapus_pos(1, bulan, error_msg), error_msg);
+
+    /* salin_pos_dari_bulan tidak memberi pesan; cukup hasilnya 0 */
+    int sumber = (bulan == 12) ? 11 : bulan + 1;
+    if (salin_pos_dari_bulan(bulan, sumber) != 0) {
+        fprintf(stderr, "salin_pos_dari_bulan tidak ditolak\n");
+        ok = 0;
+    }
+
+    return ok ? 0 : 1;
+}